@@ -6,8 +6,9 @@ goto :genn_begin
 :genn_help
 rem :: display genn-buildmodel.bat help
 echo genn-buildmodel.bat script usage:
-echo genn-buildmodel.bat [cdho] model
+echo genn-buildmodel.bat [cdpho] model
 echo -c             only generate simulation code for the CPU
+echo -p             only generate multi-core simulation code for the CPU using OpenMP
 echo -d             enables the debugging mode
 echo -h             shows this help message
 echo -o outpath     changes the output directory
@@ -19,7 +20,7 @@ rem :: define genn-buildmodel.bat options separated by spaces
 rem :: -<option>:              option
 rem :: -<option>:""            option with argument
 rem :: -<option>:"<default>"   option with argument and default value
-set "OPTIONS=-o:"%CD%" -i:"" -d: -c: -h:"
+set "OPTIONS=-o:"%CD%" -i:"" -d: -c: -p: -h:"
 for %%O in (%OPTIONS%) do for /f "tokens=1,* delims=:" %%A in ("%%O") do set "%%A=%%~B"
 
 :genn_option
@@ -62,6 +63,10 @@ if defined -d (
 		set "BACKEND_PROJECT=single_threaded_cpu_backend"
 		set "MACROS=%MACROS% /p:Configuration=Debug"
 		set GENERATOR=.\generator_Debug.exe
+	) else if defined -p (
+		set "BACKEND_PROJECT=openmp_backend"
+		set "MACROS=%MACROS% /p:Configuration=Debug_OpenMP"
+		set GENERATOR=.\generator_Debug_OpenMP.exe
 	) else (
 		set "BACKEND_PROJECT=cuda_backend"
 		set "MACROS=%MACROS% /p:Configuration=Debug_CUDA"
@@ -73,6 +78,10 @@ if defined -d (
 		set "BACKEND_PROJECT=single_threaded_cpu_backend"
 		set "MACROS=%MACROS% /p:Configuration=Release"
 		set GENERATOR=.\generator_Release.exe
+	) else if defined -p (
+		set "BACKEND_PROJECT=openmp_backend"
+		set "MACROS=%MACROS% /p:Configuration=Release_OpenMP"
+		set GENERATOR=.\generator_Release_OpenMP.exe
 	) else (
 		set "BACKEND_PROJECT=cuda_backend"
 		set "MACROS=%MACROS% /p:Configuration=Release_CUDA"
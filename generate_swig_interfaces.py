@@ -410,6 +410,11 @@ def generateBackend(swigPath, folder, namespace):
         mg.addSwigIgnore("BackendBase")
         mg.addSwigInclude('"code_generator/backendBase.h"')
 
+        # If backend is one of the CPU backends, parse CPU backend base, ignoring BackendCPU itself to get PreferencesCPU definition
+        if namespace in ("SingleThreadedCPU", "OpenMP"):
+            mg.addSwigIgnore("BackendCPU")
+            mg.addSwigInclude('"code_generator/backendCPU.h"')
+
         # Parse backend, ignore Backend itself to get PreferencesBase definition
         mg.addSwigIgnore("Backend")
         mg.addSwigInclude('"backend.h"')
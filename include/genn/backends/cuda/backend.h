@@ -128,18 +128,18 @@ public:
     //--------------------------------------------------------------------------
     virtual void genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
                                  NeuronGroupSimHandler simHandler, NeuronGroupMergedHandler wuVarUpdateHandler,
-                                 HostHandler pushEGPHandler) const override;
+                                 HostHandler pushEGPHandler, ModuleHandler moduleHandler) const override;
 
     virtual void genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
                                   SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
                                   SynapseGroupMergedHandler wumEventHandler, SynapseGroupMergedHandler wumProceduralConnectHandler,
                                   SynapseGroupMergedHandler postLearnHandler, SynapseGroupMergedHandler synapseDynamicsHandler,
-                                  HostHandler pushEGPHandler) const override;
+                                  HostHandler pushEGPHandler, ModuleHandler moduleHandler) const override;
 
     virtual void genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                          NeuronGroupMergedHandler localNGHandler, SynapseGroupMergedHandler sgDenseInitHandler, 
                          SynapseGroupMergedHandler sgSparseConnectHandler, SynapseGroupMergedHandler sgSparseInitHandler,
-                         HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler) const override;
+                         HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler, ModuleHandler moduleHandler) const override;
 
     //! Gets the stride used to access synaptic matrix rows, taking into account sparse data structure, padding etc
     virtual size_t getSynapticMatrixRowStride(const SynapseGroupInternal &sg) const override;
@@ -229,12 +229,34 @@ public:
     virtual bool isSynRemapRequired() const override{ return true; }
     virtual bool isPostsynapticRemapRequired() const override{ return true; }
 
+    //! Can sparse connectivity and synapse variables be attached to memory-mapped files?
+    /*! Kernels only access device copies so mapped host arrays would still need copying */
+    virtual bool isSparseMatrixMappingSupported() const override{ return false; }
+    virtual bool isRowRemapRequired(const SynapseGroupInternal&) const override{ return false; }
+    virtual bool isSparseLayoutSliced(const SynapseGroupInternal&) const override{ return false; }
+    virtual unsigned int getSparseLayoutTileSize(const SynapseGroupInternal&) const override{ return 0; }
+
     //! Is automatic copy mode enabled in the preferences?
     virtual bool isAutomaticCopyEnabled() const override { return m_Preferences.automaticCopy; }
 
     //! How many bytes of memory does 'device' have
     virtual size_t getDeviceMemoryBytes() const override{ return m_ChosenDevice.totalGlobalMem; }
 
+    //! Get directory in which to cache compiled modules (empty if build cache is disabled)
+    virtual std::string getBuildCacheDirectory() const override{ return m_Preferences.buildCacheDirectory; }
+
+    //! Get shell command which prints the version and target of the compiler used by the generated Makefile
+    /*! **NOTE** like the generated Makefile, this falls back to /usr/local/cuda if CUDA_PATH isn't set and,
+        as NVCC compiles host code with the gcc in the path, that is identified too */
+    virtual std::string getCompilerIdentityCommand() const override{ return "\"${CUDA_PATH:-/usr/local/cuda}/bin/nvcc\" --version && gcc --version"; }
+
+    //! Should constant sub-expressions in neuron and synapse code be folded?
+    virtual bool isConstantFoldingEnabled() const override{ return m_Preferences.foldConstantExpressions; }
+
+    //! Get directory in which to cache sparse connectivity
+    /*! Connectivity is built on the device so is never cached */
+    virtual std::string getConnectivityCacheDirectory() const override{ return ""; }
+
     //--------------------------------------------------------------------------
     // Public API
     //--------------------------------------------------------------------------
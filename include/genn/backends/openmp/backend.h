@@ -0,0 +1,129 @@
+#pragma once
+
+// Standard C++ includes
+#include <functional>
+#include <map>
+#include <string>
+
+// GeNN includes
+#include "backendExport.h"
+
+// GeNN code generator includes
+#include "code_generator/backendCPU.h"
+
+// Forward declarations
+class ModelSpecInternal;
+namespace filesystem
+{
+    class path;
+}
+
+//--------------------------------------------------------------------------
+// CodeGenerator::OpenMP::Preferences
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+namespace OpenMP
+{
+struct Preferences : public PreferencesCPU
+{
+    //! Partition the postsynaptic neurons of each DENSE, BITMASK and SPARSE synapse group between threads during presynaptic updates
+    /*! Each thread processes every presynaptic spike but only updates the synapses targetting its own slice of postsynaptic
+        neurons so input can be accumulated without atomic operations. Rows of SPARSE connectivity are remapped
+        into postsynaptic order by initializeSparse so each thread can quickly find the synapses in its slice */
+    bool enablePostsynapticPartitioning = false;
+
+    //! Make accumulation of synaptic input into inSyn and denDelay bit-reproducible
+    /*! Presynaptic updates and synapse dynamics of DENSE, BITMASK and SPARSE synapse groups are partitioned between threads by
+        postsynaptic neuron (as with enablePostsynapticPartitioning) so input to each postsynaptic neuron is summed in the same order
+        as the single-threaded CPU backend, whatever the number of threads. CSR and PROCEDURAL synapse groups are updated serially */
+    bool enableDeterministicSynapticInput = false;
+};
+
+//--------------------------------------------------------------------------
+// CodeGenerator::OpenMP::Backend
+//--------------------------------------------------------------------------
+class BACKEND_EXPORT Backend : public BackendCPU
+{
+public:
+    Backend(const std::string &scalarType, const Preferences &preferences)
+    :   BackendCPU(scalarType, preferences), m_Preferences(preferences)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // CodeGenerator::BackendBase virtuals
+    //--------------------------------------------------------------------------
+    virtual void genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
+                                 NeuronGroupSimHandler simHandler, NeuronGroupMergedHandler wuVarUpdateHandler,
+                                 HostHandler pushEGPHandler, ModuleHandler moduleHandler) const override;
+
+    virtual void genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
+                                  SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
+                                  SynapseGroupMergedHandler wumEventHandler, SynapseGroupMergedHandler wumProceduralConnectHandler,
+                                  SynapseGroupMergedHandler postLearnHandler, SynapseGroupMergedHandler synapseDynamicsHandler,
+                                  HostHandler pushEGPHandler, ModuleHandler moduleHandler) const override;
+
+    virtual void genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
+                         NeuronGroupMergedHandler localNGHandler, SynapseGroupMergedHandler sgDenseInitHandler, 
+                         SynapseGroupMergedHandler sgSparseConnectHandler, SynapseGroupMergedHandler sgSparseInitHandler,
+                         HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler, ModuleHandler moduleHandler) const override;
+
+    virtual void genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+
+    virtual void genVariableInit(CodeStream &os, const std::string &count, const std::string &indexVarName,
+                                 const Substitutions &kernelSubs, Handler handler) const override;
+    virtual void genSynapseVariableRowInit(CodeStream &os, const SynapseGroupMerged &sg,
+                                           const Substitutions &kernelSubs, Handler handler) const override;
+
+    virtual bool isRowRemapRequired(const SynapseGroupInternal &sg) const override;
+
+    virtual bool isSparseLayoutSliced(const SynapseGroupInternal&) const override{ return false; }
+    virtual unsigned int getSparseLayoutTileSize(const SynapseGroupInternal&) const override{ return 0; }
+
+protected:
+    //--------------------------------------------------------------------------
+    // CodeGenerator::BackendCPU virtuals
+    //--------------------------------------------------------------------------
+    virtual bool isOpenMPRequired() const override{ return true; }
+
+private:
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+    void genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const SynapseGroupMerged &sg, const Substitutions &popSubs,
+                              bool trueSpike, SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
+                              SynapseGroupMergedHandler wumProceduralConnectHandler) const;
+
+    void genEmitSpike(CodeStream &os, const NeuronGroupMerged &ng, const Substitutions &subs, bool trueSpike, bool parallel) const;
+
+    //! Generate code to copy spikes emitted by one thread into their final position in the spike array
+    void genCompactSpikes(CodeStream &os, const NeuronGroupMerged &ng, bool trueSpike) const;
+
+    //! Generate code to build column-major remapping of sparse synapse group with a parallel counting sort
+    void genColumnRemap(CodeStream &os, const SynapseGroupMerged &sg, bool csr) const;
+
+    //! Should presynaptic update of synapse group be partitioned between threads by postsynaptic neuron?
+    bool isPresynapticUpdatePartitioned(const SynapseGroupInternal &sg) const;
+
+    //! Should synapse dynamics of synapse group be partitioned between threads by postsynaptic neuron?
+    bool isSynapseDynamicsPartitioned(const SynapseGroupInternal &sg) const;
+
+    //! Generate presynaptic update code where each thread processes all spikes but only its own slice of postsynaptic neurons
+    void genPartitionedPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const SynapseGroupMerged &sg, const Substitutions &popSubs,
+                                         bool trueSpike, SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler) const;
+
+    //! Generate code to build remapping of each row of sparse synapse group into postsynaptic order
+    void genRowRemap(CodeStream &os, const SynapseGroupMerged &sg) const;
+
+    //! Generate code to search remapping of row of sparse synapse group for the first synapse in this thread's slice of postsynaptic neurons
+    void genRowRemapSearch(CodeStream &os, const SynapseGroupMerged &sg, const std::string &row) const;
+
+  
+    //--------------------------------------------------------------------------
+    // Members
+    //--------------------------------------------------------------------------
+    const Preferences m_Preferences;
+};
+}   // namespace OpenMP
+}   // namespace CodeGenerator
@@ -9,9 +9,10 @@
 #include "backendExport.h"
 
 // GeNN code generator includes
-#include "code_generator/backendBase.h"
+#include "code_generator/backendCPU.h"
 
 // Forward declarations
+class ModelSpecInternal;
 namespace filesystem
 {
     class path;
@@ -24,125 +25,117 @@ namespace CodeGenerator
 {
 namespace SingleThreadedCPU
 {
-struct Preferences : public PreferencesBase
+struct Preferences : public PreferencesCPU
 {
+    //! Generate neuron update code which the host compiler can vectorise
+    /*! Neurons are updated in blocks: the state update and threshold test write a per-block spike mask
+        and spikes are then compacted from the mask in a separate pass. Groups which require a simulation
+        RNG or have pre or postsynaptic weight update model variables are always updated one neuron at a time. */
+    bool enableVectorisedNeuronUpdate = false;
+
+    //! Number of neurons in each block processed by the vectorised neuron update
+    unsigned int vectorisedNeuronBlockSize = 64;
+
+    //! Generate re-entrant code where all model state is thread-local
+    /*! Each thread which calls allocateMem() gets its own, independent instance of the model which it can initialise,
+        simulate and finally free with freeMem(), so several simulations of the same model can run in one process */
+    bool enableReentrantModel = false;
+
+    //! Store the connectivity and synapse variables of SPARSE synapse groups in the sliced ELLPACK (SELL-C-sigma) layout
+    /*! Rows are sorted by length within windows of sparseSortWindowSize rows and the synapses of each slice of sparseSliceSize
+        consecutive rows are interleaved so synapse dynamics can be vectorised across the rows of a slice. initializeSparse()
+        converts connectivity and any synapse variables which aren't initialised by GeNN into this layout.
+        Groups with postsynaptic learning are always stored row-major. */
+    bool enableSlicedSparseLayout = false;
+
+    //! Number of rows interleaved in each slice of the sliced sparse layout
+    unsigned int sparseSliceSize = 32;
+
+    //! Number of rows within which rows are sorted by length in the sliced sparse layout (must be a multiple of sparseSliceSize)
+    unsigned int sparseSortWindowSize = 256;
+
+    //! Number of postsynaptic neurons in each tile of the tiled sparse layout (0 disables tiling)
+    /*! If non-zero, initializeSparse() splits the connectivity and synapse variables of SPARSE synapse groups into tiles of
+        postsynaptic neurons, each stored contiguously, and presynaptic updates then process all of a timestep's spikes one tile
+        at a time so the input accumulated into each tile stays in the cache. Groups with postsynaptic learning are always stored
+        row-major and this can't be combined with the sliced sparse layout. */
+    unsigned int postsynapticTileSize = 0;
 };
 
 //--------------------------------------------------------------------------
 // CodeGenerator::SingleThreadedCPU::Backend
 //--------------------------------------------------------------------------
-class BACKEND_EXPORT Backend : public BackendBase
+class BACKEND_EXPORT Backend : public BackendCPU
 {
 public:
-    Backend(const std::string &scalarType, const Preferences &preferences)
-    :   BackendBase(scalarType), m_Preferences(preferences)
-    {
-    }
+    Backend(const std::string &scalarType, const Preferences &preferences);
 
     //--------------------------------------------------------------------------
     // CodeGenerator::BackendBase virtuals
     //--------------------------------------------------------------------------
     virtual void genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
                                  NeuronGroupSimHandler simHandler, NeuronGroupMergedHandler wuVarUpdateHandler,
-                                 HostHandler pushEGPHandler) const override;
+                                 HostHandler pushEGPHandler, ModuleHandler moduleHandler) const override;
 
     virtual void genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
                                   SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
                                   SynapseGroupMergedHandler wumEventHandler, SynapseGroupMergedHandler wumProceduralConnectHandler,
                                   SynapseGroupMergedHandler postLearnHandler, SynapseGroupMergedHandler synapseDynamicsHandler,
-                                  HostHandler pushEGPHandler) const override;
+                                  HostHandler pushEGPHandler, ModuleHandler moduleHandler) const override;
 
     virtual void genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                          NeuronGroupMergedHandler localNGHandler, SynapseGroupMergedHandler sgDenseInitHandler, 
                          SynapseGroupMergedHandler sgSparseConnectHandler, SynapseGroupMergedHandler sgSparseInitHandler,
-                         HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler) const override;
+                         HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler, ModuleHandler moduleHandler) const override;
 
-    virtual size_t getSynapticMatrixRowStride(const SynapseGroupInternal &sg) const override;
-
-    virtual void genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
     virtual void genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
-    virtual void genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
-    virtual void genAllocateMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
-    virtual void genStepTimeFinalisePreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
-
-    virtual void genVariableDefinition(CodeStream &definitions, CodeStream &definitionsInternal, const std::string &type, const std::string &name, VarLocation loc) const override;
-    virtual void genVariableImplementation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
-    virtual MemAlloc genVariableAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, size_t count) const override;
-    virtual void genVariableFree(CodeStream &os, const std::string &name, VarLocation loc) const override;
-
-    virtual void genExtraGlobalParamDefinition(CodeStream &definitions, const std::string &type, const std::string &name, VarLocation loc) const override;
-    virtual void genExtraGlobalParamImplementation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
-    virtual void genExtraGlobalParamAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
-    virtual void genExtraGlobalParamPush(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
-    virtual void genExtraGlobalParamPull(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
-
-    //! Generate code for declaring merged group data to the 'device'
-    virtual void genMergedGroupImplementation(CodeStream &os, const std::string &suffix, size_t idx, size_t numGroups) const override;
-    
-    //! Generate code for pushing merged group data to the 'device'
-    virtual void genMergedGroupPush(CodeStream &os, const std::string &suffix, size_t idx, size_t numGroups) const override;
-
-    //! Generate code for pushing an updated EGP value into the merged group structure on 'device'
-    virtual void genMergedExtraGlobalParamPush(CodeStream &os, const std::string &suffix, size_t mergedGroupIdx, size_t groupIdx,
-                                               const std::string &fieldName, const std::string &egpName) const override;
-
-    virtual void genPopVariableInit(CodeStream &os,const Substitutions &kernelSubs, Handler handler) const override;
+
     virtual void genVariableInit(CodeStream &os, const std::string &count, const std::string &indexVarName,
                                  const Substitutions &kernelSubs, Handler handler) const override;
     virtual void genSynapseVariableRowInit(CodeStream &os, const SynapseGroupMerged &sg,
                                            const Substitutions &kernelSubs, Handler handler) const override;
 
-    virtual void genVariablePush(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, bool autoInitialized, size_t count) const override;
-    virtual void genVariablePull(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, size_t count) const override;
-    virtual void genCurrentVariablePush(CodeStream &os, const NeuronGroupInternal &ng, const std::string &type, const std::string &name, VarLocation loc) const override;
-    virtual void genCurrentVariablePull(CodeStream &os, const NeuronGroupInternal &ng, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual bool isRowRemapRequired(const SynapseGroupInternal&) const override{ return false; }
 
-    virtual void genCurrentTrueSpikePush(CodeStream &os, const NeuronGroupInternal &ng) const override;
-    virtual void genCurrentTrueSpikePull(CodeStream &os, const NeuronGroupInternal &ng) const override;
-    virtual void genCurrentSpikeLikeEventPush(CodeStream &os, const NeuronGroupInternal &ng) const override;
-    virtual void genCurrentSpikeLikeEventPull(CodeStream &os, const NeuronGroupInternal &ng) const override;
+    virtual bool isSparseLayoutSliced(const SynapseGroupInternal &sg) const override;
+    virtual unsigned int getSparseLayoutTileSize(const SynapseGroupInternal &sg) const override;
 
-    virtual MemAlloc genGlobalRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free) const override;
-    virtual MemAlloc genPopulationRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
-                                      const std::string &name, size_t count) const override;
-    virtual void genTimer(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
-                          CodeStream &stepTimeFinalise, const std::string &name, bool updateInStepTime) const override;
+    virtual std::string getStateStorageSpecifier() const override{ return m_Preferences.enableReentrantModel ? "thread_local " : ""; }
 
-    //! Generate code to return amount of free 'device' memory in bytes
-    virtual void genReturnFreeDeviceMemoryBytes(CodeStream &os) const override;
+private:
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+    void genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const SynapseGroupMerged &sg, const Substitutions &popSubs,
+                              bool trueSpike, SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
+                              SynapseGroupMergedHandler wumProceduralConnectHandler) const;
 
-    virtual void genMakefilePreamble(std::ostream &os) const override;
-    virtual void genMakefileLinkRule(std::ostream &os) const override;
-    virtual void genMakefileCompileRule(std::ostream &os) const override;
+    //! Generate presynaptic update code which processes all spikes one tile of postsynaptic neurons at a time
+    void genTiledPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const SynapseGroupMerged &sg, const Substitutions &popSubs,
+                                   bool trueSpike, SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler) const;
 
-    virtual void genMSBuildConfigProperties(std::ostream &os) const override;
-    virtual void genMSBuildImportProps(std::ostream &os) const override;
-    virtual void genMSBuildItemDefinitions(std::ostream &os) const override;
-    virtual void genMSBuildCompileModule(const std::string &moduleName, std::ostream &os) const override;
-    virtual void genMSBuildImportTarget(std::ostream &os) const override;
+    void genEmitSpike(CodeStream &os, const NeuronGroupMerged &ng, const Substitutions &subs, bool trueSpike) const;
 
-    virtual std::string getArrayPrefix() const override{ return ""; }
-    virtual std::string getScalarPrefix() const override{ return ""; }
+    //! Can the synapse dynamics of the rows in each slice be updated without any loop-carried dependencies?
+    bool isSlicedSynapseDynamicsIndependent(const SynapseGroupMerged &sg) const;
 
-    virtual bool isGlobalRNGRequired(const ModelSpecMerged &modelMerged) const override;
-    virtual bool isPopulationRNGRequired() const override { return false; }
-    virtual bool isSynRemapRequired() const override{ return false; }
-    virtual bool isPostsynapticRemapRequired() const override{ return true; }
+    //! Generate code to sort rows into slices and move connectivity from row-major into the sliced layout
+    void genSlicedLayout(CodeStream &os, const SynapseGroupMerged &sg) const;
 
-    //! Is automatic copy mode enabled in the preferences?
-    virtual bool isAutomaticCopyEnabled() const override { return m_Preferences.automaticCopy; }
+    //! Generate code to move the synapses of an array from row-major into the sliced layout
+    void genSliceArray(CodeStream &os, const SynapseGroupMerged &sg, const std::string &type, const std::string &name) const;
 
-    //! How many bytes of memory does 'device' have
-    virtual size_t getDeviceMemoryBytes() const override{ return 0; }
+    //! Generate code to calculate the tile row pointers and where each row-major synapse is stored in the tiled layout
+    void genTiledLayout(CodeStream &os, const SynapseGroupMerged &sg) const;
 
-private:
-    //--------------------------------------------------------------------------
-    // Private methods
-    //--------------------------------------------------------------------------
-    void genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const SynapseGroupMerged &sg, const Substitutions &popSubs,
-                              bool trueSpike, SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler) const;
+    //! Generate code to move the synapses of an array from row-major into the tiled layout
+    void genTileArray(CodeStream &os, const SynapseGroupMerged &sg, const std::string &type, const std::string &name) const;
 
-    void genEmitSpike(CodeStream &os, const NeuronGroupMerged &ng, const Substitutions &subs, bool trueSpike) const;
+    //! Generate code to get group g from merged group array
+    void genGetMergedGroup(CodeStream &os, const std::string &suffix, size_t idx) const;
+
+    //! Should neuron update code for this merged group be vectorised?
+    bool isNeuronUpdateVectorised(const NeuronGroupMerged &ng) const;
 
   
     //--------------------------------------------------------------------------
@@ -56,6 +56,20 @@ struct PreferencesBase
 
     //! Logging level to use for code generation
     plog::Severity logLevel = plog::info;
+
+    //! Directory in which to cache compiled modules and libraries, keyed by a hash of the code and flags they were built from (used for unix based platforms)
+    /*! If this is empty, no build cache is used. Otherwise, the directory is created if it doesn't already exist and can be shared between models */
+    std::string buildCacheDirectory = "";
+
+    //! Generate the code for each merged group into its own module so modules can be compiled in parallel (not supported by the CUDA backend)
+    bool splitMergedGroupModules = false;
+
+    //! Parse neuron and synapse code after parameters have been substituted, fold any sub-expressions which only involve literals and remove any branches this makes dead
+    bool foldConstantExpressions = false;
+
+    //! Directory in which to cache sparse connectivity built by initialize(), keyed by a hash of the snippet, its parameters, the population sizes and the seed (not supported by the CUDA backend)
+    /*! If this is empty, no connectivity cache is used. Otherwise, the directory is created if it doesn't already exist and can be shared between models */
+    std::string connectivityCacheDirectory = "";
 };
 
 //--------------------------------------------------------------------------
@@ -117,6 +131,10 @@ public:
     //--------------------------------------------------------------------------
     typedef std::function<void(CodeStream &)> HostHandler;
 
+    //! Callback function type for generating code into an additional module with the specified name
+    /*! Backends can use this to generate the code for each merged group into its own translation unit so they can be compiled in parallel */
+    typedef std::function<void(const std::string &, HostHandler)> ModuleHandler;
+
     typedef std::function<void(CodeStream &, Substitutions&)> Handler;
     
     template<typename T>
@@ -143,10 +161,11 @@ public:
     /*! \param os                       CodeStream to write function to
         \param model                    merged model to generate code for
         \param simHandler               callback to write platform-independent code to update an individual NeuronGroup
-        \param wuVarUpdateHandler       callback to write platform-independent code to update pre and postsynaptic weight update model variables when neuron spikes*/
+        \param wuVarUpdateHandler       callback to write platform-independent code to update pre and postsynaptic weight update model variables when neuron spikes
+        \param moduleHandler            callback to generate code into an additional module*/
     virtual void genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
                                  NeuronGroupSimHandler simHandler, NeuronGroupMergedHandler wuVarUpdateHandler,
-                                 HostHandler pushEGPHandler) const = 0;
+                                 HostHandler pushEGPHandler, ModuleHandler moduleHandler) const = 0;
 
     //! Generate platform-specific function to update the state of all synapses
     /*! \param os                           CodeStream to write function to
@@ -165,17 +184,18 @@ public:
                                             "id_pre", "id_post" and "id_syn" variables will be provided to callback via Substitutions.
         \param synapseDynamicsHandler       callback to write platform-independent code to update time-driven synapse dynamics.
                                             "id_pre", "id_post" and "id_syn" variables; and either "addToInSynDelay" or "addToInSyn" function will be provided
-                                            to callback via Substitutions.*/
+                                            to callback via Substitutions.
+        \param moduleHandler                callback to generate code into an additional module*/
     virtual void genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
                                   SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
                                   SynapseGroupMergedHandler wumEventHandler, SynapseGroupMergedHandler wumProceduralConnectHandler,
                                   SynapseGroupMergedHandler postLearnHandler, SynapseGroupMergedHandler synapseDynamicsHandler,
-                                  HostHandler pushEGPHandler) const = 0;
+                                  HostHandler pushEGPHandler, ModuleHandler moduleHandler) const = 0;
 
     virtual void genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                          NeuronGroupMergedHandler localNGHandler, SynapseGroupMergedHandler sgDenseInitHandler, 
                          SynapseGroupMergedHandler sgSparseConnectHandler, SynapseGroupMergedHandler sgSparseInitHandler,
-                         HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler) const = 0;
+                         HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler, ModuleHandler moduleHandler) const = 0;
 
     //! Gets the stride used to access synaptic matrix rows, taking into account sparse data structure, padding etc
     virtual size_t getSynapticMatrixRowStride(const SynapseGroupInternal &sg) const = 0;
@@ -293,6 +313,10 @@ public:
 
     virtual std::string getScalarPrefix() const{ return ""; }
 
+    //! Backends can give model state a storage class e.g. to make it thread-local so independent instances of a model can be simulated on different threads.
+    //! This function returns the specifier (including trailing space) which should prefix every declaration and definition of model state.
+    virtual std::string getStateStorageSpecifier() const{ return ""; }
+
     //! Different backends use different RNGs for different things. Does this one require a global RNG for the specified model?
     virtual bool isGlobalRNGRequired(const ModelSpecMerged &modelMerged) const = 0;
 
@@ -305,12 +329,40 @@ public:
     //! Different backends may implement synaptic plasticity differently. Does this one require a postsynaptic remapping data structure?
     virtual bool isPostsynapticRemapRequired() const = 0;
 
+    //! Can sparse connectivity and synapse variables be attached to memory-mapped files rather than copied into host arrays?
+    virtual bool isSparseMatrixMappingSupported() const = 0;
+
+    //! Different backends may implement presynaptic updates and synapse dynamics differently. Does this one
+    //! require each row of this synapse group's sparse connectivity to be remapped into postsynaptic order?
+    virtual bool isRowRemapRequired(const SynapseGroupInternal &sg) const = 0;
+
+    //! Does this backend store this synapse group's SPARSE connectivity and synapse variables in the
+    //! sliced ELLPACK (SELL-C-sigma) layout rather than row-major?
+    virtual bool isSparseLayoutSliced(const SynapseGroupInternal &sg) const = 0;
+
+    //! How many postsynaptic neurons are in each tile of this synapse group's SPARSE connectivity and synapse variables?
+    /*! If this is non-zero, the synapses of each tile of postsynaptic neurons are stored contiguously, rather than row-major */
+    virtual unsigned int getSparseLayoutTileSize(const SynapseGroupInternal &sg) const = 0;
+
     //! Is automatic copy mode enabled in the preferences?
     virtual bool isAutomaticCopyEnabled() const = 0;
 
     //! How many bytes of memory does 'device' have
     virtual size_t getDeviceMemoryBytes() const = 0;
 
+    //! Get directory in which to cache compiled modules (empty if build cache is disabled)
+    virtual std::string getBuildCacheDirectory() const = 0;
+
+    //! Get shell command which prints the version and target of the compiler used by the generated Makefile
+    /*! Its output is included in the build cache key so objects built by different compilers are never mixed */
+    virtual std::string getCompilerIdentityCommand() const = 0;
+
+    //! Should constant sub-expressions in neuron and synapse code be folded?
+    virtual bool isConstantFoldingEnabled() const = 0;
+
+    //! Get directory in which to cache sparse connectivity (empty if connectivity cache is disabled or not supported)
+    virtual std::string getConnectivityCacheDirectory() const = 0;
+
     //--------------------------------------------------------------------------
     // Public API
     //--------------------------------------------------------------------------
@@ -340,6 +392,15 @@ public:
         return genVariableAllocation(allocations, type, name, loc, count);
     }
 
+    //! Does the specified synapse group contain too many synapses to be indexed using 32-bit integers?
+    bool areSixtyFourBitSynapseIndicesRequired(const SynapseGroupInternal &sg) const;
+
+    //! Get the type which should be used for indexing the synapses of the specified synapse group
+    std::string getSynapseIndexType(const SynapseGroupInternal &sg) const
+    {
+        return areSixtyFourBitSynapseIndicesRequired(sg) ? "uint64_t" : "unsigned int";
+    }
+
     //! Helper function to generate matching definition and declaration code for a scalar variable
     void genScalar(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, const std::string &type, const std::string &name, VarLocation loc) const
     {
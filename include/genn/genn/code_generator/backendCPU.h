@@ -0,0 +1,261 @@
+#pragma once
+
+// Standard C++ includes
+#include <string>
+#include <vector>
+
+// GeNN includes
+#include "gennExport.h"
+
+// GeNN code generator includes
+#include "code_generator/backendBase.h"
+#include "code_generator/codeGenUtils.h"
+
+// Forward declarations
+class ModelSpecInternal;
+
+//--------------------------------------------------------------------------
+// CodeGenerator::PreferencesCPU
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+//! Base class for preferences of backends which generate code to run on the host CPU
+struct PreferencesCPU : public PreferencesBase
+{
+    //! Use counter-based Philox RNG streams rather than the global std::mt19937 for neuron simulation and sparse initialisation
+    /*! Each neuron gets a stream keyed by the model seed and its population and counted by its index and the
+        timestep so random numbers do not depend on the order in which neurons are simulated or groups merged.
+        Similarly, each row of SPARSE connectivity and of sparse synaptic variables gets its own stream so rows
+        can be initialised in parallel and the result does not depend on the number of threads */
+    bool enableCounterBasedRNG = false;
+};
+
+//--------------------------------------------------------------------------
+// CodeGenerator::BackendCPU
+//--------------------------------------------------------------------------
+//! Base class for backends which generate code to run on the host CPU
+/*! Implements everything which doesn't depend on how the generated code divides work between threads */
+class GENN_EXPORT BackendCPU : public BackendBase
+{
+public:
+    BackendCPU(const std::string &scalarType, const PreferencesCPU &preferences)
+    :   BackendBase(scalarType), m_CPUPreferences(preferences)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // CodeGenerator::BackendBase virtuals
+    //--------------------------------------------------------------------------
+    virtual size_t getSynapticMatrixRowStride(const SynapseGroupInternal &sg) const override;
+
+    virtual void genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genAllocateMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genStepTimeFinalisePreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+
+    virtual void genVariableDefinition(CodeStream &definitions, CodeStream &definitionsInternal, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual void genVariableImplementation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual MemAlloc genVariableAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, size_t count) const override;
+    virtual void genVariableFree(CodeStream &os, const std::string &name, VarLocation loc) const override;
+
+    virtual void genExtraGlobalParamDefinition(CodeStream &definitions, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual void genExtraGlobalParamImplementation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual void genExtraGlobalParamAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual void genExtraGlobalParamPush(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual void genExtraGlobalParamPull(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
+
+    //! Generate code for declaring merged group data to the 'device'
+    virtual void genMergedGroupImplementation(CodeStream &os, const std::string &suffix, size_t idx, size_t numGroups) const override;
+
+    //! Generate code for pushing merged group data to the 'device'
+    virtual void genMergedGroupPush(CodeStream &os, const std::string &suffix, size_t idx, size_t numGroups) const override;
+
+    //! Generate code for pushing an updated EGP value into the merged group structure on 'device'
+    virtual void genMergedExtraGlobalParamPush(CodeStream &os, const std::string &suffix, size_t mergedGroupIdx, size_t groupIdx,
+                                               const std::string &fieldName, const std::string &egpName) const override;
+
+    virtual void genPopVariableInit(CodeStream &os,const Substitutions &kernelSubs, Handler handler) const override;
+
+    virtual void genVariablePush(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, bool autoInitialized, size_t count) const override;
+    virtual void genVariablePull(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, size_t count) const override;
+    virtual void genCurrentVariablePush(CodeStream &os, const NeuronGroupInternal &ng, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual void genCurrentVariablePull(CodeStream &os, const NeuronGroupInternal &ng, const std::string &type, const std::string &name, VarLocation loc) const override;
+
+    virtual void genCurrentTrueSpikePush(CodeStream &os, const NeuronGroupInternal &ng) const override;
+    virtual void genCurrentTrueSpikePull(CodeStream &os, const NeuronGroupInternal &ng) const override;
+    virtual void genCurrentSpikeLikeEventPush(CodeStream &os, const NeuronGroupInternal &ng) const override;
+    virtual void genCurrentSpikeLikeEventPull(CodeStream &os, const NeuronGroupInternal &ng) const override;
+
+    virtual MemAlloc genGlobalRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free) const override;
+    virtual MemAlloc genPopulationRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
+                                      const std::string &name, size_t count) const override;
+    virtual void genTimer(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
+                          CodeStream &stepTimeFinalise, const std::string &name, bool updateInStepTime) const override;
+
+    //! Generate code to return amount of free 'device' memory in bytes
+    virtual void genReturnFreeDeviceMemoryBytes(CodeStream &os) const override;
+
+    virtual void genMakefilePreamble(std::ostream &os) const override;
+    virtual void genMakefileLinkRule(std::ostream &os) const override;
+    virtual void genMakefileCompileRule(std::ostream &os) const override;
+
+    virtual void genMSBuildConfigProperties(std::ostream &os) const override;
+    virtual void genMSBuildImportProps(std::ostream &os) const override;
+    virtual void genMSBuildItemDefinitions(std::ostream &os) const override;
+    virtual void genMSBuildCompileModule(const std::string &moduleName, std::ostream &os) const override;
+    virtual void genMSBuildImportTarget(std::ostream &os) const override;
+
+    virtual bool isGlobalRNGRequired(const ModelSpecMerged &modelMerged) const override;
+    virtual bool isPopulationRNGRequired() const override { return false; }
+    virtual bool isSynRemapRequired() const override{ return false; }
+    virtual bool isPostsynapticRemapRequired() const override{ return true; }
+    virtual bool isSparseMatrixMappingSupported() const override{ return true; }
+
+    //! Is automatic copy mode enabled in the preferences?
+    virtual bool isAutomaticCopyEnabled() const override { return m_CPUPreferences.automaticCopy; }
+
+    //! How many bytes of memory does 'device' have
+    virtual size_t getDeviceMemoryBytes() const override{ return 0; }
+
+    //! Get directory in which to cache compiled modules (empty if build cache is disabled)
+    virtual std::string getBuildCacheDirectory() const override{ return m_CPUPreferences.buildCacheDirectory; }
+
+    //! Get shell command which prints the version and target of the compiler used by the generated Makefile
+    /*! **NOTE** like make, this falls back to g++ if CXX isn't set */
+    virtual std::string getCompilerIdentityCommand() const override{ return "${CXX:-g++} --version && ${CXX:-g++} -dumpmachine"; }
+
+    //! Should constant sub-expressions in neuron and synapse code be folded?
+    virtual bool isConstantFoldingEnabled() const override{ return m_CPUPreferences.foldConstantExpressions; }
+
+    //! Get directory in which to cache sparse connectivity (empty if connectivity cache is disabled)
+    virtual std::string getConnectivityCacheDirectory() const override{ return m_CPUPreferences.connectivityCacheDirectory; }
+
+protected:
+    //--------------------------------------------------------------------------
+    // CodeGenerator::BackendCPU::Timer
+    //--------------------------------------------------------------------------
+    //! Generates code to time the code generated during its lifetime
+    class Timer
+    {
+    public:
+        Timer(CodeStream &codeStream, const std::string &name, bool timingEnabled)
+        :   m_CodeStream(codeStream), m_Name(name), m_TimingEnabled(timingEnabled)
+        {
+            // Record start event
+            if(m_TimingEnabled) {
+                m_CodeStream << "const auto " << m_Name << "Start = std::chrono::high_resolution_clock::now();" << std::endl;
+            }
+        }
+
+        ~Timer()
+        {
+            // Record stop event
+            if(m_TimingEnabled) {
+                m_CodeStream << m_Name << "Time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - " << m_Name << "Start).count();" << std::endl;
+            }
+        }
+
+    private:
+        //--------------------------------------------------------------------------
+        // Members
+        //--------------------------------------------------------------------------
+        CodeStream &m_CodeStream;
+        const std::string m_Name;
+        const bool m_TimingEnabled;
+    };
+
+    //--------------------------------------------------------------------------
+    // Protected API
+    //--------------------------------------------------------------------------
+    //! Does generated code use OpenMP i.e. does it need to be compiled and linked with OpenMP support?
+    virtual bool isOpenMPRequired() const{ return false; }
+
+    //! Generate presynaptic update code where each presynaptic spike (or spike-like event) is processed by iterating through its row of synapses
+    /*! If parallel is set, spikes are processed in parallel using OpenMP and input to postsynaptic neurons is accumulated atomically */
+    void genRowPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const SynapseGroupMerged &sg, const Substitutions &popSubs,
+                                 bool trueSpike, bool parallel, SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
+                                 SynapseGroupMergedHandler wumProceduralConnectHandler) const;
+
+    //! Are synapse group's synapse dynamics a weighted sum i.e. DENSE connectivity and a single side-effect free addToInSyn?
+    bool isSynapseDynamicsWeightedSum(const SynapseGroupInternal &sg) const;
+
+    //! Generate synapse dynamics code which calculates the weighted sum of synapse group's input to postsynaptic neurons between postBegin and postEnd
+    /*! Each block of postsynaptic neurons is accumulated over all rows in a local array, which stays in cache, before being added to inSyn */
+    void genWeightedSumSynapseDynamics(CodeStream &os, const SynapseGroupMerged &sg, const Substitutions &popSubs,
+                                       const std::string &postBegin, const std::string &postEnd,
+                                       SynapseGroupMergedHandler synapseDynamicsHandler) const;
+
+    //! Generate code for a merged group inline or, if merged groups are split into separate modules, into a function in its own module and call it
+    void genMergedGroup(CodeStream &os, ModuleHandler moduleHandler, const std::string &suffix, size_t idx, size_t numGroups,
+                        const std::string &params, const std::string &args, HostHandler handler) const;
+
+    //! Is a counter-based Philox RNG required for procedural connectivity or neuron simulation?
+    bool isPhiloxRNGRequired(const ModelSpecMerged &modelMerged) const;
+
+    //! Are rows of synapse group's sparse connectivity built using per-row counter-based Philox RNG streams?
+    bool isConnectivityInitPhiloxRNGRequired(const SynapseGroupInternal &sg) const;
+
+    //! Are rows of synapse group's sparse variables initialised using per-row counter-based Philox RNG streams?
+    bool isSparseInitPhiloxRNGRequired(const SynapseGroupInternal &sg) const;
+
+    //! Can the connectivity built for synapse group be cached i.e. is it fully determined by the model description?
+    bool isConnectivityCacheable(const ModelSpecInternal &model, const SynapseGroupInternal &sg) const;
+
+    //! Generate table of files to cache the connectivity of each group in merged synapse group in
+    void genConnectivityCacheFiles(CodeStream &os, const ModelSpecInternal &model, const SynapseGroupMerged &sg) const;
+
+    //! Generate code to read connectivity from cache, skipping to next group if it is successfully read
+    void genReadConnectivityCache(CodeStream &os, const SynapseGroupMerged &sg) const;
+
+    //! Generate code to write connectivity to cache
+    void genWriteConnectivityCache(CodeStream &os, const SynapseGroupMerged &sg) const;
+
+    //! If counter-based RNGs are enabled and merged neuron group requires a simulation RNG, generate table of streams to use for each group (and batch instance)
+    void genNeuronRNGStreams(CodeStream &os, const ModelSpecInternal &model, const NeuronGroupMerged &ng) const;
+
+    //! If merged neuron group requires a simulation RNG, add it to substitutions
+    void addNeuronSimRNGSubstitution(CodeStream &os, const NeuronGroupMerged &ng, Substitutions &popSubs, const std::string &ftype) const;
+
+    //! Get cast required to calculate synapse indices of merged group without overflow (empty if 32-bit indices suffice)
+    std::string getSynapseIndexCast(const SynapseGroupMerged &sg) const;
+
+    //--------------------------------------------------------------------------
+    // Static API
+    //--------------------------------------------------------------------------
+    //! Get functions used with the global host RNG
+    static const std::vector<FunctionTemplate> &getCPUFunctions();
+
+    //! Add functions used with counter-based Philox RNGs to substitutions
+    static void addCounterBasedRNGFunctionSubstitutions(Substitutions &subs, const std::string &ftype);
+
+    //! Does synapse group require an RNG to generate procedural connectivity or weights?
+    static bool isProceduralRNGRequired(const SynapseGroupInternal &sg);
+
+    //! Do any synapse groups in model require an RNG to generate procedural connectivity or weights?
+    static bool isProceduralRNGRequired(const ModelSpecInternal &model);
+
+    //! Get index of neuron group within model, which doesn't depend on how groups are merged
+    static size_t getNeuronGroupIndex(const ModelSpecInternal &model, const NeuronGroupInternal &ng);
+
+    //! Get index of synapse group within model, which doesn't depend on how groups are merged
+    static size_t getSynapseGroupIndex(const ModelSpecInternal &model, const SynapseGroupInternal &sg);
+
+    //! Generate table of counter-based RNG streams to use for each group (and batch instance) of merged synapse group
+    static void genSynapseRNGStreams(CodeStream &os, const std::string &name, const ModelSpecInternal &model,
+                                     const SynapseGroupMerged &sg, unsigned int batchSize);
+
+private:
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+    //! Get digest identifying the connectivity which will be built for synapse group, used to name its connectivity cache file
+    size_t getConnectivityCacheHashDigest(const ModelSpecInternal &model, const SynapseGroupInternal &sg) const;
+
+    //--------------------------------------------------------------------------
+    // Members
+    //--------------------------------------------------------------------------
+    //! Preferences shared by all CPU backends
+    const PreferencesCPU m_CPUPreferences;
+};
+}   // namespace CodeGenerator
@@ -78,12 +78,12 @@ typedef std::map<std::string, std::unordered_multimap<std::string, MergedEGP>> M
 void substitute(std::string &s, const std::string &trg, const std::string &rep);
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting variable  names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting variable names in the neuron code strings or other templates (trg must be an identifier)
 //--------------------------------------------------------------------------
 bool regexVarSubstitute(std::string &s, const std::string &trg, const std::string &rep);
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting function names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting function names in the neuron code strings or other templates
 //--------------------------------------------------------------------------
 bool regexFuncSubstitute(std::string &s, const std::string &trg, const std::string &rep);
 
@@ -115,9 +115,18 @@ inline size_t padSize(size_t size, size_t blockSize)
 
 GENN_EXPORT void genMergedGroupSpikeCountReset(CodeStream &os, const NeuronGroupMerged &n);
 
+//! Generate a host implementation of the counter-based Philox4x32-10 random number generator
+/*! The generated PhiloxRNG class models the standard UniformRandomBitGenerator concept so it
+    can be passed to standard library distributions. Each instance is keyed by two 32-bit
+    words and three counter words so, unlike std::mt19937, independent streams can be
+    created cheaply and repeatably e.g. one for each row of a procedural connectivity matrix. */
+GENN_EXPORT void genHostPhiloxRNG(CodeStream &os);
+
+//! Generate arrays to hold merged group structures and functions to push them
+/*! If batchSize is greater than one, arrays hold one structure for each batch instance of each group */
 template<typename T>
 void genMergedGroupPush(CodeStream &os, const std::vector<T> &groups, const MergedEGPMap &mergedEGPs,
-                        const std::string &suffix, const BackendBase &backend)
+                        const std::string &suffix, const BackendBase &backend, unsigned int batchSize = 1)
 {
     // Loop through merged neuron groups
     std::stringstream mergedGroupArrayStream;
@@ -128,7 +137,7 @@ void genMergedGroupPush(CodeStream &os, const std::vector<T> &groups, const Merg
     for(const auto &g : groups) {
         // Declare static array to hold merged neuron groups
         const size_t idx = g.getIndex();
-        const size_t numGroups = g.getGroups().size();
+        const size_t numGroups = g.getGroups().size() * batchSize;
 
         // Implement merged group array
         backend.genMergedGroupImplementation(mergedGroupArray, suffix, idx, numGroups);
@@ -178,6 +187,12 @@ void genScalarEGPPush(CodeStream &os, const MergedEGPMap &mergedEGPs, const std:
 //--------------------------------------------------------------------------
 std::string ensureFtype(const std::string &oldcode, const std::string &type);
 
+//--------------------------------------------------------------------------
+/*! \brief Is name a single or double precision standard C maths function?
+ */
+//--------------------------------------------------------------------------
+bool isMathsFunction(const std::string &name);
+
 
 //--------------------------------------------------------------------------
 /*! \brief This function checks for unknown variable definitions and returns a gennError if any are found
@@ -0,0 +1,138 @@
+#pragma once
+
+// Standard C++ includes
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// GeNN includes
+#include "gennExport.h"
+
+//----------------------------------------------------------------------------
+// CodeGenerator::ExpressionParser
+//----------------------------------------------------------------------------
+//! Lightweight parser for the C-like expressions found in user code strings
+/*! Rather than attempting to parse complete C statements, code is split into tokens and an expression
+    is parsed (using precedence climbing) from each position where one can begin e.g. after a ';', '='
+    or '('. Each expression which parses cleanly is turned into an AST which can be analysed and
+    transformed, with any changes spliced back into the original code so everything else is left untouched. */
+namespace CodeGenerator
+{
+namespace ExpressionParser
+{
+//----------------------------------------------------------------------------
+// CodeGenerator::ExpressionParser::Token
+//----------------------------------------------------------------------------
+struct Token
+{
+    enum class Type
+    {
+        Identifier,
+        Number,
+        String,     //!< String or character literal
+        Punctuator,
+    };
+
+    Type type;
+
+    //! Text of token
+    std::string text;
+
+    //! Range of characters [begin, end) this token occupies in the code
+    size_t begin;
+    size_t end;
+};
+
+//----------------------------------------------------------------------------
+// CodeGenerator::ExpressionParser::Constant
+//----------------------------------------------------------------------------
+//! Value of constant expression, typed following the C rules for literals
+struct Constant
+{
+    enum class Type
+    {
+        Int,
+        Float,
+        Double,
+    };
+
+    Type type;
+    int64_t intValue;
+    double floatValue;   //!< Value of Float and Double constants (Float constants are always exactly representable as float)
+};
+
+//----------------------------------------------------------------------------
+// CodeGenerator::ExpressionParser::Node
+//----------------------------------------------------------------------------
+//! Node of expression AST
+struct Node
+{
+    enum class Type
+    {
+        Literal,        //!< Numeric literal
+        Opaque,         //!< Identifier, GeNN variable reference e.g. $(V), string literal or numeric literal of a type we don't evaluate
+        Paren,          //!< Bracketed sub-expression
+        Unary,          //!< Prefix operator applied to child 0
+        Postfix,        //!< Postfix increment or decrement of child 0
+        Binary,         //!< Binary operator applied to child 0 and child 1
+        Ternary,        //!< Conditional operator with condition child 0 and branches 1 and 2
+        Call,           //!< Function call, function substitution, subscript or member access of child 0 with arguments in remaining children
+    };
+
+    Type type;
+
+    //! Operator for Unary, Postfix, Binary and Call nodes ("(", "[", "." or "->" for Call or "$(" for function substitutions)
+    std::string op;
+
+    //! Range of characters [begin, end) this node occupies in the code
+    size_t begin;
+    size_t end;
+
+    std::vector<std::unique_ptr<Node>> children;
+
+    //! If this node is a Literal, its value
+    Constant value;
+};
+
+//----------------------------------------------------------------------------
+// Free functions
+//----------------------------------------------------------------------------
+//! Split code into tokens, skipping whitespace and comments
+GENN_EXPORT std::vector<Token> tokenise(const std::string &code);
+
+//! Parse a single expression starting at token index pos.
+/*! If an expression is found which is followed by the end of the code or a token which can
+    legitimately terminate an expression (e.g. ';', ')' or '='), its AST is returned and pos is advanced
+    to the terminating token. Otherwise, nullptr is returned and pos is left unchanged */
+GENN_EXPORT std::unique_ptr<Node> parseExpression(const std::vector<Token> &tokens, size_t &pos);
+
+//! Parse code consisting of a single statement which calls the function substitution $(name, ...)
+/*! For example, if code is "$(addToInSyn, $(g) * $(V_pre));" and name is "addToInSyn", the Call node is returned with
+    the name as child 0 and the arguments as the remaining children. Otherwise, nullptr is returned */
+GENN_EXPORT std::unique_ptr<Node> parseFunctionSubstitutionStatement(const std::string &code, const std::string &name);
+
+//! Might evaluating node in code modify any state?
+/*! Increments, decrements, taking addresses, random number generation, function substitutions
+    and calls to anything other than standard maths functions are all assumed to have side-effects */
+GENN_EXPORT bool hasSideEffects(const Node &node, const std::string &code);
+
+//! Evaluate node if it only involves literals, returning true and setting value if it could be evaluated
+/*! Evaluation follows C's usual arithmetic conversions so, for example, 1 / 2 evaluates to
+    an Int 0 and 1.0f / 3.0f is evaluated in single precision */
+GENN_EXPORT bool evaluate(const Node &node, Constant &value);
+
+//! Parse all expressions in code and replace any sub-expression that only involves literals with its value
+/*! For example, after parameter substitution "$(V) += (1.0f) * (2.0f) / (4.0f)" is folded to
+    "$(V) += (5.000000000e-01f)". Expressions which don't parse and everything else in the code are left untouched */
+GENN_EXPORT std::string foldConstants(const std::string &code);
+
+//! Replace if statements whose conditions only involve literals with whichever of their branches is taken
+/*! For example, "if((0)) { $(V) = 0.0f; } else { $(V) += 1.0f; }" becomes "{ $(V) += 1.0f; }". Braces are kept so
+    the scope of variables declared in the branch is unchanged and if statements whose extent can't be found are left untouched */
+GENN_EXPORT std::string removeDeadBranches(const std::string &code);
+
+//! Fold constants in code and then remove any branches which this makes dead
+GENN_EXPORT std::string simplify(const std::string &code);
+}   // namespace ExpressionParser
+}   // namespace CodeGenerator
@@ -35,6 +35,7 @@ public:
     // Typedefines
     //------------------------------------------------------------------------
     typedef std::function<std::string(const typename T::GroupInternal &, size_t)> GetFieldValueFunc;
+    typedef std::function<size_t(const typename T::GroupInternal &, size_t)> GetFieldBatchStrideFunc;
 
     MergedStructGenerator(const T &mergedGroup) : m_MergedGroup(mergedGroup)
     {
@@ -45,7 +46,15 @@ public:
     //------------------------------------------------------------------------
     void addField(const std::string &type, const std::string &name, GetFieldValueFunc getFieldValue, FieldType fieldType = FieldType::Standard)
     {
-        m_Fields.emplace_back(type, name, getFieldValue, fieldType);
+        m_Fields.emplace_back(type, name, getFieldValue, fieldType, GetFieldBatchStrideFunc());
+    }
+
+    //! Add pointer field to an array containing one copy of the pointed-to data for each instance in a batch
+    /*! In each batch instance's copy of the structure, the field is offset by the number of elements returned by getBatchStride */
+    void addBatchedField(const std::string &type, const std::string &name, GetFieldValueFunc getFieldValue, GetFieldBatchStrideFunc getBatchStride)
+    {
+        assert(Utils::isTypePointer(type));
+        m_Fields.emplace_back(type, name, getFieldValue, FieldType::Standard, getBatchStride);
     }
 
     void addPointerField(const std::string &type, const std::string &name, const std::string &prefix)
@@ -54,6 +63,12 @@ public:
         addField(type + "*", name, [prefix](const typename T::GroupInternal &g, size_t){ return prefix + g.getName(); });
     }
 
+    void addBatchedPointerField(const std::string &type, const std::string &name, const std::string &prefix, GetFieldBatchStrideFunc getBatchStride)
+    {
+        assert(!Utils::isTypePointer(type));
+        addBatchedField(type + "*", name, [prefix](const typename T::GroupInternal &g, size_t){ return prefix + g.getName(); }, getBatchStride);
+    }
+
     void addVars(const std::vector<Models::Base::Var> &vars, const std::string &prefix)
     {
         for(const auto &v : vars) {
@@ -61,6 +76,13 @@ public:
         }
     }
 
+    void addBatchedVars(const std::vector<Models::Base::Var> &vars, const std::string &prefix, GetFieldBatchStrideFunc getBatchStride)
+    {
+        for(const auto &v : vars) {
+            addBatchedPointerField(v.type, v.name, prefix + v.name, getBatchStride);
+        }
+    }
+
     void addEGPs(const std::vector<Snippet::Base::EGP> &egps)
     {
         for(const auto &e : egps) {
@@ -70,8 +92,25 @@ public:
         }
     }
 
+    void addDynamicParams(const std::vector<std::string> &paramNames, const std::vector<bool> &dynamic)
+    {
+        // **NOTE** dynamic parameters are copied into merged structures in the same way as scalar EGPs
+        for(size_t i = 0; i < paramNames.size(); i++) {
+            if(dynamic[i]) {
+                const std::string paramName = paramNames[i];
+                addField("scalar", paramName,
+                         [paramName](const typename T::GroupInternal &g, size_t){ return paramName + g.getName(); },
+                         FieldType::ScalarEGP);
+            }
+        }
+    }
+
+    //! Generate structure definition and instantiate array of structures
+    /*! If batchSize is greater than one, batchSize consecutive copies of each group's structure are instantiated with
+        batched fields offset to point to the corresponding batch instance's data and all other fields shared */
     void generate(CodeGenerator::CodeStream &definitionsInternal, CodeGenerator::CodeStream &definitionsInternalFunc,
-                  CodeGenerator::CodeStream &runnerVarAlloc, CodeGenerator::MergedEGPMap &mergedEGPs, const std::string &name)
+                  CodeGenerator::CodeStream &runnerVarAlloc, CodeGenerator::MergedEGPMap &mergedEGPs, const std::string &name,
+                  unsigned int batchSize = 1)
     {
         const size_t index = getMergedGroup().getIndex();
 
@@ -97,20 +136,30 @@ public:
                 for(size_t i = 0; i < getMergedGroup().getGroups().size(); i++) {
                     const auto &g = getMergedGroup().getGroups()[i];
 
-                    // Add all fields to merged group array
-                    runnerVarAlloc << "{";
-                    for(const auto &f : m_Fields) {
-                        const std::string fieldInitVal = std::get<2>(f)(g, i);
-                        runnerVarAlloc << fieldInitVal << ", ";
-
-                        // If field is an EGP, add record to merged EGPS
-                        if(std::get<3>(f) != FieldType::Standard) {
-                            mergedEGPs[fieldInitVal].emplace(
-                                std::piecewise_construct, std::forward_as_tuple(name),
-                                std::forward_as_tuple(index, i, (std::get<3>(f) == FieldType::PointerEGP), std::get<1>(f)));
+                    // Loop through batch instances
+                    for(unsigned int b = 0; b < batchSize; b++) {
+                        // Add all fields to merged group array
+                        runnerVarAlloc << "{";
+                        for(const auto &f : m_Fields) {
+                            const std::string fieldInitVal = std::get<2>(f)(g, i);
+
+                            // If field is batched, offset it to point to this batch instance
+                            if(std::get<4>(f) && b > 0) {
+                                runnerVarAlloc << fieldInitVal << " + " << (b * std::get<4>(f)(g, i)) << ", ";
+                            }
+                            else {
+                                runnerVarAlloc << fieldInitVal << ", ";
+                            }
+
+                            // If field is an EGP, add record to merged EGPS
+                            if(std::get<3>(f) != FieldType::Standard) {
+                                mergedEGPs[fieldInitVal].emplace(
+                                    std::piecewise_construct, std::forward_as_tuple(name),
+                                    std::forward_as_tuple(index, (i * batchSize) + b, (std::get<3>(f) == FieldType::PointerEGP), std::get<1>(f)));
+                            }
                         }
+                        runnerVarAlloc << "}," << std::endl;
                     }
-                    runnerVarAlloc << "}," << std::endl;
                 }
             }
             runnerVarAlloc << ";" << std::endl;
@@ -133,7 +182,7 @@ private:
     // Members
     //------------------------------------------------------------------------
     const T &m_MergedGroup;
-    std::vector<std::tuple<std::string, std::string, GetFieldValueFunc, FieldType>> m_Fields;
+    std::vector<std::tuple<std::string, std::string, GetFieldValueFunc, FieldType, GetFieldBatchStrideFunc>> m_Fields;
 };
 
 //--------------------------------------------------------------------------
@@ -151,37 +200,94 @@ public:
     // Public API
     //------------------------------------------------------------------------
     void addMergedInSynPointerField(const std::string &type, const std::string &name, size_t archetypeIndex, const std::string &prefix,
-                                    const std::vector<std::vector<std::pair<SynapseGroupInternal*, std::vector<SynapseGroupInternal*>>>> &sortedMergedInSyns)
+                                    const std::vector<std::vector<std::pair<SynapseGroupInternal*, std::vector<SynapseGroupInternal*>>>> &sortedMergedInSyns,
+                                    GetFieldBatchStrideFunc getBatchStride)
     {
         assert(!Utils::isTypePointer(type));
-        addField(type + "*", name + std::to_string(archetypeIndex),
-                 [prefix, &sortedMergedInSyns, archetypeIndex](const NeuronGroupInternal&, size_t groupIndex)
-                 {
-                     return prefix + sortedMergedInSyns.at(groupIndex).at(archetypeIndex).first->getPSModelTargetName();
-                 });
+        addBatchedField(type + "*", name + std::to_string(archetypeIndex),
+                        [prefix, &sortedMergedInSyns, archetypeIndex](const NeuronGroupInternal&, size_t groupIndex)
+                        {
+                            return prefix + sortedMergedInSyns.at(groupIndex).at(archetypeIndex).first->getPSModelTargetName();
+                        },
+                        getBatchStride);
     }
 
     void addCurrentSourcePointerField(const std::string &type, const std::string &name, size_t archetypeIndex, const std::string &prefix,
-                                      const std::vector<std::vector<CurrentSourceInternal*>> &sortedCurrentSources)
+                                      const std::vector<std::vector<CurrentSourceInternal*>> &sortedCurrentSources,
+                                      GetFieldBatchStrideFunc getBatchStride)
     {
         assert(!Utils::isTypePointer(type));
-        addField(type + "*", name + std::to_string(archetypeIndex),
-                 [prefix, &sortedCurrentSources, archetypeIndex](const NeuronGroupInternal&, size_t groupIndex)
-                 {
-                     return prefix + sortedCurrentSources.at(groupIndex).at(archetypeIndex)->getName();
-                 });
+        addBatchedField(type + "*", name + std::to_string(archetypeIndex),
+                        [prefix, &sortedCurrentSources, archetypeIndex](const NeuronGroupInternal&, size_t groupIndex)
+                        {
+                            return prefix + sortedCurrentSources.at(groupIndex).at(archetypeIndex)->getName();
+                        },
+                        getBatchStride);
     }
 
     void addSynPointerField(const std::string &type, const std::string &name, size_t archetypeIndex, const std::string &prefix,
-                            const std::vector<std::vector<SynapseGroupInternal*>> &sortedSyn)
+                            const std::vector<std::vector<SynapseGroupInternal*>> &sortedSyn,
+                            GetFieldBatchStrideFunc getBatchStride)
     {
         assert(!Utils::isTypePointer(type));
-        addField(type + "*", name + std::to_string(archetypeIndex),
-                 [prefix, &sortedSyn, archetypeIndex](const NeuronGroupInternal&, size_t groupIndex)
-                 {
-                     return prefix + sortedSyn.at(groupIndex).at(archetypeIndex)->getName();
-                 });
+        addBatchedField(type + "*", name + std::to_string(archetypeIndex),
+                        [prefix, &sortedSyn, archetypeIndex](const NeuronGroupInternal&, size_t groupIndex)
+                        {
+                            return prefix + sortedSyn.at(groupIndex).at(archetypeIndex)->getName();
+                        },
+                        getBatchStride);
+
+    }
+
+    void addMergedInSynDynamicParams(const std::vector<std::string> &paramNames, const std::vector<bool> &dynamic,
+                                     const std::string &suffix, size_t archetypeIndex,
+                                     const std::vector<std::vector<std::pair<SynapseGroupInternal*, std::vector<SynapseGroupInternal*>>>> &sortedMergedInSyns)
+    {
+        for(size_t i = 0; i < paramNames.size(); i++) {
+            if(dynamic[i]) {
+                const std::string paramName = paramNames[i];
+                addField("scalar", paramName + suffix + std::to_string(archetypeIndex),
+                         [paramName, &sortedMergedInSyns, archetypeIndex](const NeuronGroupInternal&, size_t groupIndex)
+                         {
+                             return paramName + sortedMergedInSyns.at(groupIndex).at(archetypeIndex).first->getName();
+                         },
+                         FieldType::ScalarEGP);
+            }
+        }
+    }
+
+    void addCurrentSourceDynamicParams(const std::vector<std::string> &paramNames, const std::vector<bool> &dynamic,
+                                       const std::string &suffix, size_t archetypeIndex,
+                                       const std::vector<std::vector<CurrentSourceInternal*>> &sortedCurrentSources)
+    {
+        for(size_t i = 0; i < paramNames.size(); i++) {
+            if(dynamic[i]) {
+                const std::string paramName = paramNames[i];
+                addField("scalar", paramName + suffix + std::to_string(archetypeIndex),
+                         [paramName, &sortedCurrentSources, archetypeIndex](const NeuronGroupInternal&, size_t groupIndex)
+                         {
+                             return paramName + sortedCurrentSources.at(groupIndex).at(archetypeIndex)->getName();
+                         },
+                         FieldType::ScalarEGP);
+            }
+        }
+    }
 
+    void addSynDynamicParams(const std::vector<std::string> &paramNames, const std::vector<bool> &dynamic,
+                             const std::string &suffix, size_t archetypeIndex,
+                             const std::vector<std::vector<SynapseGroupInternal*>> &sortedSyn)
+    {
+        for(size_t i = 0; i < paramNames.size(); i++) {
+            if(dynamic[i]) {
+                const std::string paramName = paramNames[i];
+                addField("scalar", paramName + suffix + std::to_string(archetypeIndex),
+                         [paramName, &sortedSyn, archetypeIndex](const NeuronGroupInternal&, size_t groupIndex)
+                         {
+                             return paramName + sortedSyn.at(groupIndex).at(archetypeIndex)->getName();
+                         },
+                         FieldType::ScalarEGP);
+            }
+        }
     }
 };
 //--------------------------------------------------------------------------
@@ -198,22 +304,25 @@ public:
     //------------------------------------------------------------------------
     // Public API
     //------------------------------------------------------------------------
-    void addPSPointerField(const std::string &type, const std::string &name, const std::string &prefix)
+    void addPSPointerField(const std::string &type, const std::string &name, const std::string &prefix, GetFieldBatchStrideFunc getBatchStride)
     {
         assert(!Utils::isTypePointer(type));
-        addField(type + "*", name, [prefix](const SynapseGroupInternal &sg, size_t){ return prefix + sg.getPSModelTargetName(); });
+        addBatchedField(type + "*", name, [prefix](const SynapseGroupInternal &sg, size_t){ return prefix + sg.getPSModelTargetName(); },
+                        getBatchStride);
     }
 
-    void addSrcPointerField(const std::string &type, const std::string &name, const std::string &prefix)
+    void addSrcPointerField(const std::string &type, const std::string &name, const std::string &prefix, GetFieldBatchStrideFunc getBatchStride)
     {
         assert(!Utils::isTypePointer(type));
-        addField(type + "*", name, [prefix](const SynapseGroupInternal &sg, size_t){ return prefix + sg.getSrcNeuronGroup()->getName(); });
+        addBatchedField(type + "*", name, [prefix](const SynapseGroupInternal &sg, size_t){ return prefix + sg.getSrcNeuronGroup()->getName(); },
+                        getBatchStride);
     }
 
-    void addTrgPointerField(const std::string &type, const std::string &name, const std::string &prefix)
+    void addTrgPointerField(const std::string &type, const std::string &name, const std::string &prefix, GetFieldBatchStrideFunc getBatchStride)
     {
         assert(!Utils::isTypePointer(type));
-        addField(type + "*", name, [prefix](const SynapseGroupInternal &sg, size_t){ return prefix + sg.getTrgNeuronGroup()->getName(); });
+        addBatchedField(type + "*", name, [prefix](const SynapseGroupInternal &sg, size_t){ return prefix + sg.getTrgNeuronGroup()->getName(); },
+                        getBatchStride);
     }
 
     void addSrcEGPField(const Snippet::Base::EGP &egp)
@@ -230,6 +339,20 @@ public:
                  Utils::isTypePointer(egp.type) ? FieldType::PointerEGP : FieldType::ScalarEGP);
     }
 
+    void addSrcDynamicParamField(const std::string &paramName)
+    {
+        addField("scalar", paramName + "Pre",
+                 [paramName](const SynapseGroupInternal &sg, size_t){ return paramName + sg.getSrcNeuronGroup()->getName(); },
+                 FieldType::ScalarEGP);
+    }
+
+    void addTrgDynamicParamField(const std::string &paramName)
+    {
+        addField("scalar", paramName + "Post",
+                 [paramName](const SynapseGroupInternal &sg, size_t){ return paramName + sg.getTrgNeuronGroup()->getName(); },
+                 FieldType::ScalarEGP);
+    }
+
 };
 
 }   // namespace CodeGenerator
@@ -4,6 +4,7 @@
 #include <map>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 
 // Standard C includes
 #include <cassert>
@@ -93,6 +94,27 @@ public:
 
     }
 
+    void addParamValueSubstitution(const std::vector<std::string> &paramNames, const std::vector<double> &values,
+                                   const std::vector<bool> &dynamic, const std::string &sourceSuffix = "",
+                                   const std::string &dynamicDestPrefix = "group.", const std::string &dynamicDestSuffix = "")
+    {
+        if(paramNames.size() != values.size() || paramNames.size() != dynamic.size()) {
+            throw std::runtime_error("Number of parameters does not match number of values");
+        }
+
+        // Substitute dynamic parameters for merged structure fields and all others for their values
+        for(size_t i = 0; i < paramNames.size(); i++) {
+            if(dynamic[i]) {
+                addVarSubstitution(paramNames[i] + sourceSuffix,
+                                   dynamicDestPrefix + paramNames[i] + dynamicDestSuffix);
+            }
+            else {
+                addVarSubstitution(paramNames[i] + sourceSuffix,
+                                   "(" + Utils::writePreciseString(values[i]) + ")");
+            }
+        }
+    }
+
     void addVarSubstitution(const std::string &source, const std::string &destionation, bool allowOverride = false)
     {
         auto res = m_VarSubstitutions.emplace(source, destionation);
@@ -171,10 +193,22 @@ private:
 
     void applyVars(std::string &code) const
     {
-        // Apply variable substitutions
-        for(const auto &v : m_VarSubstitutions) {
-            LOGD_CODE_GEN << "Substituting '$(" << v.first << ")' for '" << v.second << "'";
-            substitute(code, "$(" + v.first + ")", v.second);
+        // Scan code for $(name) tokens and look up each one in variable substitutions
+        // **NOTE** scanning resumes at the start of each replacement so it may itself contain tokens
+        for(size_t found = code.find("$("); found != std::string::npos; found = code.find("$(", found)) {
+            const size_t close = code.find(')', found + 2);
+            if(close == std::string::npos) {
+                break;
+            }
+
+            const auto var = m_VarSubstitutions.find(code.substr(found + 2, close - found - 2));
+            if(var != m_VarSubstitutions.cend()) {
+                LOGD_CODE_GEN << "Substituting '$(" << var->first << ")' for '" << var->second << "'";
+                code.replace(found, close - found + 1, var->second);
+            }
+            else {
+                found += 2;
+            }
         }
 
         // If we have a parent, apply their variable substitutions too
@@ -186,7 +220,7 @@ private:
     //--------------------------------------------------------------------------
     // Members
     //--------------------------------------------------------------------------
-    std::map<std::string, std::string> m_VarSubstitutions;
+    std::unordered_map<std::string, std::string> m_VarSubstitutions;
     std::map<std::string, std::pair<unsigned int, std::string>> m_FuncSubstitutions;
     const Substitutions *m_Parent;
 };
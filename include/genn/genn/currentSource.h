@@ -31,6 +31,12 @@ public:
         and only applies to extra global parameters which are pointers. */
     void setExtraGlobalParamLocation(const std::string &paramName, VarLocation loc);
 
+    //! Set whether current source model parameter is dynamic
+    /*! Rather than being hard-coded into the generated code, dynamic parameters are stored in the
+        merged group structures and can be changed at runtime using a generated setter function.
+        Parameters used to calculate derived parameters cannot be dynamic. */
+    void setParamDynamic(const std::string &paramName, bool dynamic = true);
+
     //------------------------------------------------------------------------
     // Public const methods
     //------------------------------------------------------------------------
@@ -42,6 +48,9 @@ public:
     const std::vector<double> &getParams() const{ return m_Params; }
     const std::vector<Models::VarInit> &getVarInitialisers() const{ return m_VarInitialisers; }
 
+    //! Is current source model parameter dynamic i.e. can it be changed at runtime
+    bool isParamDynamic(size_t index) const{ return m_DynamicParams.at(index); }
+
     //! Get variable location for current source model state variable
     VarLocation getVarLocation(const std::string &varName) const;
 
@@ -62,7 +71,8 @@ protected:
                   VarLocation defaultVarLocation, VarLocation defaultExtraGlobalParamLocation)
     :   m_Name(name), m_CurrentSourceModel(currentSourceModel), m_Params(params), m_VarInitialisers(varInitialisers),
         m_VarLocation(varInitialisers.size(), defaultVarLocation),
-        m_ExtraGlobalParamLocation(currentSourceModel->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation)
+        m_ExtraGlobalParamLocation(currentSourceModel->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation),
+        m_DynamicParams(params.size(), false)
     {
     }
 
@@ -76,6 +86,8 @@ protected:
     //------------------------------------------------------------------------
     const std::vector<double> &getDerivedParams() const{ return m_DerivedParams; }
 
+    const std::vector<bool> &getDynamicParams() const{ return m_DynamicParams; }
+
     //! Does this current source require an RNG to simulate
     bool isSimRNGRequired() const;
 
@@ -90,6 +102,14 @@ protected:
     /*! NOTE: this can only be called after model is finalized */
     bool canInitBeMerged(const CurrentSource &other) const;
 
+    //! Get hash digest used to find current sources which might be mergable with this one
+    /*! NOTE: this can only be called after model is finalized */
+    size_t getHashDigest() const;
+
+    //! Get hash digest used to find current sources whose initialisation might be mergable with this one
+    /*! NOTE: this can only be called after model is finalized */
+    size_t getInitHashDigest() const;
+
 private:
     //------------------------------------------------------------------------
     // Members
@@ -106,4 +126,7 @@ private:
 
     //! Location of extra global parameters
     std::vector<VarLocation> m_ExtraGlobalParamLocation;
+
+    //! Vector specifying which parameters are dynamic
+    std::vector<bool> m_DynamicParams;
 };
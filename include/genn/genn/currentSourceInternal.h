@@ -18,8 +18,11 @@ public:
 
     using CurrentSource::initDerivedParams;
     using CurrentSource::getDerivedParams;
+    using CurrentSource::getDynamicParams;
     using CurrentSource::isSimRNGRequired;
     using CurrentSource::isInitRNGRequired;
     using CurrentSource::canBeMerged;
     using CurrentSource::canInitBeMerged;
+    using CurrentSource::getHashDigest;
+    using CurrentSource::getInitHashDigest;
 };
@@ -37,6 +37,9 @@ public:
     //----------------------------------------------------------------------------
     //! Can this neuron model be merged with other? i.e. can they be simulated using same generated code
     bool canBeMerged(const Base *other) const;
+
+    //! Update hash digest with everything compared by canBeMerged
+    void updateHash(size_t &hash) const;
 };
 
 //----------------------------------------------------------------------------
@@ -101,8 +104,8 @@ class PoissonExp : public Base
     SET_PARAM_NAMES({"weight", "tauSyn", "rate"});
     SET_VARS({{"current", "scalar"}});
     SET_DERIVED_PARAMS({
-        {"ExpDecay", [](const std::vector<double> &pars, double dt){ return std::exp(-dt / pars[1]); }},
-        {"Init", [](const std::vector<double> &pars, double dt){ return pars[0] * (1.0 - std::exp(-dt / pars[1])) * (pars[1] / dt); }},
-        {"ExpMinusLambda", [](const std::vector<double> &pars, double dt){ return std::exp(-(pars[2] / 1000.0) * dt); }}});
+        {"ExpDecay", [](const std::vector<double> &pars, double dt){ return std::exp(-dt / pars[1]); }, {"tauSyn"}},
+        {"Init", [](const std::vector<double> &pars, double dt){ return pars[0] * (1.0 - std::exp(-dt / pars[1])) * (pars[1] / dt); }, {"weight", "tauSyn"}},
+        {"ExpMinusLambda", [](const std::vector<double> &pars, double dt){ return std::exp(-(pars[2] / 1000.0) * dt); }, {"rate"}}});
 };
 } // CurrentSourceModels
@@ -1,10 +1,12 @@
 #pragma once
 
 // Standard C++ includes
+#include <functional>
 #include <iomanip>
 #include <limits>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 // GeNN includes
@@ -15,6 +17,10 @@ namespace Models
 {
 class VarInit;
 }
+namespace Snippet
+{
+class Base;
+}
 
 //--------------------------------------------------------------------------
 // Utils
@@ -31,6 +37,98 @@ GENN_EXPORT bool isRNGRequired(const std::string &code);
 //--------------------------------------------------------------------------
 GENN_EXPORT bool isRNGRequired(const std::vector<Models::VarInit> &varInitialisers);
 
+//--------------------------------------------------------------------------
+//! \brief Are the values of all parameters which aren't dynamic equal?
+/*! Dynamic parameters are set at runtime so their values don't effect whether groups can be merged */
+//--------------------------------------------------------------------------
+GENN_EXPORT bool areNonDynamicParamsEqual(const std::vector<double> &params, const std::vector<double> &otherParams,
+                                          const std::vector<bool> &dynamicParams);
+
+//--------------------------------------------------------------------------
+//! \brief Combine the hash of a value with a running hash digest
+/*! Hash digests are used to quickly rule out groups which cannot be merged so,
+    whenever two values compare equal, they must always result in the same digest */
+//--------------------------------------------------------------------------
+inline void combineHash(size_t valueHash, size_t &hash)
+{
+    hash ^= valueHash + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+}
+
+//--------------------------------------------------------------------------
+//! \brief Update hash digest with integral value
+//--------------------------------------------------------------------------
+template<typename T, typename std::enable_if<std::is_integral<T>::value>::type * = nullptr>
+inline void updateHash(T value, size_t &hash)
+{
+    combineHash(std::hash<T>()(value), hash);
+}
+
+//--------------------------------------------------------------------------
+//! \brief Update hash digest with floating point value
+//--------------------------------------------------------------------------
+template<typename T, typename std::enable_if<std::is_floating_point<T>::value>::type * = nullptr>
+inline void updateHash(T value, size_t &hash)
+{
+    // **NOTE** 0.0 and -0.0 compare equal so must hash to the same value
+    combineHash(std::hash<T>()((value == 0.0) ? 0.0 : value), hash);
+}
+
+//--------------------------------------------------------------------------
+//! \brief Update hash digest with enumeration value
+//--------------------------------------------------------------------------
+template<typename T, typename std::enable_if<std::is_enum<T>::value>::type * = nullptr>
+inline void updateHash(T value, size_t &hash)
+{
+    updateHash(static_cast<typename std::underlying_type<T>::type>(value), hash);
+}
+
+//--------------------------------------------------------------------------
+//! \brief Update hash digest with string
+//--------------------------------------------------------------------------
+inline void updateHash(const std::string &value, size_t &hash)
+{
+    combineHash(std::hash<std::string>()(value), hash);
+}
+
+//--------------------------------------------------------------------------
+//! \brief Update hash digest with vector of booleans
+//--------------------------------------------------------------------------
+inline void updateHash(const std::vector<bool> &values, size_t &hash)
+{
+    combineHash(std::hash<std::vector<bool>>()(values), hash);
+}
+
+//--------------------------------------------------------------------------
+//! \brief Update hash digest with size and contents of vector
+//--------------------------------------------------------------------------
+template<typename T>
+inline void updateHash(const std::vector<T> &values, size_t &hash)
+{
+    updateHash(values.size(), hash);
+    for(const auto &v : values) {
+        updateHash(v, hash);
+    }
+}
+
+//--------------------------------------------------------------------------
+//! \brief Update hash digest with the values of all parameters which aren't dynamic
+/*! Counterpart to areNonDynamicParamsEqual - the values of dynamic parameters are not included in the digest */
+//--------------------------------------------------------------------------
+GENN_EXPORT void updateHashNonDynamicParams(const std::vector<double> &params, const std::vector<bool> &dynamicParams,
+                                            size_t &hash);
+
+//--------------------------------------------------------------------------
+//! \brief Get hash digest as a fixed-width hexadecimal string e.g. for use in filenames
+//--------------------------------------------------------------------------
+GENN_EXPORT std::string getHexDigest(size_t hash);
+
+//--------------------------------------------------------------------------
+//! \brief Is the parameter used to calculate any of the snippet's derived parameters?
+/*! Derived parameters are calculated by arbitrary functions so this relies on them listing the parameters they use
+    and any derived parameter which doesn't is assumed to use all of them */
+//--------------------------------------------------------------------------
+GENN_EXPORT bool isParamUsedByDerivedParams(const Snippet::Base *snippet, const std::string &paramName);
+
 //--------------------------------------------------------------------------
 //! \brief Function to determine whether a string containing a type is a pointer
 //--------------------------------------------------------------------------
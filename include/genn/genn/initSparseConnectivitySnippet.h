@@ -67,6 +67,9 @@ public:
 
     //! Can this neuron model be merged with other? i.e. can they be simulated using same generated code
     bool canBeMerged(const Base *other) const;
+
+    //! Update hash digest with everything compared by canBeMerged
+    void updateHash(size_t &hash) const;
 };
 
 //----------------------------------------------------------------------------
@@ -84,6 +87,11 @@ public:
     {
         return Snippet::Init<Base>::canBeMerged(other, getSnippet()->getRowBuildCode());
     }
+
+    void updateHash(size_t &hash) const
+    {
+        Snippet::Init<Base>::updateHash(hash, getSnippet()->getRowBuildCode());
+    }
 };
 
 //----------------------------------------------------------------------------
@@ -126,7 +134,7 @@ public:
     SET_ROW_BUILD_STATE_VARS({{"prevJ", "int", -1}});
 
     SET_PARAM_NAMES({"prob"});
-    SET_DERIVED_PARAMS({{"probLogRecip", [](const std::vector<double> &pars, double){ return 1.0 / log(1.0 - pars[0]); }}});
+    SET_DERIVED_PARAMS({{"probLogRecip", [](const std::vector<double> &pars, double){ return 1.0 / log(1.0 - pars[0]); }, {"prob"}}});
 
     SET_CALC_MAX_ROW_LENGTH_FUNC(
         [](unsigned int numPre, unsigned int numPost, const std::vector<double> &pars)
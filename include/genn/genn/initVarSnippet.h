@@ -27,6 +27,9 @@ public:
     //----------------------------------------------------------------------------
     //! Can this neuron model be merged with other? i.e. can they be simulated using same generated code
     bool canBeMerged(const Base *other) const;
+
+    //! Update hash digest with everything compared by canBeMerged
+    void updateHash(size_t &hash) const;
 };
 
 //----------------------------------------------------------------------------
@@ -152,10 +155,10 @@ public:
 
     SET_PARAM_NAMES({"mean", "sd", "min", "max"});
     SET_DERIVED_PARAMS({
-        {"meanTimestep", [](const std::vector<double> &pars, double dt){ return pars[0] / dt; }},
-        {"sdTimestep", [](const std::vector<double> &pars, double dt){ return pars[1] / dt; }},
-        {"minTimestep", [](const std::vector<double> &pars, double dt){ return pars[2] / dt; }},
-        {"maxTimestep", [](const std::vector<double> &pars, double dt){ return pars[3] / dt; }}});
+        {"meanTimestep", [](const std::vector<double> &pars, double dt){ return pars[0] / dt; }, {"mean"}},
+        {"sdTimestep", [](const std::vector<double> &pars, double dt){ return pars[1] / dt; }, {"sd"}},
+        {"minTimestep", [](const std::vector<double> &pars, double dt){ return pars[2] / dt; }, {"min"}},
+        {"maxTimestep", [](const std::vector<double> &pars, double dt){ return pars[3] / dt; }, {"max"}}});
 };
 
 //----------------------------------------------------------------------------
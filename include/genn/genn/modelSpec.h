@@ -145,6 +145,11 @@ public:
     //! Set the random seed (disables automatic seeding if argument not 0).
     void setSeed(unsigned int rngSeed){ m_Seed = rngSeed; }
 
+    //! Set number of instances of the model to simulate in a batch
+    /*! All state variables, spikes and postsynaptic inputs are duplicated for each
+        instance whereas connectivity, parameters and extra global parameters are shared */
+    void setBatchSize(unsigned int batchSize);
+
     //! What is the default location for model state variables?
     /*! Historically, everything was allocated on both the host AND device */
     void setDefaultVarLocation(VarLocation loc){ m_DefaultVarLocation = loc; }
@@ -179,6 +184,9 @@ public:
     //! Get the random seed
     unsigned int getSeed() const { return m_Seed; }
 
+    //! Get number of instances of the model simulated in a batch
+    unsigned int getBatchSize() const { return m_BatchSize; }
+
     //! Are timers and timing commands enabled
     bool isTimingEnabled() const{ return m_TimingEnabled; }
 
@@ -419,6 +427,9 @@ protected:
     //! Are any variables in any populations in this model using zero-copy memory?
     bool zeroCopyInUse() const;
 
+    //! Is recording enabled on any population in this model?
+    bool isRecordingInUse() const;
+
     //! Get std::map containing local named NeuronGroup objects in model
     const std::map<std::string, NeuronGroupInternal> &getNeuronGroups() const{ return m_LocalNeuronGroups; }
 
@@ -466,6 +477,9 @@ private:
     //! RNG seed
     unsigned int m_Seed;
 
+    //! Number of instances of the model simulated in a batch
+    unsigned int m_BatchSize;
+
     //! What is the default location for model state variables? Historically, everything was allocated on both host AND device
     VarLocation m_DefaultVarLocation;
 
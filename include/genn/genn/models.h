@@ -58,6 +58,11 @@ public:
     {
         return Snippet::Init<InitVarSnippet::Base>::canBeMerged(other, getSnippet()->getCode());
     }
+
+    void updateHash(size_t &hash) const
+    {
+        Snippet::Init<InitVarSnippet::Base>::updateHash(hash, getSnippet()->getCode());
+    }
 };
 
 //----------------------------------------------------------------------------
@@ -201,6 +206,20 @@ public:
         return getNamedVecIndex(paramName, getExtraGlobalParams());
     }
 
+    //------------------------------------------------------------------------
+    // Static API
+    //------------------------------------------------------------------------
+    //! Update hash digest with the names, types and access modes of a vector of variables
+    static void updateHashVars(const VarVec &vars, size_t &hash)
+    {
+        Utils::updateHash(vars.size(), hash);
+        for(const auto &v : vars) {
+            Utils::updateHash(v.name, hash);
+            Utils::updateHash(v.type, hash);
+            Utils::updateHash(v.access, hash);
+        }
+    }
+
 protected:
     //------------------------------------------------------------------------
     // Protected methods
@@ -212,5 +231,19 @@ protected:
                 && (getVars() == other->getVars())
                 && (getExtraGlobalParams() == other->getExtraGlobalParams()));
     }
+
+    //! Update hash digest with everything compared by canBeMerged
+    void updateHash(size_t &hash) const
+    {
+        Snippet::Base::updateHash(hash);
+        updateHashVars(getVars(), hash);
+
+        const auto egps = getExtraGlobalParams();
+        Utils::updateHash(egps.size(), hash);
+        for(const auto &e : egps) {
+            Utils::updateHash(e.name, hash);
+            Utils::updateHash(e.type, hash);
+        }
+    }
 };
 } // Models
@@ -105,6 +105,18 @@ public:
         and only applies to extra global parameters which are pointers. */
     void setExtraGlobalParamLocation(const std::string &paramName, VarLocation loc);
 
+    //! Set whether neuron model parameter is dynamic
+    /*! Rather than being hard-coded into the generated code, dynamic parameters are stored in the
+        merged group structures and can be changed at runtime using a generated setter function.
+        Parameters used to calculate derived parameters cannot be dynamic. */
+    void setParamDynamic(const std::string &paramName, bool dynamic = true);
+
+    //! Enables and disables recording of this neuron group's spikes
+    /*! When enabled, spikes emitted each timestep are recorded as a bitmask in a buffer,
+        allocated for a number of timesteps by allocateRecordingBuffers(), which can be copied
+        from the device and processed in bulk rather than every timestep */
+    void setSpikeRecordingEnabled(bool enabled) { m_SpikeRecordingEnabled = enabled; }
+
     //------------------------------------------------------------------------
     // Public const methods
     //------------------------------------------------------------------------
@@ -119,6 +131,9 @@ public:
     const std::vector<double> &getParams() const{ return m_Params; }
     const std::vector<Models::VarInit> &getVarInitialisers() const{ return m_VarInitialisers; }
 
+    //! Is neuron model parameter dynamic i.e. can it be changed at runtime
+    bool isParamDynamic(size_t index) const{ return m_DynamicParams.at(index); }
+
     bool isSpikeTimeRequired() const;
     bool isTrueSpikeRequired() const;
     bool isSpikeEventRequired() const;
@@ -136,6 +151,9 @@ public:
     //! Get location of this neuron group's output spike times
     VarLocation getSpikeTimeLocation() const{ return m_SpikeTimeLocation; }
 
+    //! Is spike recording enabled for this population?
+    bool isSpikeRecordingEnabled() const { return m_SpikeRecordingEnabled; }
+
     //! Get location of neuron model state variable by name
     VarLocation getVarLocation(const std::string &varName) const;
 
@@ -164,7 +182,8 @@ protected:
         m_Name(name), m_NumNeurons(numNeurons), m_NeuronModel(neuronModel), m_Params(params), m_VarInitialisers(varInitialisers),
         m_NumDelaySlots(1), m_VarQueueRequired(varInitialisers.size(), false), m_SpikeLocation(defaultVarLocation), m_SpikeEventLocation(defaultVarLocation),
         m_SpikeTimeLocation(defaultVarLocation), m_VarLocation(varInitialisers.size(), defaultVarLocation),
-        m_ExtraGlobalParamLocation(neuronModel->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation)
+        m_ExtraGlobalParamLocation(neuronModel->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation),
+        m_DynamicParams(params.size(), false), m_SpikeRecordingEnabled(false)
     {
     }
 
@@ -208,6 +227,8 @@ protected:
 
     const std::vector<double> &getDerivedParams() const{ return m_DerivedParams; }
 
+    const std::vector<bool> &getDynamicParams() const{ return m_DynamicParams; }
+
     const std::set<SpikeEventThreshold> &getSpikeEventCondition() const{ return m_SpikeEventCondition; }
 
     //! Helper to get vector of incoming synapse groups which have postsynaptic update code
@@ -227,6 +248,16 @@ protected:
     /*! NOTE: this can only be called after model is finalized */
     bool canInitBeMerged(const NeuronGroup &other) const;
 
+    //! Get hash digest used to find groups which might be mergable with this one
+    /*! Groups for which canBeMerged returns true always have the same digest.
+        NOTE: this can only be called after model is finalized */
+    size_t getHashDigest() const;
+
+    //! Get hash digest used to find groups whose initialisation might be mergable with this one
+    /*! Groups for which canInitBeMerged returns true always have the same digest.
+        NOTE: this can only be called after model is finalized */
+    size_t getInitHashDigest() const;
+
 private:
     //------------------------------------------------------------------------
     // Private methods
@@ -269,4 +300,10 @@ private:
 
     //! Location of extra global parameters
     std::vector<VarLocation> m_ExtraGlobalParamLocation;
+
+    //! Vector specifying which parameters are dynamic
+    std::vector<bool> m_DynamicParams;
+
+    //! Is spike recording enabled for this population?
+    bool m_SpikeRecordingEnabled;
 };
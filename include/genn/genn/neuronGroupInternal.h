@@ -31,10 +31,13 @@ public:
     using NeuronGroup::getOutSyn;
     using NeuronGroup::getCurrentSources;
     using NeuronGroup::getDerivedParams;
+    using NeuronGroup::getDynamicParams;
     using NeuronGroup::getSpikeEventCondition;
     using NeuronGroup::getInSynWithPostCode;
     using NeuronGroup::getOutSynWithPreCode;
     using NeuronGroup::isVarQueueRequired;
     using NeuronGroup::canBeMerged;
     using NeuronGroup::canInitBeMerged;
+    using NeuronGroup::getHashDigest;
+    using NeuronGroup::getInitHashDigest;
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 // Standard includes
+#include <algorithm>
 #include <array>
 #include <functional>
 #include <string>
@@ -22,6 +23,7 @@
 #define SET_SUPPORT_CODE(SUPPORT_CODE) virtual std::string getSupportCode() const override{ return SUPPORT_CODE; }
 #define SET_ADDITIONAL_INPUT_VARS(...) virtual ParamValVec getAdditionalInputVars() const override{ return __VA_ARGS__; }
 #define SET_NEEDS_AUTO_REFRACTORY(AUTO_REFRACTORY_REQUIRED) virtual bool isAutoRefractoryRequired() const override{ return AUTO_REFRACTORY_REQUIRED; }
+#define SET_POPULATION_SPIKE_CODE(POPULATION_SPIKE_CODE) virtual std::string getPopulationSpikeCode() const override{ return POPULATION_SPIKE_CODE; }
 
 //----------------------------------------------------------------------------
 // NeuronModels::Base
@@ -60,11 +62,21 @@ public:
     //! Does this model require auto-refractory logic?
     virtual bool isAutoRefractoryRequired() const{ return true; }
 
+    //! Gets code which generates all of the spikes emitted by the population in one timestep.
+    /*! If this is provided, it is run once per population per timestep rather than once per neuron and
+        should call $(addSpike, i) to emit a spike from neuron i, in ascending order of i. The population
+        size is available as $(num_neurons). Models which provide this cannot have state variables,
+        sim, threshold condition or reset code, incoming synapses or current sources. */
+    virtual std::string getPopulationSpikeCode() const{ return ""; }
+
     //----------------------------------------------------------------------------
     // Public API
     //----------------------------------------------------------------------------
     //! Can this neuron model be merged with other? i.e. can they be simulated using same generated code
     bool canBeMerged(const Base *other) const;
+
+    //! Update hash digest with everything compared by canBeMerged
+    void updateHash(size_t &hash) const;
 };
 
 //----------------------------------------------------------------------------
@@ -124,9 +136,9 @@ public:
     SET_VARS({{"V","scalar"}, {"preV", "scalar"}});
 
     SET_DERIVED_PARAMS({
-        {"ip0", [](const std::vector<double> &pars, double){ return pars[0] * pars[0] * pars[1]; }},
-        {"ip1", [](const std::vector<double> &pars, double){ return pars[0] * pars[2]; }},
-        {"ip2", [](const std::vector<double> &pars, double){ return (pars[0] * pars[1]) + (pars[0] * pars[2]); }}});
+        {"ip0", [](const std::vector<double> &pars, double){ return pars[0] * pars[0] * pars[1]; }, {"Vspike", "alpha"}},
+        {"ip1", [](const std::vector<double> &pars, double){ return pars[0] * pars[2]; }, {"Vspike", "y"}},
+        {"ip2", [](const std::vector<double> &pars, double){ return (pars[0] * pars[1]) + (pars[0] * pars[2]); }, {"Vspike", "alpha", "y"}}});
 };
 
 //----------------------------------------------------------------------------
@@ -235,8 +247,8 @@ public:
         "TauRefrac"});
 
     SET_DERIVED_PARAMS({
-        {"ExpTC", [](const std::vector<double> &pars, double dt){ return std::exp(-dt / pars[1]); }},
-        {"Rmembrane", [](const std::vector<double> &pars, double){ return  pars[1] / pars[0]; }}});
+        {"ExpTC", [](const std::vector<double> &pars, double dt){ return std::exp(-dt / pars[1]); }, {"TauM"}},
+        {"Rmembrane", [](const std::vector<double> &pars, double){ return  pars[1] / pars[0]; }, {"C", "TauM"}}});
 
     SET_VARS({{"V", "scalar"}, {"RefracTime", "scalar"}});
 
@@ -370,7 +382,54 @@ public:
 
     SET_PARAM_NAMES({"rate"});
     SET_VARS({{"timeStepToSpike", "scalar"}});
-    SET_DERIVED_PARAMS({{"isi", [](const std::vector<double> &pars, double dt){ return 1000.0 / (pars[0] * dt); }}});
+    SET_DERIVED_PARAMS({{"isi", [](const std::vector<double> &pars, double dt){ return 1000.0 / (pars[0] * dt); }, {"rate"}}});
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+//----------------------------------------------------------------------------
+// NeuronModels::PoissonPopulation
+//----------------------------------------------------------------------------
+//! Population of Poisson neurons whose spikes are generated together
+/*! Rather than testing every neuron every timestep, this samples the geometrically-distributed
+    gap to the next spiking neuron in the population so the cost of simulating it scales with
+    the number of spikes emitted rather than with the size of the population.
+
+    It has no state variables and 1 parameter:
+
+    - \c rate - Mean firing rate (Hz)
+
+    \note The firing rate is assumed to be low enough that each neuron
+    spikes at most once per timestep, i.e. \c rate * \c DT must be less than 1000. */
+class PoissonPopulation : public Base
+{
+public:
+    DECLARE_MODEL(NeuronModels::PoissonPopulation, 1, 0);
+
+    SET_POPULATION_SPIKE_CODE(
+        "if($(pSpike) > 0.0) {\n"
+        "    int i = -1;\n"
+        "    while(true) {\n"
+        "        const scalar u = $(gennrand_uniform);\n"
+        "        const scalar skip = log(u) * $(probLogRecip);\n"
+        "        if(skip >= (scalar)((int)$(num_neurons) - 1 - i)) {\n"
+        "            break;\n"
+        "        }\n"
+        "        i += (1 + (int)skip);\n"
+        "        $(addSpike, i);\n"
+        "    }\n"
+        "}\n");
+
+    SET_PARAM_NAMES({"rate"});
+    SET_DERIVED_PARAMS({
+        {"pSpike", [](const std::vector<double> &pars, double dt){ return pars[0] * dt / 1000.0; }, {"rate"}},
+        {"probLogRecip",
+            [](const std::vector<double> &pars, double dt)
+            {
+                // **NOTE** clamp probability so no infinite or NaN values end up in generated code
+                const double pSpike = std::min(1.0, pars[0] * dt / 1000.0);
+                return (pSpike > 0.0) ? (1.0 / log(1.0 - pSpike)) : 0.0;
+            },
+            {"rate"}}});
     SET_NEEDS_AUTO_REFRACTORY(false);
 };
 
@@ -35,6 +35,9 @@ public:
     //----------------------------------------------------------------------------
     //! Can this neuron model be merged with other? i.e. can they be simulated using same generated code
     bool canBeMerged(const Base *other) const;
+
+    //! Update hash digest with everything compared by canBeMerged
+    void updateHash(size_t &hash) const;
 };
 
 //----------------------------------------------------------------------------
@@ -55,8 +58,8 @@ public:
     SET_PARAM_NAMES({"tau"});
 
     SET_DERIVED_PARAMS({
-        {"expDecay", [](const std::vector<double> &pars, double dt){ return std::exp(-dt / pars[0]); }},
-        {"init", [](const std::vector<double> &pars, double dt){ return (pars[0] * (1.0 - std::exp(-dt / pars[0]))) * (1.0 / dt); }}});
+        {"expDecay", [](const std::vector<double> &pars, double dt){ return std::exp(-dt / pars[0]); }, {"tau"}},
+        {"init", [](const std::vector<double> &pars, double dt){ return (pars[0] * (1.0 - std::exp(-dt / pars[0]))) * (1.0 / dt); }, {"tau"}}});
 };
 
 //----------------------------------------------------------------------------
@@ -79,7 +82,7 @@ public:
 
     SET_PARAM_NAMES({"tau", "E"});
 
-    SET_DERIVED_PARAMS({{"expDecay", [](const std::vector<double> &pars, double dt){ return std::exp(-dt / pars[0]); }}});
+    SET_DERIVED_PARAMS({{"expDecay", [](const std::vector<double> &pars, double dt){ return std::exp(-dt / pars[0]); }, {"tau"}}});
 };
 
 //----------------------------------------------------------------------------
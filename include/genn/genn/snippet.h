@@ -152,9 +152,19 @@ public:
         std::string value;
     };
 
-    //! A derived parameter has a name and a function for obtaining its value
+    //! A derived parameter has a name, a function for obtaining its value and,
+    //! optionally, the names of the parameters this function uses
+    /*! If no parameter names are listed, the derived parameter is assumed to use all of the parameters */
     struct DerivedParam
     {
+        DerivedParam(const std::string &n, std::function<double(const std::vector<double> &, double)> f,
+                     const std::vector<std::string> &p) : name(n), func(f), paramNames(p)
+        {}
+        DerivedParam(const std::string &n, std::function<double(const std::vector<double> &, double)> f) : DerivedParam(n, f, {})
+        {}
+        DerivedParam() : DerivedParam("", nullptr)
+        {}
+
         bool operator == (const DerivedParam &other) const
         {
             return (name == other.name);
@@ -162,6 +172,7 @@ public:
 
         std::string name;
         std::function<double(const std::vector<double> &, double)> func;
+        std::vector<std::string> paramNames;
     };
 
 
@@ -183,6 +194,19 @@ public:
     //! Calculate their value from a vector of model parameter values
     virtual DerivedParamVec getDerivedParams() const{ return {}; }
 
+    //------------------------------------------------------------------------
+    // Public methods
+    //------------------------------------------------------------------------
+    //! Find the index of a named parameter
+    size_t getParamIndex(const std::string &paramName) const
+    {
+        const auto paramNames = getParamNames();
+        auto iter = std::find(paramNames.cbegin(), paramNames.cend(), paramName);
+        assert(iter != paramNames.cend());
+
+        // Return 'distance' between first entry in vector and iterator i.e. index
+        return std::distance(paramNames.cbegin(), iter);
+    }
 
 protected:
     //------------------------------------------------------------------------
@@ -194,6 +218,18 @@ protected:
         return ((getParamNames() == other->getParamNames()) && (getDerivedParams() == other->getDerivedParams()));
     }
 
+    //! Update hash digest with everything compared by canBeMerged
+    void updateHash(size_t &hash) const
+    {
+        Utils::updateHash(getParamNames(), hash);
+
+        const auto derivedParams = getDerivedParams();
+        Utils::updateHash(derivedParams.size(), hash);
+        for(const auto &d : derivedParams) {
+            Utils::updateHash(d.name, hash);
+        }
+    }
+
     //------------------------------------------------------------------------
     // Protected static helpers
     //------------------------------------------------------------------------
@@ -280,6 +316,28 @@ protected:
         return false;
     }
 
+    void updateHash(size_t &hash, const std::string &codeString) const
+    {
+        // Update hash with snippet
+        getSnippet()->updateHash(hash);
+
+        // Update hash with values of parameters referenced in code string
+        const auto paramNames = getSnippet()->getParamNames();
+        for(size_t i = 0; i < paramNames.size(); i++) {
+            if(codeString.find("$(" + paramNames[i] + ")") != std::string::npos) {
+                Utils::updateHash(getParams()[i], hash);
+            }
+        }
+
+        // Update hash with values of derived parameters referenced in code string
+        const auto derivedParams = getSnippet()->getDerivedParams();
+        for(size_t i = 0; i < derivedParams.size(); i++) {
+            if(codeString.find("$(" + derivedParams[i].name + ")") != std::string::npos) {
+                Utils::updateHash(getDerivedParams()[i], hash);
+            }
+        }
+    }
+
 private:
     //----------------------------------------------------------------------------
     // Members
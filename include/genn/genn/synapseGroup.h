@@ -64,6 +64,17 @@ public:
         and only applies to extra global parameters which are pointers. */
     void setPSExtraGlobalParamLocation(const std::string &paramName, VarLocation loc);
 
+    //! Set whether weight update model parameter is dynamic
+    /*! Rather than being hard-coded into the generated code, dynamic parameters are stored in the
+        merged group structures and can be changed at runtime using a generated setter function.
+        Parameters used to calculate derived parameters cannot be dynamic. */
+    void setWUParamDynamic(const std::string &paramName, bool dynamic = true);
+
+    //! Set whether postsynaptic model parameter is dynamic
+    /*! Synapse groups with dynamic postsynaptic model parameters are never linearly combined with others.
+        Parameters used to calculate derived parameters cannot be dynamic. */
+    void setPSParamDynamic(const std::string &paramName, bool dynamic = true);
+
     //! Set location of sparse connectivity initialiser extra global parameter
     /*! This is ignored for simulations on hardware with a single memory space
         and only applies to extra global parameters which are pointers. */
@@ -88,6 +99,12 @@ public:
     /*! Use with synaptic matrix types with SynapseMatrixConnectivity::SPARSE and postsynaptic learning to optimise CUDA implementation */
     void setMaxSourceConnections(unsigned int maxPostConnections);
     
+    //! Sets the maximum total number of synapses in this synapse group
+    /*! Use with synaptic matrix types with SynapseMatrixConnectivity::CSR to size the arrays used to store
+        postsynaptic indices and synapse variables. If this is not set, enough memory is allocated for
+        every source neuron to have the maximum number of connections (see SynapseGroup::setMaxConnections) */
+    void setMaxSynapses(size_t maxSynapses);
+
     //! Sets the maximum dendritic delay for synapses in this synapse group
     void setMaxDendriticDelayTimesteps(unsigned int maxDendriticDelay);
     
@@ -116,6 +133,7 @@ public:
     unsigned int getBackPropDelaySteps() const{ return m_BackPropDelaySteps; }
     unsigned int getMaxConnections() const{ return m_MaxConnections; }
     unsigned int getMaxSourceConnections() const{ return m_MaxSourceConnections; }
+    size_t getMaxSynapses() const;
     unsigned int getMaxDendriticDelayTimesteps() const{ return m_MaxDendriticDelayTimesteps; }
     SynapseMatrixType getMatrixType() const{ return m_MatrixType; }
 
@@ -137,6 +155,10 @@ public:
     const WeightUpdateModels::Base *getWUModel() const{ return m_WUModel; }
 
     const std::vector<double> &getWUParams() const{ return m_WUParams; }
+
+    //! Is weight update model parameter dynamic i.e. can it be changed at runtime
+    bool isWUParamDynamic(size_t index) const{ return m_WUDynamicParams.at(index); }
+
     const std::vector<Models::VarInit> &getWUVarInitialisers() const{ return m_WUVarInitialisers; }
     const std::vector<Models::VarInit> &getWUPreVarInitialisers() const{ return m_WUPreVarInitialisers; }
     const std::vector<Models::VarInit> &getWUPostVarInitialisers() const{ return m_WUPostVarInitialisers; }
@@ -145,6 +167,10 @@ public:
     const PostsynapticModels::Base *getPSModel() const{ return m_PSModel; }
 
     const std::vector<double> &getPSParams() const{ return m_PSParams; }
+
+    //! Is postsynaptic model parameter dynamic i.e. can it be changed at runtime
+    bool isPSParamDynamic(size_t index) const{ return m_PSDynamicParams.at(index); }
+
     const std::vector<Models::VarInit> &getPSVarInitialisers() const{ return m_PSVarInitialisers; }
     const std::vector<double> getPSConstInitVals() const;
 
@@ -251,6 +277,9 @@ protected:
     const std::vector<double> &getWUDerivedParams() const{ return m_WUDerivedParams; }
     const std::vector<double> &getPSDerivedParams() const{ return m_PSDerivedParams; }
 
+    const std::vector<bool> &getWUDynamicParams() const{ return m_WUDynamicParams; }
+    const std::vector<bool> &getPSDynamicParams() const{ return m_PSDynamicParams; }
+
     //!< Does the event threshold needs to be retested in the synapse kernel?
     /*! This is required when the pre-synaptic neuron population's outgoing synapse groups require different event threshold */
     bool isEventThresholdReTestRequired() const{ return m_EventThresholdReTestRequired; }
@@ -302,6 +331,19 @@ protected:
     /*! NOTE: this can only be called after model is finalized */
     bool canConnectivityInitBeMerged(const SynapseGroup &other) const;
 
+    //! Get hash digests used to find synapse groups which might be mergable with this one
+    /*! Each digest corresponds to one of the canXXXBeMerged methods above and, if that returns true
+        for a pair of groups, their digests will always match. NOTE: these can only be called after model is finalized */
+    size_t getWUHashDigest() const;
+    size_t getWUPreHashDigest() const;
+    size_t getWUPostHashDigest() const;
+    size_t getPSHashDigest() const;
+    size_t getWUInitHashDigest() const;
+    size_t getWUPreInitHashDigest() const;
+    size_t getWUPostInitHashDigest() const;
+    size_t getPSInitHashDigest() const;
+    size_t getConnectivityInitHashDigest() const;
+
 private:
     //------------------------------------------------------------------------
     // Members
@@ -327,6 +369,9 @@ private:
     //! Maximum number of source neurons any target neuron can connect to
     unsigned int m_MaxSourceConnections;
 
+    //! Maximum total number of synapses in group (zero if this should be calculated from maximum number of connections)
+    size_t m_MaxSynapses;
+
     //! Maximum dendritic delay timesteps supported for synapses in this population
     unsigned int m_MaxDendriticDelayTimesteps;
     
@@ -400,6 +445,12 @@ private:
     //! Location of postsynaptic model extra global parameters
     std::vector<VarLocation> m_PSExtraGlobalParamLocation;
 
+    //! Vector specifying which weight update model parameters are dynamic
+    std::vector<bool> m_WUDynamicParams;
+
+    //! Vector specifying which postsynaptic model parameters are dynamic
+    std::vector<bool> m_PSDynamicParams;
+
     //! Initialiser used for creating sparse connectivity
     InitSparseConnectivitySnippet::Init m_ConnectivityInitialiser;
 
@@ -30,6 +30,8 @@ public:
     using SynapseGroup::getTrgNeuronGroup;
     using SynapseGroup::getWUDerivedParams;
     using SynapseGroup::getPSDerivedParams;
+    using SynapseGroup::getWUDynamicParams;
+    using SynapseGroup::getPSDynamicParams;
     using SynapseGroup::setEventThresholdReTestRequired;
     using SynapseGroup::setPSModelMergeTarget;
     using SynapseGroup::initDerivedParams;
@@ -47,4 +49,13 @@ public:
     using SynapseGroup::canWUPostInitBeMerged;
     using SynapseGroup::canPSInitBeMerged;
     using SynapseGroup::canConnectivityInitBeMerged;
+    using SynapseGroup::getWUHashDigest;
+    using SynapseGroup::getWUPreHashDigest;
+    using SynapseGroup::getWUPostHashDigest;
+    using SynapseGroup::getPSHashDigest;
+    using SynapseGroup::getWUInitHashDigest;
+    using SynapseGroup::getWUPreInitHashDigest;
+    using SynapseGroup::getWUPostInitHashDigest;
+    using SynapseGroup::getPSInitHashDigest;
+    using SynapseGroup::getConnectivityInitHashDigest;
 };
@@ -10,6 +10,7 @@ enum class SynapseMatrixConnectivity : unsigned int
     BITMASK     = (1 << 1),
     SPARSE      = (1 << 2),
     PROCEDURAL  = (1 << 3),
+    CSR         = (1 << 4),
 };
 
 //!< Flags defining different types of synaptic matrix connectivity
@@ -32,6 +33,9 @@ enum class SynapseMatrixType : unsigned int
     SPARSE_GLOBALG                      = static_cast<unsigned int>(SynapseMatrixConnectivity::SPARSE) | static_cast<unsigned int>(SynapseMatrixWeight::GLOBAL),
     SPARSE_GLOBALG_INDIVIDUAL_PSM       = static_cast<unsigned int>(SynapseMatrixConnectivity::SPARSE) | static_cast<unsigned int>(SynapseMatrixWeight::GLOBAL) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL_PSM),
     SPARSE_INDIVIDUALG                  = static_cast<unsigned int>(SynapseMatrixConnectivity::SPARSE) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL_PSM),
+    CSR_GLOBALG                         = static_cast<unsigned int>(SynapseMatrixConnectivity::CSR) | static_cast<unsigned int>(SynapseMatrixWeight::GLOBAL),
+    CSR_GLOBALG_INDIVIDUAL_PSM          = static_cast<unsigned int>(SynapseMatrixConnectivity::CSR) | static_cast<unsigned int>(SynapseMatrixWeight::GLOBAL) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL_PSM),
+    CSR_INDIVIDUALG                     = static_cast<unsigned int>(SynapseMatrixConnectivity::CSR) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL_PSM),
     PROCEDURAL_GLOBALG                  = static_cast<unsigned int>(SynapseMatrixConnectivity::PROCEDURAL) | static_cast<unsigned int>(SynapseMatrixWeight::GLOBAL),
     PROCEDURAL_GLOBALG_INDIVIDUAL_PSM   = static_cast<unsigned int>(SynapseMatrixConnectivity::PROCEDURAL) | static_cast<unsigned int>(SynapseMatrixWeight::GLOBAL) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL_PSM),
     PROCEDURAL_PROCEDURALG              = static_cast<unsigned int>(SynapseMatrixConnectivity::PROCEDURAL) | static_cast<unsigned int>(SynapseMatrixWeight::PROCEDURAL) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL_PSM),
@@ -60,7 +64,7 @@ inline SynapseMatrixType operator | (SynapseMatrixWeight weightType, SynapseMatr
 //----------------------------------------------------------------------------
 inline SynapseMatrixConnectivity getSynapseMatrixConnectivity(SynapseMatrixType type)
 {
-    return static_cast<SynapseMatrixConnectivity>(static_cast<unsigned int>(type) & 0x15);
+    return static_cast<SynapseMatrixConnectivity>(static_cast<unsigned int>(type) & 0x1F);
 }
 
 inline SynapseMatrixWeight getSynapseMatrixWeight(SynapseMatrixType type)
@@ -123,6 +123,9 @@ public:
     //! Can this weight update model be merged with other? i.e. can they be simulated using same generated code
     bool canBeMerged(const Base *other) const;
 
+    //! Update hash digest with everything compared by canBeMerged
+    void updateHash(size_t &hash) const;
+
 };
 
 //----------------------------------------------------------------------------
@@ -308,13 +311,13 @@ public:
         "$(g)=$(gMax)/2.0 *(tanh($(gSlope)*($(gRaw) - ($(gMid))))+1); \n");
 
     SET_DERIVED_PARAMS({
-        {"lim0", [](const std::vector<double> &pars, double){ return (1/pars[4] + 1/pars[1]) * pars[0] / (2/pars[1]); }},
-        {"lim1", [](const std::vector<double> &pars, double){ return  -((1/pars[3] + 1/pars[1]) * pars[0] / (2/pars[1])); }},
-        {"slope0", [](const std::vector<double> &pars, double){ return  -2*pars[5]/(pars[1]*pars[0]); }},
-        {"slope1", [](const std::vector<double> &pars, double){ return  2*pars[5]/(pars[1]*pars[0]); }},
-        {"off0", [](const std::vector<double> &pars, double){ return  pars[5] / pars[4]; }},
-        {"off1", [](const std::vector<double> &pars, double){ return  pars[5] / pars[1]; }},
-        {"off2", [](const std::vector<double> &pars, double){ return  pars[5] / pars[3]; }}});
+        {"lim0", [](const std::vector<double> &pars, double){ return (1/pars[4] + 1/pars[1]) * pars[0] / (2/pars[1]); }, {"tLrn", "tChng", "tPunish01"}},
+        {"lim1", [](const std::vector<double> &pars, double){ return  -((1/pars[3] + 1/pars[1]) * pars[0] / (2/pars[1])); }, {"tLrn", "tChng", "tPunish10"}},
+        {"slope0", [](const std::vector<double> &pars, double){ return  -2*pars[5]/(pars[1]*pars[0]); }, {"tLrn", "tChng", "gMax"}},
+        {"slope1", [](const std::vector<double> &pars, double){ return  2*pars[5]/(pars[1]*pars[0]); }, {"tLrn", "tChng", "gMax"}},
+        {"off0", [](const std::vector<double> &pars, double){ return  pars[5] / pars[4]; }, {"tPunish01", "gMax"}},
+        {"off1", [](const std::vector<double> &pars, double){ return  pars[5] / pars[1]; }, {"tChng", "gMax"}},
+        {"off2", [](const std::vector<double> &pars, double){ return  pars[5] / pars[3]; }, {"tPunish10", "gMax"}}});
 
     SET_NEEDS_PRE_SPIKE_TIME(true);
     SET_NEEDS_POST_SPIKE_TIME(true);
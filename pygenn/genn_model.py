@@ -67,7 +67,7 @@ from .model_preprocessor import prepare_snippet
 
 # Loop through backends in preferential order
 backend_modules = OrderedDict()
-for b in ["CUDA", "SingleThreadedCPU"]:
+for b in ["CUDA", "SingleThreadedCPU", "OpenMP"]:
     # Try and import
     try:
         m = import_module(".genn_wrapper." + b + "Backend", "pygenn")
@@ -657,6 +657,9 @@ def create_custom_neuron_class(class_name, param_names=None,
                                     parameter and the second MUST be an
                                     instance of a class which inherits from
                                     ``pygenn.genn_wrapper.Snippet.DerivedParamFunc``
+                                    and an optional third member lists the names of the
+                                    parameters it uses (otherwise it is assumed to use all
+                                    of them so none can be made dynamic)
     sim_code                    --  string with the simulation code
     threshold_condition_code    --  string with the threshold condition code
     reset_code                  --  string with the reset code
@@ -734,6 +737,9 @@ def create_custom_postsynaptic_class(class_name, param_names=None,
                             with name of the derived parameter and the second
                             MUST be an instance of a class which inherits
                             from ``pygenn.genn_wrapper.DerivedParamFunc``
+                            and an optional third member lists the names of the
+                            parameters it uses (otherwise it is assumed to use all
+                            of them so none can be made dynamic)
     decay_code          --  string with the decay code
     apply_input_code    --  string with the apply input code
     support_code        --  string with the support code
@@ -806,6 +812,9 @@ def create_custom_weight_update_class(class_name, param_names=None,
                                         parameter and the second MUST be an
                                         instance of a class which inherits from
                                         ``pygenn.genn_wrapper.DerivedParamFunc``
+                                        and an optional third member lists the names of the
+                                        parameters it uses (otherwise it is assumed to use all
+                                        of them so none can be made dynamic)
     sim_code                        --  string with the simulation code
     event_code                      --  string with the event code
     learn_post_code                 --  string with the code to include in
@@ -925,6 +934,9 @@ def create_custom_current_source_class(class_name, param_names=None,
                             with name of the derived parameter and the second
                             MUST be an instance of the class which inherits
                             from  ``pygenn.genn_wrapper.DerivedParamFunc``
+                            and an optional third member lists the names of the
+                            parameters it uses (otherwise it is assumed to use all
+                            of them so none can be made dynamic)
     injection_code      --  string with the current injection code
     extra_global_params --  list of pairs of strings with names and types of
                             additional parameters
@@ -976,6 +988,9 @@ def create_custom_model_class(class_name, base, param_names, var_name_types,
                         name of the derived parameter and the second MUST be
                         an instance of the class which inherits from the
                         ``pygenn.genn_wrapper.DerivedParamFunc`` class
+                        and an optional third member lists the names of the
+                        parameters it uses (otherwise it is assumed to use all
+                        of them so none can be made dynamic)
     custom_body     --  dictionary with attributes and methods of the new class
     """
 
@@ -996,7 +1011,8 @@ def create_custom_model_class(class_name, base, param_names, var_name_types,
 
     if derived_params is not None:
         body["get_derived_params"] = \
-            lambda self: DerivedParamVector([DerivedParam(dp[0], make_dpf(dp[1]))
+            lambda self: DerivedParamVector([DerivedParam(dp[0], make_dpf(dp[1]),
+                                                          StringVector(dp[2] if len(dp) > 2 else []))
                                              for dp in derived_params])
 
     if custom_body is not None:
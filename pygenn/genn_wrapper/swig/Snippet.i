@@ -41,6 +41,7 @@
 %include "snippet.h"
 
 // Extend each of the underlying structs with constructors
+// **NOTE** DerivedParam already has constructors, including one which also takes the names of the parameters it uses
 %extend Snippet::Base::EGP {
     EGP(const std::string &name, const std::string &type) 
     {
@@ -51,15 +52,6 @@
     }
 };
 
-%extend Snippet::Base::DerivedParam {
-    DerivedParam(const std::string &name, std::function<double(const std::vector<double> &, double)> func) 
-    {
-        Snippet::Base::DerivedParam* v = new Snippet::Base::DerivedParam();
-        v->name = name;
-        v->func = func;
-        return v;
-    }
-};
 // helper class for callbacks
 %feature("director") DerivedParamFunc;
 %rename(__call__) DerivedParamFunc::operator();
@@ -64,8 +64,9 @@ genn_extension_kwargs["define_macros"] = [("LINKING_GENN_DLL", "1"), ("LINKING_B
 if linux:
     genn_extension_kwargs["runtime_library_dirs"] = ["$ORIGIN"]
 
-# By default build single-threaded CPU backend
-backends = [("single_threaded_cpu", "SingleThreadedCPU", {})]
+# By default build single-threaded and OpenMP CPU backends
+backends = [("single_threaded_cpu", "SingleThreadedCPU", {}),
+            ("openmp", "OpenMP", {})]
 
 # If CUDA was found, add backend configuration
 if cuda_installed:
@@ -175,8 +175,20 @@ Backend::Backend(const KernelBlockSize &kernelBlockSizes, const Preferences &pre
 //--------------------------------------------------------------------------
 void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
                               NeuronGroupSimHandler simHandler, NeuronGroupMergedHandler wuVarUpdateHandler,
-                              HostHandler pushEGPHandler) const
+                              HostHandler pushEGPHandler, ModuleHandler) const
 {
+    // **TODO** batched models require kernels to be launched with an additional grid dimension
+    if(modelMerged.getModel().getBatchSize() != 1) {
+        throw std::runtime_error("Model uses a batch size of " + std::to_string(modelMerged.getModel().getBatchSize()) + " which is not supported by the CUDA backend");
+    }
+
+    // **TODO** population spike code requires spikes to be emitted by a single thread per population
+    for(const auto &n : modelMerged.getMergedNeuronUpdateGroups()) {
+        if(!n.getArchetype().getNeuronModel()->getPopulationSpikeCode().empty()) {
+            throw std::runtime_error("Neuron group '" + n.getArchetype().getName() + "' uses population spike code which is not supported by the CUDA backend");
+        }
+    }
+
     // Generate data structure for accessing merged groups
     const ModelSpecInternal &model = modelMerged.getModel();
     genMergedKernelDataStructures(
@@ -219,7 +231,11 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
     os << std::endl;
 
     size_t idStart = 0;
-    os << "extern \"C\" __global__ void " << KernelNames[KernelNeuronUpdate] << "("  << model.getTimePrecision() << " t)" << std::endl;
+    os << "extern \"C\" __global__ void " << KernelNames[KernelNeuronUpdate] << "("  << model.getTimePrecision() << " t";
+    if(model.isRecordingInUse()) {
+        os << ", unsigned int recordingTimestep";
+    }
+    os << ")" << std::endl;
     {
         CodeStream::Scope b(os);
         os << "const unsigned int id = " << m_KernelBlockSizes[KernelNeuronUpdate] << " * blockIdx.x + threadIdx.x; " << std::endl;
@@ -280,15 +296,32 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
                     popSubs.addVarSubstitution("rng", "&group.rng[" + popSubs["id"] + "]");
                 }
 
+                // If spike recording is enabled, clear this timestep's recording words before any spikes are recorded
+                // **NOTE** groups are padded to the block size, a multiple of the warp size, so each word is only accessed by threads in this block
+                if(ng.getArchetype().isSpikeRecordingEnabled()) {
+                    os << "if((" << popSubs["id"] << " % 32) == 0 && " << popSubs["id"] << " < group.numNeurons)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "group.recordSpk[((size_t)recordingTimestep * ((group.numNeurons + 31) / 32)) + (" << popSubs["id"] << " / 32)] = 0;" << std::endl;
+                    }
+                    os << "__syncthreads();" << std::endl;
+                }
+
                 // Call handler to generate generic neuron code
                 os << "if(" << popSubs["id"] << " < group.numNeurons)";
                 {
                     CodeStream::Scope b(os);
                     simHandler(os, ng, popSubs,
                         // Emit true spikes
-                        [this](CodeStream &os, const NeuronGroupMerged &, Substitutions &subs)
+                        [this](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &subs)
                         {
                             genEmitSpike(os, subs, "");
+
+                            // If spike recording is enabled, set this neuron's bit in this timestep's recording words
+                            if(ng.getArchetype().isSpikeRecordingEnabled()) {
+                                os << "atomicOr(&group.recordSpk[((size_t)recordingTimestep * ((group.numNeurons + 31) / 32)) + (" << subs["id"] << " / 32)], ";
+                                os << "1u << (" << subs["id"] << " % 32));" << std::endl;
+                            }
                         },
                         // Emit spike-like events
                         [this](CodeStream &os, const NeuronGroupMerged &, Substitutions &subs)
@@ -370,7 +403,7 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
         );
     }
 
-    os << "void updateNeurons(" << model.getTimePrecision() << ")";
+    os << "void updateNeurons(" << model.getTimePrecision() << (model.isRecordingInUse() ? ", unsigned int recordingTimestep" : "") << ")";
     {
         CodeStream::Scope b(os);
 
@@ -389,7 +422,7 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
             Timer t(os, "neuronUpdate", model.isTimingEnabled());
 
             genKernelDimensions(os, KernelNeuronUpdate, idStart);
-            os << KernelNames[KernelNeuronUpdate] << "<<<grid, threads>>>(t);" << std::endl;
+            os << KernelNames[KernelNeuronUpdate] << "<<<grid, threads>>>(t" << (model.isRecordingInUse() ? ", recordingTimestep" : "") << ");" << std::endl;
             os << "CHECK_CUDA_ERRORS(cudaPeekAtLastError());" << std::endl;
         }
     }
@@ -399,8 +432,20 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                                SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
                                SynapseGroupMergedHandler wumEventHandler, SynapseGroupMergedHandler wumProceduralConnectHandler,
                                SynapseGroupMergedHandler postLearnHandler, SynapseGroupMergedHandler synapseDynamicsHandler,
-                               HostHandler pushEGPHandler) const
+                               HostHandler pushEGPHandler, ModuleHandler) const
 {
+    // **TODO** CSR connectivity requires rows to be built serially so needs a different initialisation strategy on the GPU
+    for(const auto &s : modelMerged.getModel().getSynapseGroups()) {
+        if(s.second.getMatrixType() & SynapseMatrixConnectivity::CSR) {
+            throw std::runtime_error("Synapse group '" + s.first + "' uses CSR connectivity which is not supported by the CUDA backend");
+        }
+
+        // **TODO** presynaptic update strategies all use 32-bit synapse indices
+        if(areSixtyFourBitSynapseIndicesRequired(s.second)) {
+            throw std::runtime_error("Synapse group '" + s.first + "' contains too many synapses to be indexed with 32-bit integers which is not supported by the CUDA backend");
+        }
+    }
+
     // Generate data structure for accessing merged groups
     if(!modelMerged.getMergedPresynapticUpdateGroups().empty()) {
         genMergedKernelDataStructures(
@@ -782,7 +827,7 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
 void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                       NeuronGroupMergedHandler localNGHandler, SynapseGroupMergedHandler sgDenseInitHandler, 
                       SynapseGroupMergedHandler sgSparseConnectHandler, SynapseGroupMergedHandler sgSparseInitHandler,
-                      HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler) const
+                      HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler, ModuleHandler) const
 {
     os << "#include <iostream>" << std::endl;
     os << "#include <random>" << std::endl;
@@ -0,0 +1,1283 @@
+#include "backend.h"
+
+// Standard C++ include
+#include <algorithm>
+
+// GeNN includes
+#include "gennUtils.h"
+
+// GeNN code generator includes
+#include "code_generator/codeGenUtils.h"
+#include "code_generator/codeStream.h"
+#include "code_generator/modelSpecMerged.h"
+#include "code_generator/substitutions.h"
+
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+//! Generate code, within a parallel region, to calculate the contiguous block of postsynaptic neurons this thread updates
+void genPostsynapticBlock(CodeGenerator::CodeStream &os)
+{
+    os << "const unsigned int numThreads = omp_get_num_threads();" << std::endl;
+    os << "const unsigned int thread = omp_get_thread_num();" << std::endl;
+    os << "const unsigned int postBegin = (unsigned int)(((uint64_t)group.numTrgNeurons * thread) / numThreads);" << std::endl;
+    os << "const unsigned int postEnd = (unsigned int)(((uint64_t)group.numTrgNeurons * (thread + 1)) / numThreads);" << std::endl;
+}
+//--------------------------------------------------------------------------
+bool isNeuronInitRNGRequired(const NeuronGroupInternal &ng)
+{
+    // If neuron group itself requires an RNG for initialisation, return true
+    // **NOTE** this takes current sources and postsynaptic model initialisation into account
+    if(ng.isInitRNGRequired()) {
+        return true;
+    }
+
+    // Return true if any weight update model pre or postsynaptic variables, which are also initialised here, require an RNG
+    const auto outSynWithPreCode = ng.getOutSynWithPreCode();
+    const auto inSynWithPostCode = ng.getInSynWithPostCode();
+    return (std::any_of(outSynWithPreCode.cbegin(), outSynWithPreCode.cend(),
+                        [](const SynapseGroupInternal *sg){ return Utils::isRNGRequired(sg->getWUPreVarInitialisers()); })
+            || std::any_of(inSynWithPostCode.cbegin(), inSynWithPostCode.cend(),
+                           [](const SynapseGroupInternal *sg){ return Utils::isRNGRequired(sg->getWUPostVarInitialisers()); }));
+}
+}
+
+//--------------------------------------------------------------------------
+// CodeGenerator::OpenMP::Backend
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+namespace OpenMP
+{
+void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, 
+                              NeuronGroupSimHandler simHandler, NeuronGroupMergedHandler wuVarUpdateHandler,
+                              HostHandler pushEGPHandler, ModuleHandler moduleHandler) const
+{
+    const ModelSpecInternal &model = modelMerged.getModel();
+
+    // If recording is in use, neuron update is also passed the timestep within the recording buffers
+    const std::string updateParams = model.getTimePrecision() + " t" + (model.isRecordingInUse() ? ", unsigned int recordingTimestep" : "");
+    const std::string updateArgs = model.isRecordingInUse() ? "t, recordingTimestep" : "t";
+    os << "void updateNeurons(" << updateParams << ")";
+    {
+        CodeStream::Scope b(os);
+
+        Substitutions funcSubs(getCPUFunctions(), model.getPrecision());
+        funcSubs.addVarSubstitution("t", "t");
+
+        // Push any required EGPs
+        pushEGPHandler(os);
+
+        Timer t(os, "neuronUpdate", model.isTimingEnabled());
+
+        // Loop through merged neuron spike queue update groups
+        for(const auto &n : modelMerged.getMergedNeuronSpikeQueueUpdateGroups()) {
+            genMergedGroup(os, moduleHandler, "NeuronSpikeQueueUpdate", n.getIndex(), n.getGroups().size() * model.getBatchSize(), model.getTimePrecision() + " t", "t",
+                [&](CodeStream &os)
+                {
+                    os << "// merged neuron spike queue update group " << n.getIndex() << std::endl;
+                    os << "for(unsigned int g = 0; g < " << (n.getGroups().size() * model.getBatchSize()) << "; g++)";
+                    {
+                        CodeStream::Scope b(os);
+
+                        // Get reference to group
+                        os << "const auto &group = mergedNeuronSpikeQueueUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
+
+                        // Generate spike count reset
+                        genMergedGroupSpikeCountReset(os, n);
+                    }
+                });
+        }
+        // Loop through merged neuron update groups
+        for(const auto &n : modelMerged.getMergedNeuronUpdateGroups()) {
+            genMergedGroup(os, moduleHandler, "NeuronUpdate", n.getIndex(), n.getGroups().size() * model.getBatchSize(), updateParams, updateArgs,
+                [&](CodeStream &os)
+                {
+                    os << "// merged neuron update group " << n.getIndex() << std::endl;
+
+                    // If counter-based simulation RNGs are required, generate table of streams to use for each group
+                    genNeuronRNGStreams(os, model, n);
+
+                    os << "for(unsigned int g = 0; g < " << (n.getGroups().size() * model.getBatchSize()) << "; g++)";
+                    {
+                        CodeStream::Scope b(os);
+
+                        // Get reference to group
+                        os << "const auto &group = mergedNeuronUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
+
+                        // If axonal delays are required
+                        if(n.getArchetype().isDelayRequired()) {
+                            // We should READ from delay slot before spkQuePtr
+                            os << "const unsigned int readDelayOffset = " << n.getPrevQueueOffset() << ";" << std::endl;
+
+                            // And we should WRITE to delay slot pointed to be spkQuePtr
+                            os << "const unsigned int writeDelayOffset = " << n.getCurrentQueueOffset() << ";" << std::endl;
+                        }
+
+                        // If spike recording is enabled, get offset of this timestep's recording words and clear them
+                        // **NOTE** recording buffers are laid out by timestep then batch so group.recordSpk already points to this batch
+                        if(n.getArchetype().isSpikeRecordingEnabled()) {
+                            os << "const unsigned int numRecordingWords = (group.numNeurons + 31) / 32;" << std::endl;
+                            os << "const size_t recordingOffset = (size_t)recordingTimestep * numRecordingWords * " << model.getBatchSize() << ";" << std::endl;
+                            os << "std::fill_n(&group.recordSpk[recordingOffset], numRecordingWords, 0);" << std::endl;
+                        }
+                        os << std::endl;
+
+                        // If neuron model generates the spikes of the whole population at once, call sim handler once without looping over neurons
+                        if(!n.getArchetype().getNeuronModel()->getPopulationSpikeCode().empty()) {
+                            Substitutions popSubs(&funcSubs);
+                            addNeuronSimRNGSubstitution(os, n, popSubs, model.getPrecision());
+
+                            simHandler(os, n, popSubs,
+                                       // Emit true spikes
+                                       [this, wuVarUpdateHandler](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &subs)
+                                       {
+                                           // Insert code to emit true spikes
+                                           genEmitSpike(os, ng, subs, true, false);
+
+                                           // Insert code to update WU vars
+                                           wuVarUpdateHandler(os, ng, subs);
+                                       },
+                                       // Emit spike-like events
+                                       [this](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &subs)
+                                       {
+                                           // Insert code to emit spike-like events
+                                           genEmitSpike(os, ng, subs, false, false);
+                                       });
+                        }
+                        // Otherwise, if this neuron group requires a global simulation RNG, update it serially so the global RNG is
+                        // consumed in the same order as it would be by the single-threaded CPU backend
+                        else if(n.getArchetype().isSimRNGRequired() && !m_Preferences.enableCounterBasedRNG) {
+                            os << "for(unsigned int i = 0; i < group.numNeurons; i++)";
+                            {
+                                CodeStream::Scope b(os);
+
+                                Substitutions popSubs(&funcSubs);
+                                popSubs.addVarSubstitution("id", "i");
+                                popSubs.addVarSubstitution("rng", "rng");
+
+                                simHandler(os, n, popSubs,
+                                           // Emit true spikes
+                                           [this, wuVarUpdateHandler](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &subs)
+                                           {
+                                               // Insert code to emit true spikes
+                                               genEmitSpike(os, ng, subs, true, false);
+
+                                               // Insert code to update WU vars
+                                               wuVarUpdateHandler(os, ng, subs);
+                                           },
+                                           // Emit spike-like events
+                                           [this](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &subs)
+                                           {
+                                               // Insert code to emit spike-like events
+                                               genEmitSpike(os, ng, subs, false, false);
+                                           });
+                            }
+                        }
+                        // Otherwise, divide neurons between threads in contiguous blocks
+                        else {
+                            os << "#pragma omp parallel" << std::endl;
+                            {
+                                CodeStream::Scope b(os);
+                                os << "const unsigned int numThreads = omp_get_num_threads();" << std::endl;
+                                os << "const unsigned int thread = omp_get_thread_num();" << std::endl;
+                                os << "const unsigned int numNeuronsPerThread = (group.numNeurons + numThreads - 1) / numThreads;" << std::endl;
+                                os << "const unsigned int threadStart = std::min(thread * numNeuronsPerThread, group.numNeurons);" << std::endl;
+                                os << "const unsigned int threadEnd = std::min(threadStart + numNeuronsPerThread, group.numNeurons);" << std::endl;
+
+                                // Each thread initially writes spikes into the section of the spike array
+                                // corresponding to its own block of neurons so no synchronisation is required
+                                os << "unsigned int threadSpkCnt = 0;" << std::endl;
+                                if(n.getArchetype().isSpikeEventRequired()) {
+                                    os << "unsigned int threadSpkCntEvnt = 0;" << std::endl;
+                                }
+                                os << std::endl;
+
+                                os << "for(unsigned int i = threadStart; i < threadEnd; i++)";
+                                {
+                                    CodeStream::Scope b(os);
+
+                                    Substitutions popSubs(&funcSubs);
+                                    popSubs.addVarSubstitution("id", "i");
+
+                                    // If this neuron group requires a counter-based simulation RNG, add it to substitutions
+                                    addNeuronSimRNGSubstitution(os, n, popSubs, model.getPrecision());
+
+                                    simHandler(os, n, popSubs,
+                                               // Emit true spikes
+                                               [this, wuVarUpdateHandler](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &subs)
+                                               {
+                                                   // Insert code to emit true spikes
+                                                   genEmitSpike(os, ng, subs, true, true);
+
+                                                   // Insert code to update WU vars
+                                                   wuVarUpdateHandler(os, ng, subs);
+                                               },
+                                               // Emit spike-like events
+                                               [this](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &subs)
+                                               {
+                                                   // Insert code to emit spike-like events
+                                                   genEmitSpike(os, ng, subs, false, true);
+                                               });
+                                }
+
+                                // Compact spikes emitted by each thread into contiguous arrays in thread order
+                                // **NOTE** this means spikes are stored in the same order as the single-threaded CPU backend
+                                os << "#pragma omp for ordered schedule(static, 1)" << std::endl;
+                                os << "for(int t = 0; t < (int)numThreads; t++)";
+                                {
+                                    CodeStream::Scope b(os);
+                                    os << "#pragma omp ordered" << std::endl;
+                                    {
+                                        CodeStream::Scope b(os);
+                                        genCompactSpikes(os, n, true);
+                                        if(n.getArchetype().isSpikeEventRequired()) {
+                                            genCompactSpikes(os, n, false);
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                });
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
+                               SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
+                               SynapseGroupMergedHandler wumEventHandler, SynapseGroupMergedHandler wumProceduralConnectHandler,
+                               SynapseGroupMergedHandler postLearnHandler, SynapseGroupMergedHandler synapseDynamicsHandler,
+                               HostHandler pushEGPHandler, ModuleHandler moduleHandler) const
+{
+    const ModelSpecInternal &model = modelMerged.getModel();
+    os << "void updateSynapses(" << model.getTimePrecision() << " t)";
+    {
+        CodeStream::Scope b(os);
+        Substitutions funcSubs(getCPUFunctions(), model.getPrecision());
+        funcSubs.addVarSubstitution("t", "t");
+
+        // Push any required EGPs
+        pushEGPHandler(os);
+
+        // Synapse dynamics
+        {
+            // Loop through merged synapse dynamics groups
+            Timer t(os, "synapseDynamics", model.isTimingEnabled());
+            for(const auto &s : modelMerged.getMergedSynapseDynamicsGroups()) {
+                genMergedGroup(os, moduleHandler, "SynapseDynamics", s.getIndex(), s.getGroups().size() * model.getBatchSize(), model.getTimePrecision() + " t", "t",
+                    [&](CodeStream &os)
+                    {
+                        os << "// merged synapse dynamics group " << s.getIndex() << std::endl;
+                        os << "for(unsigned int g = 0; g < " << (s.getGroups().size() * model.getBatchSize()) << "; g++)";
+                        {
+                            CodeStream::Scope b(os);
+
+                            // Get reference to group
+                            os << "const auto &group = mergedSynapseDynamicsGroup" << s.getIndex() << "[g]; " << std::endl;
+
+                            // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
+                            if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
+                                os << "const unsigned int preReadDelayOffset = " << s.getPresynapticAxonalDelaySlot() << " * group.numSrcNeurons;" << std::endl;
+                            }
+
+                            // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
+                            if(s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) {
+                                os << "const unsigned int postReadDelayOffset = " << s.getPostsynapticBackPropDelaySlot() << " * group.numTrgNeurons;" << std::endl;
+                            }
+
+                            // If synapse dynamics are a weighted sum, each thread accumulates it for its own block of postsynaptic neurons
+                            // **NOTE** as the weighted sum has no side-effects, this is always safe and, without atomic operations, deterministic
+                            if(isSynapseDynamicsWeightedSum(s.getArchetype())) {
+                                os << "#pragma omp parallel" << std::endl;
+                                {
+                                    CodeStream::Scope b(os);
+                                    genPostsynapticBlock(os);
+                                    genWeightedSumSynapseDynamics(os, s, funcSubs, "postBegin", "postEnd", synapseDynamicsHandler);
+                                }
+                            }
+                            else {
+                                // If synapse dynamics are partitioned, each thread processes all rows but only
+                                // the synapses targetting its own block of postsynaptic neurons
+                                // **NOTE** if synaptic input must be deterministic, CSR synapse groups are updated serially
+                                const bool partitioned = isSynapseDynamicsPartitioned(s.getArchetype());
+                                const bool parallel = !partitioned && !m_Preferences.enableDeterministicSynapticInput;
+                                if(partitioned) {
+                                    os << "#pragma omp parallel" << std::endl;
+                                    os << CodeStream::OB(30);
+                                    genPostsynapticBlock(os);
+                                }
+                                // Otherwise, loop through presynaptic neurons in parallel
+                                else if(parallel) {
+                                    os << "#pragma omp parallel for" << std::endl;
+                                }
+                                os << "for(unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                                {
+                                    // If this synapse group has sparse connectivity, loop through synapses in this row
+                                    // or, if it's partitioned, through this thread's block of postsynaptically-ordered row
+                                    // **NOTE** looping over synapse indices rather than positions within the row lets the compiler
+                                    // see that synapse variables are accessed contiguously and vectorise the loop if it can
+                                    CodeStream::Scope b(os);
+                                    if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                        if(partitioned) {
+                                            genRowRemapSearch(os, s, "i");
+                                            os << "for(; r != rowRemapEnd; r++)";
+                                        }
+                                        else {
+                                            os << "const " << getSynapseIndexType(s.getArchetype()) << " rowStart = " << getSynapseIndexCast(s) << "i * group.rowStride;" << std::endl;
+                                            os << "const " << getSynapseIndexType(s.getArchetype()) << " rowEnd = rowStart + group.rowLength[i];" << std::endl;
+                                            os << "for(" << getSynapseIndexType(s.getArchetype()) << " n = rowStart; n < rowEnd; n++)";
+                                        }
+                                    }
+                                    // Otherwise, if it has CSR connectivity, loop through synapses between this row's pointers
+                                    else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                                        os << "for(" << getSynapseIndexType(s.getArchetype()) << " n = group.rowPtr[i]; n < group.rowPtr[i + 1]; n++)";
+                                    }
+                                    // Otherwise, if it's dense, loop through each postsynaptic neuron (in this thread's block)
+                                    // **NOTE** row start is calculated with 64-bit arithmetic so the compiler can
+                                    // tell that synapse indices within the row don't wrap and vectorise the loop
+                                    else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::DENSE) {
+                                        os << "const uint64_t rowStart = (uint64_t)i * group.numTrgNeurons;" << std::endl;
+                                        os << "for (unsigned int j = " << (partitioned ? "postBegin" : "0") << "; j < " << (partitioned ? "postEnd" : "group.numTrgNeurons") << "; j++)";
+                                    }
+                                    else {
+                                        throw std::runtime_error("Only DENSE, SPARSE and CSR format connectivity can be used for synapse dynamics");
+                                    }
+                                    {
+                                        CodeStream::Scope b(os);
+
+                                        Substitutions synSubs(&funcSubs);
+                                        if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                            // If partitioned, calculate index of synapse
+                                            if(partitioned) {
+                                                os << "const " << getSynapseIndexType(s.getArchetype()) << " n = rowStart + *r;" << std::endl;
+                                            }
+
+                                            // Use synapse index to look up postsynaptic index
+                                            os << "const unsigned int j = group.ind[n];" << std::endl;
+
+                                            // If partitioned, stop once synapses no longer target this thread's block
+                                            if(partitioned) {
+                                                os << "if(j >= postEnd)";
+                                                {
+                                                    CodeStream::Scope b(os);
+                                                    os << "break;" << std::endl;
+                                                }
+                                            }
+
+                                            synSubs.addVarSubstitution("id_syn", "n");
+                                        }
+                                        else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                                            // Use synapse index to look up postsynaptic index
+                                            os << "const unsigned int j = group.ind[n];" << std::endl;
+
+                                            synSubs.addVarSubstitution("id_syn", "n");
+                                        }
+                                        else {
+                                            synSubs.addVarSubstitution("id_syn", "rowStart + j");
+                                        }
+
+                                        // Add pre and postsynaptic indices to substitutions
+                                        synSubs.addVarSubstitution("id_pre", "i");
+                                        synSubs.addVarSubstitution("id_post", "j");
+
+                                        // Add correct functions for apply synaptic input
+                                        // **NOTE** if rows are processed in parallel, multiple threads may be targetting the same postsynaptic neuron so these need to be atomic
+                                        if(s.getArchetype().isDendriticDelayRequired()) {
+                                            synSubs.addFuncSubstitution("addToInSynDelay", 2, parallel ? ("gennAtomicAdd(&group.denDelay[" + s.getDendriticDelayOffset("$(1)") + "j], $(0))")
+                                                                                                       : ("group.denDelay[" + s.getDendriticDelayOffset("$(1)") + "j] += $(0)"));
+                                        }
+                                        else {
+                                            synSubs.addFuncSubstitution("addToInSyn", 1, parallel ? "gennAtomicAdd(&group.inSyn[j], $(0))" : "group.inSyn[j] += $(0)");
+                                        }
+
+                                        // Call synapse dynamics handler
+                                        synapseDynamicsHandler(os, s, synSubs);
+                                    }
+                                }
+                                if(partitioned) {
+                                    os << CodeStream::CB(30);
+                                }
+                            }
+                        }
+                    });
+            }
+        }
+
+        // Presynaptic update
+        {
+            Timer t(os, "presynapticUpdate", model.isTimingEnabled());
+            for(const auto &s : modelMerged.getMergedPresynapticUpdateGroups()) {
+                genMergedGroup(os, moduleHandler, "PresynapticUpdate", s.getIndex(), s.getGroups().size() * model.getBatchSize(), model.getTimePrecision() + " t", "t",
+                    [&](CodeStream &os)
+                    {
+                        os << "// merged presynaptic update group " << s.getIndex() << std::endl;
+
+                        // If procedural connectivity or weights require an RNG, generate table of streams to use for each group
+                        // **NOTE** connectivity is shared between batch instances so they use the same stream
+                        if((s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL) && isProceduralRNGRequired(s.getArchetype())) {
+                            genSynapseRNGStreams(os, "proceduralRNGStreams", model, s, 1);
+                        }
+
+                        os << "for(unsigned int g = 0; g < " << (s.getGroups().size() * model.getBatchSize()) << "; g++)";
+                        {
+                            CodeStream::Scope b(os);
+
+                            // Get reference to group
+                            os << "const auto &group = mergedPresynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
+
+                            // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
+                            if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
+                                os << "const unsigned int preReadDelaySlot = " << s.getPresynapticAxonalDelaySlot() << ";" << std::endl;
+                                os << "const unsigned int preReadDelayOffset = preReadDelaySlot * group.numSrcNeurons;" << std::endl;
+                            }
+
+                            // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
+                            if(s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) {
+                                os << "const unsigned int postReadDelayOffset = " << s.getPostsynapticBackPropDelaySlot() << " * group.numTrgNeurons;" << std::endl;
+                            }
+
+                            // generate the code for processing spike-like events
+                            if (s.getArchetype().isSpikeEventRequired()) {
+                                genPresynapticUpdate(os, modelMerged, s, funcSubs, false, wumThreshHandler, wumEventHandler, wumProceduralConnectHandler);
+                            }
+
+                            // generate the code for processing true spike events
+                            if (s.getArchetype().isTrueSpikeRequired()) {
+                                genPresynapticUpdate(os, modelMerged, s, funcSubs, true, wumThreshHandler, wumSimHandler, wumProceduralConnectHandler);
+                            }
+                            os << std::endl;
+                        }
+                    });
+            }
+        }
+
+        // Postsynaptic update
+        {
+            Timer t(os, "postsynapticUpdate", model.isTimingEnabled());
+            for(const auto &s : modelMerged.getMergedPostsynapticUpdateGroups()) {
+                genMergedGroup(os, moduleHandler, "PostsynapticUpdate", s.getIndex(), s.getGroups().size() * model.getBatchSize(), model.getTimePrecision() + " t", "t",
+                    [&](CodeStream &os)
+                    {
+                        os << "// merged postsynaptic update group " << s.getIndex() << std::endl;
+                        os << "for(unsigned int g = 0; g < " << (s.getGroups().size() * model.getBatchSize()) << "; g++)";
+                        {
+                            CodeStream::Scope b(os);
+
+                            // Get reference to group
+                            os << "const auto &group = mergedPostsynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
+
+                            // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
+                            if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
+                                os << "const unsigned int preReadDelayOffset = " << s.getPresynapticAxonalDelaySlot() << " * group.numSrcNeurons;" << std::endl;
+                            }
+
+                            // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
+                            if(s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) {
+                                os << "const unsigned int postReadDelaySlot = " << s.getPostsynapticBackPropDelaySlot() << ";" << std::endl;
+                                os << "const unsigned int postReadDelayOffset = postReadDelaySlot * group.numTrgNeurons;" << std::endl;
+                            }
+
+                            // Get number of postsynaptic spikes
+                            if (s.getArchetype().getTrgNeuronGroup()->isDelayRequired() && s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired()) {
+                                os << "const unsigned int numSpikes = group.trgSpkCnt[postReadDelaySlot];" << std::endl;
+                            }
+                            else {
+                                os << "const unsigned int numSpikes = group.trgSpkCnt[0];" << std::endl;
+                            }
+
+                            // Loop through postsynaptic spikes in parallel
+                            // **NOTE** each postsynaptic spike updates a distinct column of synapses
+                            os << "#pragma omp parallel for" << std::endl;
+                            os << "for (unsigned int j = 0; j < numSpikes; j++)";
+                            {
+                                CodeStream::Scope b(os);
+
+                                const std::string offsetTrueSpkPost = (s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired() && s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) ? "postReadDelayOffset + " : "";
+                                os << "const unsigned int spike = group.trgSpk[" << offsetTrueSpkPost << "j];" << std::endl;
+
+                                // Loop through column of presynaptic neurons
+                                if (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                    os << "const unsigned int npre = group.colLength[spike];" << std::endl;
+                                    os << "for (unsigned int i = 0; i < npre; i++)";
+                                }
+                                else if (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                                    os << "for (" << getSynapseIndexType(s.getArchetype()) << " i = group.colPtr[spike]; i < group.colPtr[spike + 1]; i++)";
+                                }
+                                else {
+                                    os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                                }
+                                {
+                                    CodeStream::Scope b(os);
+
+                                    Substitutions synSubs(&funcSubs);
+                                    if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                        os << "const " << getSynapseIndexType(s.getArchetype()) << " colMajorIndex = (" << getSynapseIndexCast(s) << "spike * group.colStride) + i;" << std::endl;
+                                        os << "const " << getSynapseIndexType(s.getArchetype()) << " rowMajorIndex = group.remap[colMajorIndex];" << std::endl;
+
+                                        // **TODO** fast divide optimisations
+                                        synSubs.addVarSubstitution("id_pre", "(rowMajorIndex / group.rowStride)");
+                                        synSubs.addVarSubstitution("id_syn", "rowMajorIndex");
+                                    }
+                                    else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                                        os << "const " << getSynapseIndexType(s.getArchetype()) << " rowMajorIndex = group.remap[i];" << std::endl;
+
+                                        // Presynaptic index is that of the last row starting at or before synapse
+                                        synSubs.addVarSubstitution("id_pre", "((unsigned int)(std::upper_bound(group.rowPtr, group.rowPtr + group.numSrcNeurons + 1, rowMajorIndex) - group.rowPtr) - 1)");
+                                        synSubs.addVarSubstitution("id_syn", "rowMajorIndex");
+                                    }
+                                    else {
+                                        synSubs.addVarSubstitution("id_pre", "i");
+                                        synSubs.addVarSubstitution("id_syn", "((" + getSynapseIndexCast(s) + "group.numTrgNeurons * i) + spike)");
+                                    }
+                                    synSubs.addVarSubstitution("id_post", "spike");
+
+                                    postLearnHandler(os, s, synSubs);
+                                }
+                            }
+                            os << std::endl;
+                        }
+                    });
+            }
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
+                      NeuronGroupMergedHandler localNGHandler, SynapseGroupMergedHandler sgDenseInitHandler,
+                      SynapseGroupMergedHandler sgSparseConnectHandler, SynapseGroupMergedHandler sgSparseInitHandler,
+                      HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler, ModuleHandler moduleHandler) const
+{
+    const ModelSpecInternal &model = modelMerged.getModel();
+    os << "void initialize()";
+    {
+        CodeStream::Scope b(os);
+        Substitutions funcSubs(getCPUFunctions(), model.getPrecision());
+
+        // Push any required EGPs
+        initPushEGPHandler(os);
+
+        Timer t(os, "init", model.isTimingEnabled());
+
+        // If model requires a host RNG
+        if(isGlobalRNGRequired(modelMerged)) {
+            // If no seed is specified, use system randomness to generate seed sequence
+            CodeStream::Scope b(os);
+            if (model.getSeed() == 0) {
+                os << "uint32_t seedData[std::mt19937::state_size];" << std::endl;
+                os << "std::random_device seedSource;" << std::endl;
+                {
+                    CodeStream::Scope b(os);
+                    os << "for(int i = 0; i < std::mt19937::state_size; i++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "seedData[i] = seedSource();" << std::endl;
+                    }
+                }
+                os << "std::seed_seq seeds(std::begin(seedData), std::end(seedData));" << std::endl;
+            }
+            // Otherwise, create a seed sequence from model seed
+            // **NOTE** this is a terrible idea see http://www.pcg-random.org/posts/cpp-seeding-surprises.html
+            else {
+                os << "std::seed_seq seeds{" << model.getSeed() << "};" << std::endl;
+            }
+
+            // Seed RNG from seed sequence
+            os << "rng.seed(seeds);" << std::endl;
+        }
+
+        // If a counter-based RNG is required, set key used to generate all Philox RNG streams
+        if(isPhiloxRNGRequired(modelMerged)) {
+            if(model.getSeed() == 0) {
+                os << "philoxRNGKey = std::random_device()();" << std::endl;
+            }
+            else {
+                os << "philoxRNGKey = " << model.getSeed() << ";" << std::endl;
+            }
+        }
+        os << std::endl;
+
+        // **NOTE** RNG is only added to the substitutions of groups which require it. As the global RNG cannot be shared between
+        // threads, genVariableInit and genSynapseVariableRowInit only generate parallel loops if there is no RNG substitution
+
+        os << "// ------------------------------------------------------------------------" << std::endl;
+        os << "// Local neuron groups" << std::endl;
+        for(const auto &n : modelMerged.getMergedNeuronInitGroups()) {
+            genMergedGroup(os, moduleHandler, "NeuronInit", n.getIndex(), n.getGroups().size() * model.getBatchSize(), "", "",
+                [&](CodeStream &os)
+                {
+                    os << "// merged neuron init group " << n.getIndex() << std::endl;
+                    os << "for(unsigned int g = 0; g < " << (n.getGroups().size() * model.getBatchSize()) << "; g++)";
+                    {
+                        CodeStream::Scope b(os);
+
+                        // Get reference to group
+                        os << "const auto &group = mergedNeuronInitGroup" << n.getIndex() << "[g]; " << std::endl;
+                        Substitutions popSubs(&funcSubs);
+                        if(isNeuronInitRNGRequired(n.getArchetype())) {
+                            popSubs.addVarSubstitution("rng", "rng");
+                        }
+                        localNGHandler(os, n, popSubs);
+                    }
+                });
+        }
+
+        os << "// ------------------------------------------------------------------------" << std::endl;
+        os << "// Synapse groups with dense connectivity" << std::endl;
+        for(const auto &s : modelMerged.getMergedSynapseDenseInitGroups()) {
+            genMergedGroup(os, moduleHandler, "SynapseDenseInit", s.getIndex(), s.getGroups().size() * model.getBatchSize(), "", "",
+                [&](CodeStream &os)
+                {
+                    os << "// merged synapse dense init group " << s.getIndex() << std::endl;
+                    os << "for(unsigned int g = 0; g < " << (s.getGroups().size() * model.getBatchSize()) << "; g++)";
+                    {
+                        CodeStream::Scope b(os);
+
+                        // Get reference to group
+                        os << "const auto &group = mergedSynapseDenseInitGroup" << s.getIndex() << "[g]; " << std::endl;
+                        Substitutions popSubs(&funcSubs);
+                        if(s.getArchetype().isWUInitRNGRequired()) {
+                            popSubs.addVarSubstitution("rng", "rng");
+                        }
+                        sgDenseInitHandler(os, s, popSubs);
+                    }
+                });
+        }
+
+        os << "// ------------------------------------------------------------------------" << std::endl;
+        os << "// Synapse groups with sparse connectivity" << std::endl;
+        for(const auto &s : modelMerged.getMergedSynapseConnectivityInitGroups()) {
+            genMergedGroup(os, moduleHandler, "SynapseConnectivityInit", s.getIndex(), s.getGroups().size(), "", "",
+                [&](CodeStream &os)
+                {
+                    os << "// merged synapse connectivity init group " << s.getIndex() << std::endl;
+
+                    // If rows are built using counter-based RNGs, generate table of streams to use for each group
+                    // **NOTE** second word of key is 0xFFFFFFFF for connectivity initialisation streams
+                    const bool philoxRNGRequired = isConnectivityInitPhiloxRNGRequired(s.getArchetype());
+                    if(philoxRNGRequired) {
+                        genSynapseRNGStreams(os, "connectivityRNGStreams", model, s, 1);
+                    }
+
+                    // If connectivity can be cached, generate table of files to cache each group's connectivity in
+                    const bool cacheConnectivity = isConnectivityCacheable(model, s.getArchetype());
+                    if(cacheConnectivity) {
+                        genConnectivityCacheFiles(os, model, s);
+                    }
+                    os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+                    {
+                        CodeStream::Scope b(os);
+
+                        // Get reference to group
+                        os << "const auto &group = mergedSynapseConnectivityInitGroup" << s.getIndex() << "[g]; " << std::endl;
+
+                        // If connectivity can be cached, try to read it from cache
+                        if(cacheConnectivity) {
+                            genReadConnectivityCache(os, s);
+                        }
+
+                        // Is an RNG required to build this group's connectivity
+                        const bool rngRequired = Utils::isRNGRequired(s.getArchetype().getConnectivityInitialiser().getSnippet()->getRowBuildCode());
+
+                        // If matrix connectivity is ragged
+                        if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                            // Zero row lengths
+                            os << "memset(group.rowLength, 0, group.numSrcNeurons * sizeof(unsigned int));" << std::endl;
+
+                            // If no RNG is required or each row has its own RNG stream, rows are independent so loop through source neurons in parallel
+                            if(!rngRequired || philoxRNGRequired) {
+                                os << "#pragma omp parallel for" << std::endl;
+                            }
+                            os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                            {
+                                CodeStream::Scope b(os);
+
+                                Substitutions popSubs(&funcSubs);
+                                if(philoxRNGRequired) {
+                                    os << "PhiloxRNG connectRNG(philoxRNGKey, 0xFFFFFFFFu, i, connectivityRNGStreams[g], 0);" << std::endl;
+                                    popSubs.addVarSubstitution("rng", "connectRNG");
+                                    addCounterBasedRNGFunctionSubstitutions(popSubs, model.getPrecision());
+                                }
+                                else if(rngRequired) {
+                                    popSubs.addVarSubstitution("rng", "rng");
+                                }
+                                popSubs.addVarSubstitution("id_pre", "i");
+                                popSubs.addVarSubstitution("id_post_begin", "0");
+                                popSubs.addVarSubstitution("id_thread", "0");
+                                popSubs.addVarSubstitution("num_threads", "1");
+                                popSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
+
+                                // Add function to increment row length and insert synapse into ind array
+                                popSubs.addFuncSubstitution("addSynapse", 1,
+                                                            "group.ind[(" + getSynapseIndexCast(s) + "i * group.rowStride) + (group.rowLength[i]++)] = $(0)");
+
+                                sgSparseConnectHandler(os, s, popSubs);
+                            }
+
+                        }
+                        // Otherwise, if matrix connectivity is CSR
+                        else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                            // First row starts at first synapse
+                            os << "group.rowPtr[0] = 0;" << std::endl;
+
+                            // Loop through source neurons
+                            // **NOTE** each row starts where the previous one ended so this is always done serially
+                            os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                            {
+                                CodeStream::Scope b(os);
+
+                                // Row is initially empty
+                                os << "group.rowPtr[i + 1] = group.rowPtr[i];" << std::endl;
+
+                                Substitutions popSubs(&funcSubs);
+                                if(rngRequired) {
+                                    popSubs.addVarSubstitution("rng", "rng");
+                                }
+                                popSubs.addVarSubstitution("id_pre", "i");
+                                popSubs.addVarSubstitution("id_post_begin", "0");
+                                popSubs.addVarSubstitution("id_thread", "0");
+                                popSubs.addVarSubstitution("num_threads", "1");
+                                popSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
+
+                                // Add function to insert synapse into ind array and advance end of row
+                                // **NOTE** rows are stored back-to-back so check there is space for another synapse before inserting it
+                                popSubs.addFuncSubstitution("addSynapse", 1,
+                                                            "group.ind[(group.rowPtr[i + 1] < group.maxSynapses) ? group.rowPtr[i + 1]++ : "
+                                                            "throw std::runtime_error(\"CSR connectivity has more synapses than allocated - increase using SynapseGroup::setMaxSynapses\")] = $(0)");
+
+                                sgSparseConnectHandler(os, s, popSubs);
+                            }
+                        }
+                        // Otherwise, if matrix connectivity is a bitmask
+                        else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+                            // Zero memory before setting sparse bits
+                            os << "const size_t gpSize = ((((size_t)group.numSrcNeurons * (size_t)group.rowStride) + 32 - 1) / 32);" << std::endl;
+                            os << "memset(group.gp, 0, gpSize * sizeof(uint32_t));" << std::endl;
+
+                            // Loop through source neurons
+                            // **NOTE** rows may share words of the bitmask so this is always done serially
+                            os << "for(unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                            {
+                                // Calculate index of bit at start of this row
+                                CodeStream::Scope b(os);
+                                os << "const uint64_t rowStartGID = (uint64_t)i * group.rowStride;" << std::endl;
+
+                                // Build function template to set correct bit in bitmask
+                                Substitutions popSubs(&funcSubs);
+                                if(rngRequired) {
+                                    popSubs.addVarSubstitution("rng", "rng");
+                                }
+                                popSubs.addVarSubstitution("id_pre", "i");
+                                popSubs.addVarSubstitution("id_post_begin", "0");
+                                popSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
+
+                                // Add function to increment row length and insert synapse into ind array
+                                popSubs.addFuncSubstitution("addSynapse", 1,
+                                                            "setB(group.gp[(rowStartGID + $(0)) / 32], (rowStartGID + $(0)) & 31)");
+
+                                sgSparseConnectHandler(os, s, popSubs);
+                            }
+                        }
+                        else {
+                            throw std::runtime_error("Only BITMASK, SPARSE and CSR format connectivity can be generated using a connectivity initialiser");
+                        }
+
+                        // If connectivity can be cached, write the connectivity that's just been built to cache
+                        if(cacheConnectivity) {
+                            genWriteConnectivityCache(os, s);
+                        }
+                    }
+                });
+        }
+    }
+    os << std::endl;
+    os << "void initializeSparse()";
+    {
+        CodeStream::Scope b(os);
+        Substitutions funcSubs(getCPUFunctions(), model.getPrecision());
+
+        // Push any required EGPs
+        initSparsePushEGPHandler(os);
+
+        Timer t(os, "initSparse", model.isTimingEnabled());
+
+        os << "// ------------------------------------------------------------------------" << std::endl;
+        os << "// Synapse groups with sparse connectivity" << std::endl;
+        for(const auto &s : modelMerged.getMergedSynapseSparseInitGroups()) {
+            genMergedGroup(os, moduleHandler, "SynapseSparseInit", s.getIndex(), s.getGroups().size() * model.getBatchSize(), "", "",
+                [&](CodeStream &os)
+                {
+                    os << "// merged sparse synapse init group " << s.getIndex() << std::endl;
+
+                    // If rows are initialised using counter-based RNGs, generate table of streams to use for each group
+                    // **NOTE** second word of key is 0xFFFFFFFE for sparse variable initialisation streams
+                    const bool philoxRNGRequired = isSparseInitPhiloxRNGRequired(s.getArchetype());
+                    if(philoxRNGRequired) {
+                        genSynapseRNGStreams(os, "sparseInitRNGStreams", model, s, model.getBatchSize());
+                    }
+                    os << "for(unsigned int g = 0; g < " << (s.getGroups().size() * model.getBatchSize()) << "; g++)";
+                    {
+                        CodeStream::Scope b(os);
+
+                        // Get reference to group
+                        os << "const auto &group = mergedSynapseSparseInitGroup" << s.getIndex() << "[g]; " << std::endl;
+
+                        // If model is batched, connectivity and hence column-major remapping is shared so only build it for the first batch instance
+                        const std::string firstBatchCondition = (model.getBatchSize() > 1) ? ("if((g % " + std::to_string(model.getBatchSize()) + ") == 0) ") : "";
+
+                        // If no RNG is required or each row has its own RNG stream, rows can be initialised in parallel
+                        const bool csr = (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR);
+                        const bool rngRequired = Utils::isRNGRequired(s.getArchetype().getWUVarInitialisers());
+                        if(s.getArchetype().isWUVarInitRequired()) {
+                            os << "// Loop through presynaptic neurons" << std::endl;
+                            if(!rngRequired || philoxRNGRequired) {
+                                os << "#pragma omp parallel for" << std::endl;
+                            }
+                            os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)" << std::endl;
+                            {
+                                CodeStream::Scope b(os);
+
+                                // Generate sparse initialisation code
+                                Substitutions popSubs(&funcSubs);
+                                if(philoxRNGRequired) {
+                                    os << "PhiloxRNG initRNG(philoxRNGKey, 0xFFFFFFFEu, i, sparseInitRNGStreams[g], 0);" << std::endl;
+                                    popSubs.addVarSubstitution("rng", "initRNG");
+                                    addCounterBasedRNGFunctionSubstitutions(popSubs, model.getPrecision());
+                                }
+                                else if(rngRequired) {
+                                    popSubs.addVarSubstitution("rng", "rng");
+                                }
+                                popSubs.addVarSubstitution("id_pre", "i");
+                                popSubs.addVarSubstitution("row_len", csr ? "(group.rowPtr[i + 1] - group.rowPtr[i])" : "group.rowLength[i]");
+                                sgSparseInitHandler(os, s, popSubs);
+                            }
+                        }
+
+                        // If presynaptic update is partitioned by postsynaptic neuron, sort each row into postsynaptic order
+                        if(isRowRemapRequired(s.getArchetype())) {
+                            os << firstBatchCondition;
+                            CodeStream::Scope b(os);
+                            genRowRemap(os, s);
+                        }
+
+                        // If postsynaptic learning is required, build column-major remapping
+                        if(!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
+                            os << firstBatchCondition;
+                            CodeStream::Scope b(os);
+                            genColumnRemap(os, s, csr);
+                        }
+                    }
+                });
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genColumnRemap(CodeStream &os, const SynapseGroupMerged &sg, bool csr) const
+{
+    // **NOTE** each thread counts and then places the synapses in a contiguous block of rows and each thread's
+    // synapses are placed after those of lower-numbered threads so, within each column, synapses remain in
+    // row-major order and the remapping is identical whatever the number of threads
+    const std::string indexType = getSynapseIndexType(sg.getArchetype());
+    os << "// Build column-major remapping with a parallel counting sort" << std::endl;
+    os << "std::vector<unsigned int> threadColCount((size_t)omp_get_max_threads() * group.numTrgNeurons, 0);" << std::endl;
+    os << "#pragma omp parallel" << std::endl;
+    {
+        CodeStream::Scope b(os);
+        os << "const unsigned int numThreads = omp_get_num_threads();" << std::endl;
+        os << "const unsigned int thread = omp_get_thread_num();" << std::endl;
+        os << "const unsigned int rowBegin = (unsigned int)(((uint64_t)group.numSrcNeurons * thread) / numThreads);" << std::endl;
+        os << "const unsigned int rowEnd = (unsigned int)(((uint64_t)group.numSrcNeurons * (thread + 1)) / numThreads);" << std::endl;
+        os << "unsigned int *colCount = &threadColCount[(size_t)thread * group.numTrgNeurons];" << std::endl;
+
+        os << "// Count synapses in this thread's rows targetting each postsynaptic neuron" << std::endl;
+        if(csr) {
+            os << "for (" << indexType << " n = group.rowPtr[rowBegin]; n < group.rowPtr[rowEnd]; n++)";
+            {
+                CodeStream::Scope b(os);
+                os << "colCount[group.ind[n]]++;" << std::endl;
+            }
+        }
+        else {
+            os << "for (unsigned int i = rowBegin; i < rowEnd; i++)";
+            {
+                CodeStream::Scope b(os);
+                os << "for (unsigned int j = 0; j < group.rowLength[i]; j++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "colCount[group.ind[(" << getSynapseIndexCast(sg) << "i * group.rowStride) + j]]++;" << std::endl;
+                }
+            }
+        }
+        os << "#pragma omp barrier" << std::endl;
+
+        os << "// Convert each thread's counts into offsets within each column and calculate column lengths" << std::endl;
+        os << "#pragma omp for" << std::endl;
+        os << "for (unsigned int j = 0; j < group.numTrgNeurons; j++)";
+        {
+            CodeStream::Scope b(os);
+            os << "unsigned int colLength = 0;" << std::endl;
+            os << "for (unsigned int t = 0; t < numThreads; t++)";
+            {
+                CodeStream::Scope b(os);
+                os << "unsigned int &count = threadColCount[((size_t)t * group.numTrgNeurons) + j];" << std::endl;
+                os << "const unsigned int threadCount = count;" << std::endl;
+                os << "count = colLength;" << std::endl;
+                os << "colLength += threadCount;" << std::endl;
+            }
+            os << (csr ? "group.colPtr[j + 1] = colLength;" : "group.colLength[j] = colLength;") << std::endl;
+        }
+
+        // If connectivity is CSR, convert column lengths into pointers to the start of each column
+        // **NOTE** there is an implicit barrier at the end of both omp for and omp single
+        if(csr) {
+            os << "// Convert column lengths into pointers to the start of each column" << std::endl;
+            os << "#pragma omp single" << std::endl;
+            {
+                CodeStream::Scope b(os);
+                os << "group.colPtr[0] = 0;" << std::endl;
+                os << "for (unsigned int j = 0; j < group.numTrgNeurons; j++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "group.colPtr[j + 1] += group.colPtr[j];" << std::endl;
+                }
+            }
+        }
+
+        os << "// Add remapping entries for this thread's rows" << std::endl;
+        if(csr) {
+            os << "for (" << indexType << " n = group.rowPtr[rowBegin]; n < group.rowPtr[rowEnd]; n++)";
+            {
+                CodeStream::Scope b(os);
+                os << "const unsigned int postIndex = group.ind[n];" << std::endl;
+                os << "group.remap[group.colPtr[postIndex] + colCount[postIndex]++] = n;" << std::endl;
+            }
+        }
+        else {
+            os << "for (unsigned int i = rowBegin; i < rowEnd; i++)";
+            {
+                CodeStream::Scope b(os);
+                os << "for (unsigned int j = 0; j < group.rowLength[i]; j++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "const " << indexType << " rowMajorIndex = (" << getSynapseIndexCast(sg) << "i * group.rowStride) + j;" << std::endl;
+                    os << "const unsigned int postIndex = group.ind[rowMajorIndex];" << std::endl;
+                    os << "group.remap[(" << getSynapseIndexCast(sg) << "postIndex * group.colStride) + colCount[postIndex]++] = rowMajorIndex;" << std::endl;
+                }
+            }
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genRowRemap(CodeStream &os, const SynapseGroupMerged &sg) const
+{
+    // **NOTE** the connectivity itself is left untouched so synapse indices and variables are unaffected and a stable sort
+    // is used so synapses targetting the same postsynaptic neuron are processed in the same order as the original row
+    const std::string indexType = getSynapseIndexType(sg.getArchetype());
+    os << "// Build remapping of each row into postsynaptic order" << std::endl;
+    os << "#pragma omp parallel for" << std::endl;
+    os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)";
+    {
+        CodeStream::Scope b(os);
+        os << "const " << indexType << " rowStart = " << getSynapseIndexCast(sg) << "i * group.rowStride;" << std::endl;
+        os << "unsigned int *rowRemap = &group.rowRemap[rowStart];" << std::endl;
+        os << "std::iota(rowRemap, rowRemap + group.rowLength[i], 0u);" << std::endl;
+
+        // Most connectivity initialisation snippets generate rows in postsynaptic order so only sort rows which aren't
+        os << "if(!std::is_sorted(&group.ind[rowStart], &group.ind[rowStart] + group.rowLength[i]))";
+        {
+            CodeStream::Scope b(os);
+            os << "std::stable_sort(rowRemap, rowRemap + group.rowLength[i]," << std::endl;
+            os << "                 [&group, rowStart](unsigned int a, unsigned int b){ return group.ind[rowStart + a] < group.ind[rowStart + b]; });" << std::endl;
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genRowRemapSearch(CodeStream &os, const SynapseGroupMerged &sg, const std::string &row) const
+{
+    os << "const " << getSynapseIndexType(sg.getArchetype()) << " rowStart = " << getSynapseIndexCast(sg) << row << " * group.rowStride;" << std::endl;
+    os << "const unsigned int *rowRemap = &group.rowRemap[rowStart];" << std::endl;
+    os << "const unsigned int *rowRemapEnd = rowRemap + group.rowLength[" << row << "];" << std::endl;
+    os << "const unsigned int *r = std::lower_bound(rowRemap, rowRemapEnd, postBegin," << std::endl;
+    os << "                                         [&group, rowStart](unsigned int j, unsigned int post){ return group.ind[rowStart + j] < post; });" << std::endl;
+}
+//--------------------------------------------------------------------------
+void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
+{
+    os << "// OpenMP includes" << std::endl;
+    os << "#include <omp.h>" << std::endl;
+    os << std::endl;
+
+    // Define functions to atomically add to postsynaptic input
+    // **NOTE** atomic pragmas cannot be inserted into the middle of user code so these are wrapped in functions
+    const std::string &precision = modelMerged.getModel().getPrecision();
+    os << "inline void gennAtomicAdd(" << precision << " *address, " << precision << " val)";
+    {
+        CodeStream::Scope b(os);
+        os << "#pragma omp atomic" << std::endl;
+        os << "*address += val;" << std::endl;
+    }
+    os << std::endl;
+
+    BackendCPU::genDefinitionsInternalPreamble(os, modelMerged);
+}
+//--------------------------------------------------------------------------
+void Backend::genVariableInit(CodeStream &os, const std::string &count, const std::string &indexVarName,
+                              const Substitutions &kernelSubs, Handler handler) const
+{
+    // If the global RNG isn't required, initialise variables in parallel
+    if(!kernelSubs.hasVarSubstitution("rng")) {
+        os << "#pragma omp parallel for" << std::endl;
+    }
+    os << "for (unsigned i = 0; i < (" << count << "); i++)";
+    {
+        CodeStream::Scope b(os);
+
+        Substitutions varSubs(&kernelSubs);
+        varSubs.addVarSubstitution(indexVarName, "i");
+        handler(os, varSubs);
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genSynapseVariableRowInit(CodeStream &os, const SynapseGroupMerged &sg, 
+                                        const Substitutions &kernelSubs, Handler handler) const
+{
+    // **NOTE** sparse rows are initialised in parallel by genInit so only
+    // parallelise dense rows, providing the global RNG isn't required
+    if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+        os << "for (unsigned j = 0; j < group.rowLength[" << kernelSubs["id_pre"] << "]; j++)";
+    }
+    else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+        os << "for (" << getSynapseIndexType(sg.getArchetype()) << " j = group.rowPtr[" << kernelSubs["id_pre"] << "]; j < group.rowPtr[" << kernelSubs["id_pre"] << " + 1]; j++)";
+    }
+    else {
+        if(!kernelSubs.hasVarSubstitution("rng")) {
+            os << "#pragma omp parallel for" << std::endl;
+        }
+        os << "for (unsigned j = 0; j < group.numTrgNeurons; j++)";
+    }
+    {
+        CodeStream::Scope b(os);
+
+        Substitutions varSubs(&kernelSubs);
+        if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+            varSubs.addVarSubstitution("id_syn", "(" + getSynapseIndexCast(sg) + kernelSubs["id_pre"] + " * group.rowStride) + j");
+            varSubs.addVarSubstitution("id_post", "group.ind[(" + getSynapseIndexCast(sg) + kernelSubs["id_pre"] + " * group.rowStride) + j]");
+        }
+        else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+            varSubs.addVarSubstitution("id_syn", "j");
+            varSubs.addVarSubstitution("id_post", "group.ind[j]");
+        }
+        else {
+            varSubs.addVarSubstitution("id_syn", "(" + getSynapseIndexCast(sg) + kernelSubs["id_pre"] + " * group.rowStride) + j");
+            varSubs.addVarSubstitution("id_post", "j");
+        }
+        handler(os, varSubs);
+    }
+}
+//--------------------------------------------------------------------------
+bool Backend::isRowRemapRequired(const SynapseGroupInternal &sg) const
+{
+    return ((isPresynapticUpdatePartitioned(sg) || isSynapseDynamicsPartitioned(sg))
+            && (sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE));
+}
+//--------------------------------------------------------------------------
+bool Backend::isPresynapticUpdatePartitioned(const SynapseGroupInternal &sg) const
+{
+    // **NOTE** procedural rows are generated sequentially and CSR rows aren't padded so these always use atomic updates
+    return ((m_Preferences.enablePostsynapticPartitioning || m_Preferences.enableDeterministicSynapticInput)
+            && ((sg.getMatrixType() & SynapseMatrixConnectivity::DENSE)
+                || (sg.getMatrixType() & SynapseMatrixConnectivity::BITMASK)
+                || (sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE)));
+}
+//--------------------------------------------------------------------------
+bool Backend::isSynapseDynamicsPartitioned(const SynapseGroupInternal &sg) const
+{
+    // **NOTE** partitioning means every thread processes every row so synapse dynamics which modify presynaptic variables would race.
+    // DENSE synapse dynamics are therefore only partitioned when postsynaptic partitioning is enabled, in which case
+    // each thread's block of every row can be vectorised without atomic operations. SPARSE synapse dynamics are only partitioned
+    // when they need to be deterministic as, otherwise, parallelising across rows means there is much less contention between
+    // threads than for presynaptic updates
+    return (!sg.getWUModel()->getSynapseDynamicsCode().empty()
+            && (((m_Preferences.enablePostsynapticPartitioning || m_Preferences.enableDeterministicSynapticInput) && (sg.getMatrixType() & SynapseMatrixConnectivity::DENSE))
+                || (m_Preferences.enableDeterministicSynapticInput && (sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE))));
+}
+//--------------------------------------------------------------------------
+void Backend::genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const SynapseGroupMerged &sg, const Substitutions &popSubs,
+                                   bool trueSpike, SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
+                                   SynapseGroupMergedHandler wumProceduralConnectHandler) const
+{
+    // If postsynaptic neurons are partitioned between threads, use alternative strategy
+    if(isPresynapticUpdatePartitioned(sg.getArchetype())) {
+        genPartitionedPresynapticUpdate(os, modelMerged, sg, popSubs, trueSpike, wumThreshHandler, wumSimHandler);
+        return;
+    }
+
+    // Otherwise, process spikes in parallel
+    // **NOTE** if synaptic input must be deterministic, the remaining (CSR and PROCEDURAL) groups are updated serially
+    genRowPresynapticUpdate(os, modelMerged, sg, popSubs, trueSpike, !m_Preferences.enableDeterministicSynapticInput,
+                            wumThreshHandler, wumSimHandler, wumProceduralConnectHandler);
+}
+//--------------------------------------------------------------------------
+void Backend::genPartitionedPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const SynapseGroupMerged &sg, const Substitutions &popSubs,
+                                              bool trueSpike, SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler) const
+{
+    // Get suffix based on type of events
+    const std::string eventSuffix = trueSpike ? "" : "Evnt";
+    const auto *wu = sg.getArchetype().getWUModel();
+
+    // **NOTE** every thread processes every event but only updates synapses targetting its own
+    // contiguous block of postsynaptic neurons so input can be accumulated without atomics
+    os << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << " with postsynaptic neurons partitioned between threads" << std::endl;
+    os << "#pragma omp parallel" << std::endl;
+    {
+        CodeStream::Scope b(os);
+        genPostsynapticBlock(os);
+
+        if (sg.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
+            os << "for (unsigned int i = 0; i < group.srcSpkCnt" << eventSuffix << "[preReadDelaySlot]; i++)";
+        }
+        else {
+            os << "for (unsigned int i = 0; i < group.srcSpkCnt" << eventSuffix << "[0]; i++)";
+        }
+        {
+            CodeStream::Scope b(os);
+            if (!wu->getSimSupportCode().empty()) {
+                os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) <<  ";" << std::endl;
+            }
+
+            const std::string queueOffset = sg.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "preReadDelayOffset + " : "";
+            os << "const unsigned int ipre = group.srcSpk" << eventSuffix << "[" << queueOffset << "i];" << std::endl;
+
+            // If this is a spike-like event, insert threshold check for this presynaptic neuron
+            if (!trueSpike) {
+                os << "if(";
+
+                Substitutions threshSubs(&popSubs);
+                threshSubs.addVarSubstitution("id_pre", "ipre");
+
+                // Generate weight update threshold condition
+                wumThreshHandler(os, sg, threshSubs);
+
+                os << ")";
+                os << CodeStream::OB(10);
+            }
+
+            Substitutions synSubs(&popSubs);
+            synSubs.addVarSubstitution("id_pre", "ipre");
+            synSubs.addVarSubstitution("id_post", "ipost");
+            synSubs.addVarSubstitution("id_syn", "synAddress");
+
+            if(sg.getArchetype().isDendriticDelayRequired()) {
+                synSubs.addFuncSubstitution("addToInSynDelay", 2, "group.denDelay[" + sg.getDendriticDelayOffset("$(1)") + "ipost] += $(0)");
+            }
+            else {
+                synSubs.addFuncSubstitution("addToInSyn", 1, "group.inSyn[ipost] += $(0)");
+            }
+
+            if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                genRowRemapSearch(os, sg, "ipre");
+                os << "for (; r != rowRemapEnd; r++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "const " << getSynapseIndexType(sg.getArchetype()) << " synAddress = rowStart + *r;" << std::endl;
+                    os << "const unsigned int ipost = group.ind[synAddress];" << std::endl;
+                    os << "if(ipost >= postEnd)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "break;" << std::endl;
+                    }
+
+                    wumSimHandler(os, sg, synSubs);
+                }
+            }
+            // Otherwise (DENSE or BITMASK)
+            else {
+                os << "for (unsigned int ipost = postBegin; ipost < postEnd; ipost++)";
+                {
+                    CodeStream::Scope b(os);
+
+                    // **NOTE** if bitmask optimisations are enabled, rows of bitmask are padded to a whole number of words
+                    if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+                        const std::string bitmaskStride = m_Preferences.enableBitmaskOptimisations ? "(((group.numTrgNeurons + 32 - 1) / 32) * 32)" : "group.numTrgNeurons";
+                        os << "const uint64_t gid = (ipre * (uint64_t)" << bitmaskStride << " + ipost);" << std::endl;
+                        os << "if (B(group.gp[gid / 32], gid & 31))" << CodeStream::OB(20);
+                    }
+
+                    os << "const " << getSynapseIndexType(sg.getArchetype()) << " synAddress = (" << getSynapseIndexCast(sg) << "ipre * group.numTrgNeurons) + ipost;" << std::endl;
+
+                    wumSimHandler(os, sg, synSubs);
+
+                    if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+                        os << CodeStream::CB(20);
+                    }
+                }
+            }
+
+            // If this is a spike-like event, close braces around threshold check
+            if (!trueSpike) {
+                os << CodeStream::CB(10);
+            }
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genEmitSpike(CodeStream &os, const NeuronGroupMerged &ng, const Substitutions &subs, bool trueSpike, bool parallel) const
+{
+    // Determine if delay is required and thus, at what offset we should write into the spike queue
+    const bool spikeDelayRequired = trueSpike ? (ng.getArchetype().isDelayRequired() && ng.getArchetype().isTrueSpikeRequired()) : ng.getArchetype().isDelayRequired();
+    const std::string spikeQueueOffset = spikeDelayRequired ? "writeDelayOffset + " : "";
+
+    const std::string suffix = trueSpike ? "" : "Evnt";
+
+    // If neurons are being updated in parallel, write spike into this thread's section of spike array
+    if(parallel) {
+        os << "group.spk" << suffix << "[" << spikeQueueOffset << "threadStart + threadSpkCnt" << suffix << "++]";
+    }
+    // Otherwise, write directly to end of spike array
+    else {
+        os << "group.spk" << suffix << "[" << spikeQueueOffset << "group.spkCnt" << suffix;
+        if(spikeDelayRequired) { // WITH DELAY
+            os << "[*group.spkQuePtr]++]";
+        }
+        else { // NO DELAY
+            os << "[0]++]";
+        }
+    }
+    os << " = " << subs["id"] << ";" << std::endl;
+
+    // Reset spike time if this is a true spike and spike time is required
+    if(trueSpike && ng.getArchetype().isSpikeTimeRequired()) {
+        const std::string queueOffset = ng.getArchetype().isDelayRequired() ? "writeDelayOffset + " : "";
+        os << "group.sT[" << queueOffset << subs["id"] << "] = " << subs["t"] << ";" << std::endl;
+    }
+
+    // If this is a true spike and spike recording is enabled, set neuron's bit in this timestep's recording words
+    // **NOTE** threads' blocks of neurons can share recording words so, if neurons are being updated in parallel, update atomically
+    if(trueSpike && ng.getArchetype().isSpikeRecordingEnabled()) {
+        if(parallel) {
+            os << "#pragma omp atomic" << std::endl;
+        }
+        os << "group.recordSpk[recordingOffset + (" << subs["id"] << " / 32)] |= (1u << (" << subs["id"] << " % 32));" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genCompactSpikes(CodeStream &os, const NeuronGroupMerged &ng, bool trueSpike) const
+{
+    // Determine if delay is required and thus, at what offset spikes are written into the spike queue
+    const bool spikeDelayRequired = trueSpike ? (ng.getArchetype().isDelayRequired() && ng.getArchetype().isTrueSpikeRequired()) : ng.getArchetype().isDelayRequired();
+    const std::string spikeQueueOffset = spikeDelayRequired ? "writeDelayOffset + " : "";
+
+    const std::string suffix = trueSpike ? "" : "Evnt";
+    const std::string spikeCount = "group.spkCnt" + suffix + (spikeDelayRequired ? "[*group.spkQuePtr]" : "[0]");
+
+    // Move this thread's spikes down to the end of those emitted by the preceding threads
+    // **NOTE** destination always lies at or below this thread's section so this never overwrites spikes from subsequent threads
+    os << "std::memmove(&group.spk" << suffix << "[" << spikeQueueOffset << spikeCount << "], ";
+    os << "&group.spk" << suffix << "[" << spikeQueueOffset << "threadStart], ";
+    os << "threadSpkCnt" << suffix << " * sizeof(unsigned int));" << std::endl;
+    os << spikeCount << " += threadSpkCnt" << suffix << ";" << std::endl;
+}
+}   // namespace OpenMP
+}   // namespace CodeGenerator
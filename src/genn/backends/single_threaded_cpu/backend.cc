@@ -2,6 +2,7 @@
 
 // Standard C++ include
 #include <random>
+#include <stdexcept>
 
 // GeNN includes
 #include "gennUtils.h"
@@ -13,68 +14,47 @@
 #include "code_generator/substitutions.h"
 
 //--------------------------------------------------------------------------
-// Anonymous namespace
+// CodeGenerator::SingleThreadedCPU::Backend
 //--------------------------------------------------------------------------
-namespace
+namespace CodeGenerator
 {
-const std::vector<CodeGenerator::FunctionTemplate> cpuFunctions = {
-    {"gennrand_uniform", 0, "standardUniformDistribution($(rng))", "standardUniformDistribution($(rng))"},
-    {"gennrand_normal", 0, "standardNormalDistribution($(rng))", "standardNormalDistribution($(rng))"},
-    {"gennrand_exponential", 0, "standardExponentialDistribution($(rng))", "standardExponentialDistribution($(rng))"},
-    {"gennrand_log_normal", 2, "std::lognormal_distribution<double>($(0), $(1))($(rng))", "std::lognormal_distribution<float>($(0), $(1))($(rng))"},
-    {"gennrand_gamma", 1, "std::gamma_distribution<double>($(0), 1.0)($(rng))", "std::gamma_distribution<float>($(0), 1.0f)($(rng))"}
-};
-
-//--------------------------------------------------------------------------
-// Timer
-//--------------------------------------------------------------------------
-class Timer
+namespace SingleThreadedCPU
 {
-public:
-    Timer(CodeGenerator::CodeStream &codeStream, const std::string &name, bool timingEnabled)
-    :   m_CodeStream(codeStream), m_Name(name), m_TimingEnabled(timingEnabled)
-    {
-        // Record start event
-        if(m_TimingEnabled) {
-            m_CodeStream << "const auto " << m_Name << "Start = std::chrono::high_resolution_clock::now();" << std::endl;
-        }
+Backend::Backend(const std::string &scalarType, const Preferences &preferences)
+:   BackendCPU(scalarType, preferences), m_Preferences(preferences)
+{
+    // Vectorised neuron update processes neurons in blocks so block size must be non-zero
+    if(m_Preferences.enableVectorisedNeuronUpdate && m_Preferences.vectorisedNeuronBlockSize == 0) {
+        throw std::runtime_error("Vectorised neuron update requires a non-zero vectorisedNeuronBlockSize");
     }
 
-    ~Timer()
+    // Rows are sorted within windows and then split into slices so each window must contain a whole number of slices
+    if(m_Preferences.enableSlicedSparseLayout && (m_Preferences.sparseSliceSize == 0
+                                                  || (m_Preferences.sparseSortWindowSize % m_Preferences.sparseSliceSize) != 0))
     {
-        // Record stop event
-        if(m_TimingEnabled) {
-            m_CodeStream << m_Name << "Time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - " << m_Name << "Start).count();" << std::endl;
-        }
+        throw std::runtime_error("Sliced sparse layout requires a non-zero sparseSliceSize which divides sparseSortWindowSize");
     }
 
-private:
-    //--------------------------------------------------------------------------
-    // Members
-    //--------------------------------------------------------------------------
-    CodeGenerator::CodeStream &m_CodeStream;
-    const std::string m_Name;
-    const bool m_TimingEnabled;
-};
+    // Sparse connectivity can only be stored in one layout
+    if(m_Preferences.enableSlicedSparseLayout && m_Preferences.postsynapticTileSize != 0) {
+        throw std::runtime_error("Tiled sparse layout cannot be combined with sliced sparse layout");
+    }
 }
-
 //--------------------------------------------------------------------------
-// CodeGenerator::SingleThreadedCPU::Backend
-//--------------------------------------------------------------------------
-namespace CodeGenerator
-{
-namespace SingleThreadedCPU
-{
 void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, 
                               NeuronGroupSimHandler simHandler, NeuronGroupMergedHandler wuVarUpdateHandler,
-                              HostHandler pushEGPHandler) const
+                              HostHandler pushEGPHandler, ModuleHandler moduleHandler) const
 {
     const ModelSpecInternal &model = modelMerged.getModel();
-    os << "void updateNeurons(" << model.getTimePrecision() << " t)";
+
+    // If recording is in use, neuron update is also passed the timestep within the recording buffers
+    const std::string updateParams = model.getTimePrecision() + " t" + (model.isRecordingInUse() ? ", unsigned int recordingTimestep" : "");
+    const std::string updateArgs = model.isRecordingInUse() ? "t, recordingTimestep" : "t";
+    os << "void updateNeurons(" << updateParams << ")";
     {
         CodeStream::Scope b(os);
 
-        Substitutions funcSubs(cpuFunctions, model.getPrecision());
+        Substitutions funcSubs(getCPUFunctions(), model.getPrecision());
         funcSubs.addVarSubstitution("t", "t");
 
         // Push any required EGPs
@@ -84,86 +64,196 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
 
         // Loop through merged neuron spike queue update groups
         for(const auto &n : modelMerged.getMergedNeuronSpikeQueueUpdateGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged neuron spike queue update group " << n.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
+            genMergedGroup(os, moduleHandler, "NeuronSpikeQueueUpdate", n.getIndex(), n.getGroups().size() * model.getBatchSize(), model.getTimePrecision() + " t", "t",
+                [&](CodeStream &os)
+                {
+                    os << "// merged neuron spike queue update group " << n.getIndex() << std::endl;
+                    os << "for(unsigned int g = 0; g < " << (n.getGroups().size() * model.getBatchSize()) << "; g++)";
+                    {
+                        CodeStream::Scope b(os);
 
-                // Get reference to group
-                os << "const auto &group = mergedNeuronSpikeQueueUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
+                        // Get reference to group
+                        genGetMergedGroup(os, "NeuronSpikeQueueUpdate", n.getIndex());
 
-                // Generate spike count reset
-                genMergedGroupSpikeCountReset(os, n);
-            }
-            
+                        // Generate spike count reset
+                        genMergedGroupSpikeCountReset(os, n);
+                    }
+                });
         }
         // Loop through merged neuron update groups
         for(const auto &n : modelMerged.getMergedNeuronUpdateGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged neuron update group " << n.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
+            genMergedGroup(os, moduleHandler, "NeuronUpdate", n.getIndex(), n.getGroups().size() * model.getBatchSize(), updateParams, updateArgs,
+                [&](CodeStream &os)
+                {
+                    os << "// merged neuron update group " << n.getIndex() << std::endl;
 
-                // Get reference to group
-                os << "const auto &group = mergedNeuronUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
+                    // If counter-based simulation RNGs are required, generate table of streams to use for each group
+                    genNeuronRNGStreams(os, model, n);
 
-                // If axonal delays are required
-                if(n.getArchetype().isDelayRequired()) {
-                    // We should READ from delay slot before spkQuePtr
-                    os << "const unsigned int readDelayOffset = " << n.getPrevQueueOffset() << ";" << std::endl;
+                    os << "for(unsigned int g = 0; g < " << (n.getGroups().size() * model.getBatchSize()) << "; g++)";
+                    {
+                        CodeStream::Scope b(os);
 
-                    // And we should WRITE to delay slot pointed to be spkQuePtr
-                    os << "const unsigned int writeDelayOffset = " << n.getCurrentQueueOffset() << ";" << std::endl;
-                }
-                os << std::endl;
+                        // Get reference to group
+                        genGetMergedGroup(os, "NeuronUpdate", n.getIndex());
 
-                os << "for(unsigned int i = 0; i < group.numNeurons; i++)";
-                {
-                    CodeStream::Scope b(os);
+                        // If axonal delays are required
+                        if(n.getArchetype().isDelayRequired()) {
+                            // We should READ from delay slot before spkQuePtr
+                            os << "const unsigned int readDelayOffset = " << n.getPrevQueueOffset() << ";" << std::endl;
 
-                    Substitutions popSubs(&funcSubs);
-                    popSubs.addVarSubstitution("id", "i");
+                            // And we should WRITE to delay slot pointed to be spkQuePtr
+                            os << "const unsigned int writeDelayOffset = " << n.getCurrentQueueOffset() << ";" << std::endl;
+                        }
 
-                    // If this neuron group requires a simulation RNG, substitute in global RNG
-                    if(n.getArchetype().isSimRNGRequired()) {
-                        popSubs.addVarSubstitution("rng", "rng");
+                        // If spike recording is enabled, get offset of this timestep's recording words and clear them
+                        // **NOTE** recording buffers are laid out by timestep then batch so group.recordSpk already points to this batch
+                        if(n.getArchetype().isSpikeRecordingEnabled()) {
+                            os << "const unsigned int numRecordingWords = (group.numNeurons + 31) / 32;" << std::endl;
+                            os << "const size_t recordingOffset = (size_t)recordingTimestep * numRecordingWords * " << model.getBatchSize() << ";" << std::endl;
+                            os << "std::fill_n(&group.recordSpk[recordingOffset], numRecordingWords, 0);" << std::endl;
+                        }
+                        os << std::endl;
+
+                        // If neuron model generates the spikes of the whole population at once, call sim handler once without looping over neurons
+                        if(!n.getArchetype().getNeuronModel()->getPopulationSpikeCode().empty()) {
+                            Substitutions popSubs(&funcSubs);
+                            addNeuronSimRNGSubstitution(os, n, popSubs, model.getPrecision());
+
+                            simHandler(os, n, popSubs,
+                                       // Emit true spikes
+                                       [this, wuVarUpdateHandler](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &subs)
+                                       {
+                                           // Insert code to emit true spikes
+                                           genEmitSpike(os, ng, subs, true);
+
+                                           // Insert code to update WU vars
+                                           wuVarUpdateHandler(os, ng, subs);
+                                       },
+                                       // Emit spike-like events
+                                       [this](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &subs)
+                                       {
+                                           // Insert code to emit spike-like events
+                                           genEmitSpike(os, ng, subs, false);
+                                       });
+                        }
+                        // Otherwise, if neuron update should be vectorised
+                        else if(isNeuronUpdateVectorised(n)) {
+                            const unsigned int blockSize = m_Preferences.vectorisedNeuronBlockSize;
+                            const bool trueSpikeMask = !n.getArchetype().getNeuronModel()->getThresholdConditionCode().empty();
+                            const bool spikeEventMask = n.getArchetype().isSpikeEventRequired();
+
+                            // Loop through blocks of neurons
+                            os << "for(unsigned int blockStart = 0; blockStart < group.numNeurons; blockStart += " << blockSize << ")";
+                            {
+                                CodeStream::Scope b(os);
+                                os << "const unsigned int blockEnd = std::min(blockStart + " << blockSize << "u, group.numNeurons);" << std::endl;
+
+                                // Declare masks to hold spikes and spike-like events emitted in this block
+                                if(trueSpikeMask) {
+                                    os << "uint8_t spikeMask[" << blockSize << "] = {};" << std::endl;
+                                }
+                                if(spikeEventMask) {
+                                    os << "uint8_t spikeEventMask[" << blockSize << "] = {};" << std::endl;
+                                }
+
+                                // Update neurons in block, recording spikes in masks
+                                // **NOTE** as this code only accesses the state of neuron i, there are no loop-carried dependencies
+                                os << "GENN_IVDEP" << std::endl;
+                                os << "for(unsigned int i = blockStart; i < blockEnd; i++)";
+                                {
+                                    CodeStream::Scope b(os);
+
+                                    Substitutions popSubs(&funcSubs);
+                                    popSubs.addVarSubstitution("id", "i");
+                                    addNeuronSimRNGSubstitution(os, n, popSubs, model.getPrecision());
+
+                                    simHandler(os, n, popSubs,
+                                               // Record true spikes in mask
+                                               [](CodeStream &os, const NeuronGroupMerged&, Substitutions &)
+                                               {
+                                                   os << "spikeMask[i - blockStart] = 1;" << std::endl;
+                                               },
+                                               // Record spike-like events in mask
+                                               [](CodeStream &os, const NeuronGroupMerged&, Substitutions &)
+                                               {
+                                                   os << "spikeEventMask[i - blockStart] = 1;" << std::endl;
+                                               });
+                                }
+
+                                // Compact spikes and spike-like events from masks
+                                if(trueSpikeMask || spikeEventMask) {
+                                    os << "for(unsigned int i = blockStart; i < blockEnd; i++)";
+                                    {
+                                        CodeStream::Scope b(os);
+
+                                        Substitutions popSubs(&funcSubs);
+                                        popSubs.addVarSubstitution("id", "i");
+
+                                        if(spikeEventMask) {
+                                            os << "if(spikeEventMask[i - blockStart])";
+                                            {
+                                                CodeStream::Scope b(os);
+                                                genEmitSpike(os, n, popSubs, false);
+                                            }
+                                        }
+                                        if(trueSpikeMask) {
+                                            os << "if(spikeMask[i - blockStart])";
+                                            {
+                                                CodeStream::Scope b(os);
+                                                genEmitSpike(os, n, popSubs, true);
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                        else {
+                            os << "for(unsigned int i = 0; i < group.numNeurons; i++)";
+                            {
+                                CodeStream::Scope b(os);
+
+                                Substitutions popSubs(&funcSubs);
+                                popSubs.addVarSubstitution("id", "i");
+
+                                // If this neuron group requires a simulation RNG, add it to substitutions
+                                addNeuronSimRNGSubstitution(os, n, popSubs, model.getPrecision());
+
+                                simHandler(os, n, popSubs,
+                                           // Emit true spikes
+                                           [this, wuVarUpdateHandler](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &subs)
+                                           {
+                                               // Insert code to emit true spikes
+                                               genEmitSpike(os, ng, subs, true);
+
+                                               // Insert code to update WU vars
+                                               wuVarUpdateHandler(os, ng, subs);
+                                           },
+                                           // Emit spike-like events
+                                           [this](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &subs)
+                                           {
+                                               // Insert code to emit spike-like events
+                                               genEmitSpike(os, ng, subs, false);
+                                           });
+                            }
+                        }
                     }
-
-                    simHandler(os, n, popSubs,
-                               // Emit true spikes
-                               [this, wuVarUpdateHandler](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &subs)
-                               {
-                                   // Insert code to emit true spikes
-                                   genEmitSpike(os, ng, subs, true);
-
-                                   // Insert code to update WU vars
-                                   wuVarUpdateHandler(os, ng, subs);
-                               },
-                               // Emit spike-like events
-                                   [this](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &subs)
-                               {
-                                   // Insert code to emit spike-like events
-                                   genEmitSpike(os, ng, subs, false);
-                               });
-                }
-            }
+                });
         }
     }
 }
 //--------------------------------------------------------------------------
 void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
                                SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
-                               SynapseGroupMergedHandler wumEventHandler, SynapseGroupMergedHandler,
+                               SynapseGroupMergedHandler wumEventHandler, SynapseGroupMergedHandler wumProceduralConnectHandler,
                                SynapseGroupMergedHandler postLearnHandler, SynapseGroupMergedHandler synapseDynamicsHandler,
-                               HostHandler pushEGPHandler) const
+                               HostHandler pushEGPHandler, ModuleHandler moduleHandler) const
 {
     const ModelSpecInternal &model = modelMerged.getModel();
     os << "void updateSynapses(" << model.getTimePrecision() << " t)";
     {
         CodeStream::Scope b(os);
-        Substitutions funcSubs(cpuFunctions, model.getPrecision());
+        Substitutions funcSubs(getCPUFunctions(), model.getPrecision());
         funcSubs.addVarSubstitution("t", "t");
 
         // Push any required EGPs
@@ -174,72 +264,159 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
             // Loop through merged synapse dynamics groups
             Timer t(os, "synapseDynamics", model.isTimingEnabled());
             for(const auto &s : modelMerged.getMergedSynapseDynamicsGroups()) {
-                CodeStream::Scope b(os);
-                os << "// merged synapse dynamics group " << s.getIndex() << std::endl;
-                os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
-                {
-                    CodeStream::Scope b(os);
-
-                    // Get reference to group
-                    os << "const auto &group = mergedSynapseDynamicsGroup" << s.getIndex() << "[g]; " << std::endl;
-
-                    // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
-                    if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
-                        os << "const unsigned int preReadDelayOffset = " << s.getPresynapticAxonalDelaySlot() << " * group.numSrcNeurons;" << std::endl;
-                    }
-
-                    // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
-                    if(s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) {
-                        os << "const unsigned int postReadDelayOffset = " << s.getPostsynapticBackPropDelaySlot() << " * group.numTrgNeurons;" << std::endl;
-                    }
-
-                    // Loop through presynaptic neurons
-                    os << "for(unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                genMergedGroup(os, moduleHandler, "SynapseDynamics", s.getIndex(), s.getGroups().size() * model.getBatchSize(), model.getTimePrecision() + " t", "t",
+                    [&](CodeStream &os)
                     {
-                        // If this synapse group has sparse connectivity, loop through length of this row
-                        CodeStream::Scope b(os);
-                        if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                            os << "for(unsigned int s = 0; s < group.rowLength[i]; s++)";
-                        }
-                        // Otherwise, if it's dense, loop through each postsynaptic neuron
-                        else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::DENSE) {
-                            os << "for (unsigned int j = 0; j < group.numTrgNeurons; j++)";
-                        }
-                        else {
-                            throw std::runtime_error("Only DENSE and SPARSE format connectivity can be used for synapse dynamics");
-                        }
+                        os << "// merged synapse dynamics group " << s.getIndex() << std::endl;
+                        os << "for(unsigned int g = 0; g < " << (s.getGroups().size() * model.getBatchSize()) << "; g++)";
                         {
                             CodeStream::Scope b(os);
 
-                            Substitutions synSubs(&funcSubs);
-                            if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                // Calculate index of synapse and use it to look up postsynaptic index
-                                os << "const unsigned int n = (i * group.rowStride) + s;" << std::endl;
-                                os << "const unsigned int j = group.ind[n];" << std::endl;
+                            // Get reference to group
+                            genGetMergedGroup(os, "SynapseDynamics", s.getIndex());
 
-                                synSubs.addVarSubstitution("id_syn", "n");
-                            }
-                            else {
-                                synSubs.addVarSubstitution("id_syn", "(i * group.numTrgNeurons) + j");
+                            // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
+                            if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
+                                os << "const unsigned int preReadDelayOffset = " << s.getPresynapticAxonalDelaySlot() << " * group.numSrcNeurons;" << std::endl;
                             }
 
-                            // Add pre and postsynaptic indices to substitutions
-                            synSubs.addVarSubstitution("id_pre", "i");
-                            synSubs.addVarSubstitution("id_post", "j");
+                            // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
+                            if(s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) {
+                                os << "const unsigned int postReadDelayOffset = " << s.getPostsynapticBackPropDelaySlot() << " * group.numTrgNeurons;" << std::endl;
+                            }
 
-                            // Add correct functions for apply synaptic input
-                            if(s.getArchetype().isDendriticDelayRequired()) {
-                                synSubs.addFuncSubstitution("addToInSynDelay", 2, "group.denDelay[" + s.getDendriticDelayOffset("$(1)") + "j] += $(0)");
+                            // Generate code to update synapse between presynaptic neuron i and postsynaptic neuron j
+                            auto genSynapse =
+                                [&](CodeStream &os)
+                                {
+                                    CodeStream::Scope b(os);
+
+                                    Substitutions synSubs(&funcSubs);
+                                    if((s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE)
+                                       || (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR))
+                                    {
+                                        // Use synapse index to look up postsynaptic index
+                                        os << "const unsigned int j = group.ind[n];" << std::endl;
+
+                                        synSubs.addVarSubstitution("id_syn", "n");
+                                    }
+                                    else {
+                                        synSubs.addVarSubstitution("id_syn", "rowStart + j");
+                                    }
+
+                                    // Add pre and postsynaptic indices to substitutions
+                                    synSubs.addVarSubstitution("id_pre", "i");
+                                    synSubs.addVarSubstitution("id_post", "j");
+
+                                    // Add correct functions for apply synaptic input
+                                    if(s.getArchetype().isDendriticDelayRequired()) {
+                                        synSubs.addFuncSubstitution("addToInSynDelay", 2, "group.denDelay[" + s.getDendriticDelayOffset("$(1)") + "j] += $(0)");
+                                    }
+                                    else {
+                                        synSubs.addFuncSubstitution("addToInSyn", 1, "group.inSyn[j] += $(0)");
+                                    }
+
+                                    // Call synapse dynamics handler
+                                    synapseDynamicsHandler(os, s, synSubs);
+                                };
+
+                            // If synapse dynamics are a weighted sum, accumulate it in blocks of postsynaptic neurons
+                            if(isSynapseDynamicsWeightedSum(s.getArchetype())) {
+                                genWeightedSumSynapseDynamics(os, s, funcSubs, "0", "group.numTrgNeurons", synapseDynamicsHandler);
+                            }
+                            // Otherwise, if connectivity is stored in the sliced layout, loop through slices of rows
+                            else if(isSparseLayoutSliced(s.getArchetype())) {
+                                const std::string indexType = getSynapseIndexType(s.getArchetype());
+                                os << "for(unsigned int sliceBegin = 0; sliceBegin < group.numSrcNeurons; sliceBegin += " << m_Preferences.sparseSliceSize << ")";
+                                {
+                                    CodeStream::Scope b(os);
+
+                                    // **NOTE** rows in each slice are sorted by descending length so the first is the longest
+                                    os << "const unsigned int *sliceRows = &group.slicedRowOrder[sliceBegin];" << std::endl;
+                                    os << "const unsigned int sliceLength = group.rowLength[sliceRows[0]];" << std::endl;
+                                    os << "const unsigned int sliceStride = group.slicedRowStride[sliceRows[0]];" << std::endl;
+                                    os << "const " << indexType << " sliceStart = group.slicedRowStart[sliceRows[0]];" << std::endl;
+                                    os << "unsigned int numRows = sliceStride;" << std::endl;
+
+                                    // Loop through positions within the rows of the slice
+                                    os << "for(unsigned int p = 0; p < sliceLength; p++)";
+                                    {
+                                        CodeStream::Scope b(os);
+
+                                        // Drop rows which are too short to have a synapse at this position from the end of the slice
+                                        os << "while(group.rowLength[sliceRows[numRows - 1]] <= p)";
+                                        {
+                                            CodeStream::Scope b(os);
+                                            os << "numRows--;" << std::endl;
+                                        }
+
+                                        // Loop through the synapses at this position of the remaining rows, which are stored contiguously
+                                        // **NOTE** looping over synapse indices lets the compiler see synapse variables are accessed contiguously
+                                        os << "const " << indexType << " positionStart = sliceStart + (" << getSynapseIndexCast(s) << "p * sliceStride);" << std::endl;
+                                        if(isSlicedSynapseDynamicsIndependent(s)) {
+                                            os << "GENN_IVDEP" << std::endl;
+                                        }
+                                        os << "for(" << indexType << " n = positionStart; n < (positionStart + numRows); n++)";
+                                        {
+                                            CodeStream::Scope b(os);
+                                            os << "const unsigned int i = sliceRows[n - positionStart];" << std::endl;
+                                            genSynapse(os);
+                                        }
+                                    }
+                                }
+                            }
+                            // Otherwise, if connectivity is stored in the tiled layout, loop through the rows of each tile
+                            else if(getSparseLayoutTileSize(s.getArchetype()) != 0) {
+                                const std::string indexType = getSynapseIndexType(s.getArchetype());
+                                const unsigned int tileSize = getSparseLayoutTileSize(s.getArchetype());
+                                os << "const unsigned int numTiles = (group.numTrgNeurons + " << tileSize - 1 << ") / " << tileSize << ";" << std::endl;
+                                os << "const " << indexType << " *tileRowPtr = group.tileRowPtr;" << std::endl;
+                                os << "for(unsigned int tile = 0; tile < numTiles; tile++)";
+                                {
+                                    CodeStream::Scope b(os);
+                                    os << "for(unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                                    {
+                                        CodeStream::Scope b(os);
+                                        os << "for(" << indexType << " n = tileRowPtr[i]; n < tileRowPtr[i + 1]; n++)";
+                                        genSynapse(os);
+                                    }
+
+                                    // **NOTE** the row pointers of each tile follow those of the previous one
+                                    os << "tileRowPtr += group.numSrcNeurons;" << std::endl;
+                                }
                             }
+                            // Otherwise, loop through presynaptic neurons
                             else {
-                                synSubs.addFuncSubstitution("addToInSyn", 1, "group.inSyn[j] += $(0)");
+                                os << "for(unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                                {
+                                    // If this synapse group has sparse connectivity, loop through synapses in this row
+                                    // **NOTE** looping over synapse indices rather than positions within the row lets the compiler
+                                    // see that synapse variables are accessed contiguously and vectorise the loop if it can
+                                    CodeStream::Scope b(os);
+                                    if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                        os << "const " << getSynapseIndexType(s.getArchetype()) << " rowStart = " << getSynapseIndexCast(s) << "i * group.rowStride;" << std::endl;
+                                        os << "const " << getSynapseIndexType(s.getArchetype()) << " rowEnd = rowStart + group.rowLength[i];" << std::endl;
+                                        os << "for(" << getSynapseIndexType(s.getArchetype()) << " n = rowStart; n < rowEnd; n++)";
+                                    }
+                                    // Otherwise, if it has CSR connectivity, loop through synapses between this row's pointers
+                                    else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                                        os << "for(" << getSynapseIndexType(s.getArchetype()) << " n = group.rowPtr[i]; n < group.rowPtr[i + 1]; n++)";
+                                    }
+                                    // Otherwise, if it's dense, loop through each postsynaptic neuron
+                                    // **NOTE** row start is calculated with 64-bit arithmetic so the compiler can
+                                    // tell that synapse indices within the row don't wrap and vectorise the loop
+                                    else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::DENSE) {
+                                        os << "const uint64_t rowStart = (uint64_t)i * group.numTrgNeurons;" << std::endl;
+                                        os << "for (unsigned int j = 0; j < group.numTrgNeurons; j++)";
+                                    }
+                                    else {
+                                        throw std::runtime_error("Only DENSE, SPARSE and CSR format connectivity can be used for synapse dynamics");
+                                    }
+                                    genSynapse(os);
+                                }
                             }
-
-                            // Call synapse dynamics handler
-                            synapseDynamicsHandler(os, s, synSubs);
                         }
-                    }
-                }
+                    });
             }
         }
 
@@ -247,37 +424,47 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
         {
             Timer t(os, "presynapticUpdate", model.isTimingEnabled());
             for(const auto &s : modelMerged.getMergedPresynapticUpdateGroups()) {
-                CodeStream::Scope b(os);
-                os << "// merged presynaptic update group " << s.getIndex() << std::endl;
-                os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
-                {
-                    CodeStream::Scope b(os);
+                genMergedGroup(os, moduleHandler, "PresynapticUpdate", s.getIndex(), s.getGroups().size() * model.getBatchSize(), model.getTimePrecision() + " t", "t",
+                    [&](CodeStream &os)
+                    {
+                        os << "// merged presynaptic update group " << s.getIndex() << std::endl;
 
-                    // Get reference to group
-                    os << "const auto &group = mergedPresynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
+                        // If procedural connectivity or weights require an RNG, generate table of streams to use for each group
+                        // **NOTE** connectivity is shared between batch instances so they use the same stream
+                        if((s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL) && isProceduralRNGRequired(s.getArchetype())) {
+                            genSynapseRNGStreams(os, "proceduralRNGStreams", model, s, 1);
+                        }
 
-                    // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
-                    if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
-                        os << "const unsigned int preReadDelaySlot = " << s.getPresynapticAxonalDelaySlot() << ";" << std::endl;
-                        os << "const unsigned int preReadDelayOffset = preReadDelaySlot * group.numSrcNeurons;" << std::endl;
-                    }
+                        os << "for(unsigned int g = 0; g < " << (s.getGroups().size() * model.getBatchSize()) << "; g++)";
+                        {
+                            CodeStream::Scope b(os);
 
-                    // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
-                    if(s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) {
-                        os << "const unsigned int postReadDelayOffset = " << s.getPostsynapticBackPropDelaySlot() << " * group.numTrgNeurons;" << std::endl;
-                    }
+                            // Get reference to group
+                            genGetMergedGroup(os, "PresynapticUpdate", s.getIndex());
 
-                    // generate the code for processing spike-like events
-                    if (s.getArchetype().isSpikeEventRequired()) {
-                        genPresynapticUpdate(os, modelMerged, s, funcSubs, false, wumThreshHandler, wumEventHandler);
-                    }
+                            // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
+                            if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
+                                os << "const unsigned int preReadDelaySlot = " << s.getPresynapticAxonalDelaySlot() << ";" << std::endl;
+                                os << "const unsigned int preReadDelayOffset = preReadDelaySlot * group.numSrcNeurons;" << std::endl;
+                            }
 
-                    // generate the code for processing true spike events
-                    if (s.getArchetype().isTrueSpikeRequired()) {
-                        genPresynapticUpdate(os, modelMerged, s, funcSubs, true, wumThreshHandler, wumSimHandler);
-                    }
-                    os << std::endl;
-                }
+                            // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
+                            if(s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) {
+                                os << "const unsigned int postReadDelayOffset = " << s.getPostsynapticBackPropDelaySlot() << " * group.numTrgNeurons;" << std::endl;
+                            }
+
+                            // generate the code for processing spike-like events
+                            if (s.getArchetype().isSpikeEventRequired()) {
+                                genPresynapticUpdate(os, modelMerged, s, funcSubs, false, wumThreshHandler, wumEventHandler, wumProceduralConnectHandler);
+                            }
+
+                            // generate the code for processing true spike events
+                            if (s.getArchetype().isTrueSpikeRequired()) {
+                                genPresynapticUpdate(os, modelMerged, s, funcSubs, true, wumThreshHandler, wumSimHandler, wumProceduralConnectHandler);
+                            }
+                            os << std::endl;
+                        }
+                    });
             }
         }
 
@@ -285,73 +472,86 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
         {
             Timer t(os, "postsynapticUpdate", model.isTimingEnabled());
             for(const auto &s : modelMerged.getMergedPostsynapticUpdateGroups()) {
-                CodeStream::Scope b(os);
-                os << "// merged postsynaptic update group " << s.getIndex() << std::endl;
-                os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
-                {
-                    CodeStream::Scope b(os);
-
-                    // Get reference to group
-                    os << "const auto &group = mergedPostsynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
-
-                    // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
-                    if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
-                        os << "const unsigned int preReadDelayOffset = " << s.getPresynapticAxonalDelaySlot() << " * group.numSrcNeurons;" << std::endl;
-                    }
-
-                    // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
-                    if(s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) {
-                        os << "const unsigned int postReadDelaySlot = " << s.getPostsynapticBackPropDelaySlot() << ";" << std::endl;
-                        os << "const unsigned int postReadDelayOffset = postReadDelaySlot * group.numTrgNeurons;" << std::endl;
-                    }
-
-                    // Get number of postsynaptic spikes
-                    if (s.getArchetype().getTrgNeuronGroup()->isDelayRequired() && s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired()) {
-                        os << "const unsigned int numSpikes = group.trgSpkCnt[postReadDelaySlot];" << std::endl;
-                    }
-                    else {
-                        os << "const unsigned int numSpikes = group.trgSpkCnt[0];" << std::endl;
-                    }
-
-                    // Loop through postsynaptic spikes
-                    os << "for (unsigned int j = 0; j < numSpikes; j++)";
+                genMergedGroup(os, moduleHandler, "PostsynapticUpdate", s.getIndex(), s.getGroups().size() * model.getBatchSize(), model.getTimePrecision() + " t", "t",
+                    [&](CodeStream &os)
                     {
-                        CodeStream::Scope b(os);
-
-                        const std::string offsetTrueSpkPost = (s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired() && s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) ? "postReadDelayOffset + " : "";
-                        os << "const unsigned int spike = group.trgSpk[" << offsetTrueSpkPost << "j];" << std::endl;
-
-                        // Loop through column of presynaptic neurons
-                        if (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                            os << "const unsigned int npre = group.colLength[spike];" << std::endl;
-                            os << "for (unsigned int i = 0; i < npre; i++)";
-                        }
-                        else {
-                            os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)";
-                        }
+                        os << "// merged postsynaptic update group " << s.getIndex() << std::endl;
+                        os << "for(unsigned int g = 0; g < " << (s.getGroups().size() * model.getBatchSize()) << "; g++)";
                         {
                             CodeStream::Scope b(os);
 
-                            Substitutions synSubs(&funcSubs);
-                            if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                os << "const unsigned int colMajorIndex = (spike * group.colStride) + i;" << std::endl;
-                                os << "const unsigned int rowMajorIndex = group.remap[colMajorIndex];" << std::endl;
+                            // Get reference to group
+                            genGetMergedGroup(os, "PostsynapticUpdate", s.getIndex());
+
+                            // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
+                            if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
+                                os << "const unsigned int preReadDelayOffset = " << s.getPresynapticAxonalDelaySlot() << " * group.numSrcNeurons;" << std::endl;
+                            }
+
+                            // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
+                            if(s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) {
+                                os << "const unsigned int postReadDelaySlot = " << s.getPostsynapticBackPropDelaySlot() << ";" << std::endl;
+                                os << "const unsigned int postReadDelayOffset = postReadDelaySlot * group.numTrgNeurons;" << std::endl;
+                            }
 
-                                // **TODO** fast divide optimisations
-                                synSubs.addVarSubstitution("id_pre", "(rowMajorIndex / group.rowStride)");
-                                synSubs.addVarSubstitution("id_syn", "rowMajorIndex");
+                            // Get number of postsynaptic spikes
+                            if (s.getArchetype().getTrgNeuronGroup()->isDelayRequired() && s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired()) {
+                                os << "const unsigned int numSpikes = group.trgSpkCnt[postReadDelaySlot];" << std::endl;
                             }
                             else {
-                                synSubs.addVarSubstitution("id_pre", "i");
-                                synSubs.addVarSubstitution("id_syn", "((group.numTrgNeurons * i) + spike)");
+                                os << "const unsigned int numSpikes = group.trgSpkCnt[0];" << std::endl;
                             }
-                            synSubs.addVarSubstitution("id_post", "spike");
 
-                            postLearnHandler(os, s, synSubs);
+                            // Loop through postsynaptic spikes
+                            os << "for (unsigned int j = 0; j < numSpikes; j++)";
+                            {
+                                CodeStream::Scope b(os);
+
+                                const std::string offsetTrueSpkPost = (s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired() && s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) ? "postReadDelayOffset + " : "";
+                                os << "const unsigned int spike = group.trgSpk[" << offsetTrueSpkPost << "j];" << std::endl;
+
+                                // Loop through column of presynaptic neurons
+                                if (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                    os << "const unsigned int npre = group.colLength[spike];" << std::endl;
+                                    os << "for (unsigned int i = 0; i < npre; i++)";
+                                }
+                                else if (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                                    os << "for (" << getSynapseIndexType(s.getArchetype()) << " i = group.colPtr[spike]; i < group.colPtr[spike + 1]; i++)";
+                                }
+                                else {
+                                    os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                                }
+                                {
+                                    CodeStream::Scope b(os);
+
+                                    Substitutions synSubs(&funcSubs);
+                                    if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                        os << "const " << getSynapseIndexType(s.getArchetype()) << " colMajorIndex = (" << getSynapseIndexCast(s) << "spike * group.colStride) + i;" << std::endl;
+                                        os << "const " << getSynapseIndexType(s.getArchetype()) << " rowMajorIndex = group.remap[colMajorIndex];" << std::endl;
+
+                                        // **TODO** fast divide optimisations
+                                        synSubs.addVarSubstitution("id_pre", "(rowMajorIndex / group.rowStride)");
+                                        synSubs.addVarSubstitution("id_syn", "rowMajorIndex");
+                                    }
+                                    else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                                        os << "const " << getSynapseIndexType(s.getArchetype()) << " rowMajorIndex = group.remap[i];" << std::endl;
+
+                                        // Presynaptic index is that of the last row starting at or before synapse
+                                        synSubs.addVarSubstitution("id_pre", "((unsigned int)(std::upper_bound(group.rowPtr, group.rowPtr + group.numSrcNeurons + 1, rowMajorIndex) - group.rowPtr) - 1)");
+                                        synSubs.addVarSubstitution("id_syn", "rowMajorIndex");
+                                    }
+                                    else {
+                                        synSubs.addVarSubstitution("id_pre", "i");
+                                        synSubs.addVarSubstitution("id_syn", "((" + getSynapseIndexCast(s) + "group.numTrgNeurons * i) + spike)");
+                                    }
+                                    synSubs.addVarSubstitution("id_post", "spike");
+
+                                    postLearnHandler(os, s, synSubs);
+                                }
+                            }
+                            os << std::endl;
                         }
-                    }
-                    os << std::endl;
-                }
+                    });
             }
         }
     }
@@ -360,13 +560,18 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
 void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                       NeuronGroupMergedHandler localNGHandler, SynapseGroupMergedHandler sgDenseInitHandler,
                       SynapseGroupMergedHandler sgSparseConnectHandler, SynapseGroupMergedHandler sgSparseInitHandler,
-                      HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler) const
+                      HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler, ModuleHandler moduleHandler) const
 {
     const ModelSpecInternal &model = modelMerged.getModel();
     os << "void initialize()";
     {
         CodeStream::Scope b(os);
-        Substitutions funcSubs(cpuFunctions, model.getPrecision());
+        Substitutions funcSubs(getCPUFunctions(), model.getPrecision());
+
+        // In re-entrant models, check calling thread has allocated its instance of the model
+        if(m_Preferences.enableReentrantModel) {
+            os << "checkInstanceAllocated(\"initialize\");" << std::endl;
+        }
 
         // Push any required EGPs
         initPushEGPHandler(os);
@@ -402,114 +607,197 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
             // Add RNG to substitutions
             funcSubs.addVarSubstitution("rng", "rng");
         }
+
+        // If a counter-based RNG is required, set key used to generate all Philox RNG streams
+        if(isPhiloxRNGRequired(modelMerged)) {
+            if(model.getSeed() == 0) {
+                os << "philoxRNGKey = std::random_device()();" << std::endl;
+            }
+            else {
+                os << "philoxRNGKey = " << model.getSeed() << ";" << std::endl;
+            }
+        }
         os << std::endl;
 
         os << "// ------------------------------------------------------------------------" << std::endl;
         os << "// Local neuron groups" << std::endl;
         for(const auto &n : modelMerged.getMergedNeuronInitGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged neuron init group " << n.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
+            genMergedGroup(os, moduleHandler, "NeuronInit", n.getIndex(), n.getGroups().size() * model.getBatchSize(), "", "",
+                [&](CodeStream &os)
+                {
+                    os << "// merged neuron init group " << n.getIndex() << std::endl;
+                    os << "for(unsigned int g = 0; g < " << (n.getGroups().size() * model.getBatchSize()) << "; g++)";
+                    {
+                        CodeStream::Scope b(os);
 
-                // Get reference to group
-                os << "const auto &group = mergedNeuronInitGroup" << n.getIndex() << "[g]; " << std::endl;
-                Substitutions popSubs(&funcSubs);
-                localNGHandler(os, n, popSubs);
-            }
+                        // Get reference to group
+                        genGetMergedGroup(os, "NeuronInit", n.getIndex());
+                        Substitutions popSubs(&funcSubs);
+                        localNGHandler(os, n, popSubs);
+                    }
+                });
         }
 
         os << "// ------------------------------------------------------------------------" << std::endl;
         os << "// Synapse groups with dense connectivity" << std::endl;
         for(const auto &s : modelMerged.getMergedSynapseDenseInitGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged synapse dense init group " << s.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
+            genMergedGroup(os, moduleHandler, "SynapseDenseInit", s.getIndex(), s.getGroups().size() * model.getBatchSize(), "", "",
+                [&](CodeStream &os)
+                {
+                    os << "// merged synapse dense init group " << s.getIndex() << std::endl;
+                    os << "for(unsigned int g = 0; g < " << (s.getGroups().size() * model.getBatchSize()) << "; g++)";
+                    {
+                        CodeStream::Scope b(os);
 
-                // Get reference to group
-                os << "const auto &group = mergedSynapseDenseInitGroup" << s.getIndex() << "[g]; " << std::endl;
-                Substitutions popSubs(&funcSubs);
-                sgDenseInitHandler(os, s, popSubs);
-            }
+                        // Get reference to group
+                        genGetMergedGroup(os, "SynapseDenseInit", s.getIndex());
+                        Substitutions popSubs(&funcSubs);
+                        sgDenseInitHandler(os, s, popSubs);
+                    }
+                });
         }
 
         os << "// ------------------------------------------------------------------------" << std::endl;
         os << "// Synapse groups with sparse connectivity" << std::endl;
         for(const auto &s : modelMerged.getMergedSynapseConnectivityInitGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged synapse connectivity init group " << s.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
-
-                // Get reference to group
-                os << "const auto &group = mergedSynapseConnectivityInitGroup" << s.getIndex() << "[g]; " << std::endl;
+            genMergedGroup(os, moduleHandler, "SynapseConnectivityInit", s.getIndex(), s.getGroups().size(), "", "",
+                [&](CodeStream &os)
+                {
+                    os << "// merged synapse connectivity init group " << s.getIndex() << std::endl;
 
-                // If matrix connectivity is ragged
-                if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                    // Zero row lengths
-                    os << "memset(group.rowLength, 0, group.numSrcNeurons * sizeof(unsigned int));" << std::endl;
+                    // If rows are built using counter-based RNGs, generate table of streams to use for each group
+                    // **NOTE** second word of key is 0xFFFFFFFF for connectivity initialisation streams
+                    const bool philoxRNGRequired = isConnectivityInitPhiloxRNGRequired(s.getArchetype());
+                    if(philoxRNGRequired) {
+                        genSynapseRNGStreams(os, "connectivityRNGStreams", model, s, 1);
+                    }
 
-                    // Loop through source neurons
-                    os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                    // If connectivity can be cached, generate table of files to cache each group's connectivity in
+                    const bool cacheConnectivity = isConnectivityCacheable(model, s.getArchetype());
+                    if(cacheConnectivity) {
+                        genConnectivityCacheFiles(os, model, s);
+                    }
+                    os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
                     {
                         CodeStream::Scope b(os);
 
-                        Substitutions popSubs(&funcSubs);
-                        popSubs.addVarSubstitution("id_pre", "i");
-                        popSubs.addVarSubstitution("id_post_begin", "0");
-                        popSubs.addVarSubstitution("id_thread", "0");
-                        popSubs.addVarSubstitution("num_threads", "1");
-                        popSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
-                        
-                        // Add function to increment row length and insert synapse into ind array
-                        popSubs.addFuncSubstitution("addSynapse", 1,
-                                                    "group.ind[(i * group.rowStride) + (group.rowLength[i]++)] = $(0)");
-
-                        sgSparseConnectHandler(os, s, popSubs);
-                    }
+                        // Get reference to group
+                        genGetMergedGroup(os, "SynapseConnectivityInit", s.getIndex());
 
-                }
-                // Otherwise, if matrix connectivity is a bitmask
-                else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
-                    // Zero memory before setting sparse bits
-                    os << "const size_t gpSize = ((((size_t)group.numSrcNeurons * (size_t)group.rowStride) + 32 - 1) / 32);" << std::endl;
-                    os << "memset(group.gp, 0, gpSize * sizeof(uint32_t));" << std::endl;
-
-                    // Loop through source neurons
-                    os << "for(unsigned int i = 0; i < group.numSrcNeurons; i++)";
-                    {
-                        // Calculate index of bit at start of this row
-                        CodeStream::Scope b(os);
-                        os << "const int64_t rowStartGID = i * group.rowStride;" << std::endl;
+                        // If connectivity can be cached, try to read it from cache
+                        if(cacheConnectivity) {
+                            genReadConnectivityCache(os, s);
+                        }
 
-                        // Build function template to set correct bit in bitmask
-                        Substitutions popSubs(&funcSubs);
-                        popSubs.addVarSubstitution("id_pre", "i");
-                        popSubs.addVarSubstitution("id_post_begin", "0");
-                        popSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
+                        // If matrix connectivity is ragged
+                        if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                            // Zero row lengths
+                            os << "memset(group.rowLength, 0, group.numSrcNeurons * sizeof(unsigned int));" << std::endl;
 
-                        // Add function to increment row length and insert synapse into ind array
-                        popSubs.addFuncSubstitution("addSynapse", 1,
-                                                    "setB(group.gp[(rowStartGID + $(0)) / 32], (rowStartGID + $(0)) & 31)");
+                            // Loop through source neurons
+                            os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                            {
+                                CodeStream::Scope b(os);
+
+                                // If required, give each row its own RNG stream so connectivity matches that generated by other CPU backends
+                                Substitutions popSubs(&funcSubs);
+                                if(philoxRNGRequired) {
+                                    os << "PhiloxRNG connectRNG(philoxRNGKey, 0xFFFFFFFFu, i, connectivityRNGStreams[g], 0);" << std::endl;
+                                    popSubs.addVarSubstitution("rng", "connectRNG");
+                                    addCounterBasedRNGFunctionSubstitutions(popSubs, model.getPrecision());
+                                }
+                                popSubs.addVarSubstitution("id_pre", "i");
+                                popSubs.addVarSubstitution("id_post_begin", "0");
+                                popSubs.addVarSubstitution("id_thread", "0");
+                                popSubs.addVarSubstitution("num_threads", "1");
+                                popSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
+
+                                // Add function to increment row length and insert synapse into ind array
+                                popSubs.addFuncSubstitution("addSynapse", 1,
+                                                            "group.ind[(" + getSynapseIndexCast(s) + "i * group.rowStride) + (group.rowLength[i]++)] = $(0)");
+
+                                sgSparseConnectHandler(os, s, popSubs);
+                            }
+
+                        }
+                        // Otherwise, if matrix connectivity is CSR
+                        else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                            // First row starts at first synapse
+                            os << "group.rowPtr[0] = 0;" << std::endl;
 
-                        sgSparseConnectHandler(os, s, popSubs);
+                            // Loop through source neurons
+                            // **NOTE** each row starts where the previous one ended so this is always done serially
+                            os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                            {
+                                CodeStream::Scope b(os);
+
+                                // Row is initially empty
+                                os << "group.rowPtr[i + 1] = group.rowPtr[i];" << std::endl;
+
+                                Substitutions popSubs(&funcSubs);
+                                popSubs.addVarSubstitution("id_pre", "i");
+                                popSubs.addVarSubstitution("id_post_begin", "0");
+                                popSubs.addVarSubstitution("id_thread", "0");
+                                popSubs.addVarSubstitution("num_threads", "1");
+                                popSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
+
+                                // Add function to insert synapse into ind array and advance end of row
+                                // **NOTE** rows are stored back-to-back so check there is space for another synapse before inserting it
+                                popSubs.addFuncSubstitution("addSynapse", 1,
+                                                            "group.ind[(group.rowPtr[i + 1] < group.maxSynapses) ? group.rowPtr[i + 1]++ : "
+                                                            "throw std::runtime_error(\"CSR connectivity has more synapses than allocated - increase using SynapseGroup::setMaxSynapses\")] = $(0)");
+
+                                sgSparseConnectHandler(os, s, popSubs);
+                            }
+                        }
+                        // Otherwise, if matrix connectivity is a bitmask
+                        else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+                            // Zero memory before setting sparse bits
+                            os << "const size_t gpSize = ((((size_t)group.numSrcNeurons * (size_t)group.rowStride) + 32 - 1) / 32);" << std::endl;
+                            os << "memset(group.gp, 0, gpSize * sizeof(uint32_t));" << std::endl;
+
+                            // Loop through source neurons
+                            os << "for(unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                            {
+                                // Calculate index of bit at start of this row
+                                CodeStream::Scope b(os);
+                                os << "const uint64_t rowStartGID = (uint64_t)i * group.rowStride;" << std::endl;
+
+                                // Build function template to set correct bit in bitmask
+                                Substitutions popSubs(&funcSubs);
+                                popSubs.addVarSubstitution("id_pre", "i");
+                                popSubs.addVarSubstitution("id_post_begin", "0");
+                                popSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
+
+                                // Add function to increment row length and insert synapse into ind array
+                                popSubs.addFuncSubstitution("addSynapse", 1,
+                                                            "setB(group.gp[(rowStartGID + $(0)) / 32], (rowStartGID + $(0)) & 31)");
+
+                                sgSparseConnectHandler(os, s, popSubs);
+                            }
+                        }
+                        else {
+                            throw std::runtime_error("Only BITMASK, SPARSE and CSR format connectivity can be generated using a connectivity initialiser");
+                        }
+
+                        // If connectivity can be cached, write the connectivity that's just been built to cache
+                        if(cacheConnectivity) {
+                            genWriteConnectivityCache(os, s);
+                        }
                     }
-                }
-                else {
-                    throw std::runtime_error("Only BITMASK and SPARSE format connectivity can be generated using a connectivity initialiser");
-                }
-            }
+                });
         }
     }
     os << std::endl;
     os << "void initializeSparse()";
     {
         CodeStream::Scope b(os);
-        Substitutions funcSubs(cpuFunctions, model.getPrecision());
+        Substitutions funcSubs(getCPUFunctions(), model.getPrecision());
+
+        // In re-entrant models, check calling thread has allocated its instance of the model
+        if(m_Preferences.enableReentrantModel) {
+            os << "checkInstanceAllocated(\"initializeSparse\");" << std::endl;
+        }
 
         // Push any required EGPs
         initSparsePushEGPHandler(os);
@@ -524,228 +812,182 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
         os << "// ------------------------------------------------------------------------" << std::endl;
         os << "// Synapse groups with sparse connectivity" << std::endl;
         for(const auto &s : modelMerged.getMergedSynapseSparseInitGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged sparse synapse init group " << s.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
+            genMergedGroup(os, moduleHandler, "SynapseSparseInit", s.getIndex(), s.getGroups().size() * model.getBatchSize(), "", "",
+                [&](CodeStream &os)
+                {
+                    os << "// merged sparse synapse init group " << s.getIndex() << std::endl;
 
-                // Get reference to group
-                os << "const auto &group = mergedSynapseSparseInitGroup" << s.getIndex() << "[g]; " << std::endl;
+                    // If rows are initialised using counter-based RNGs, generate table of streams to use for each group
+                    // **NOTE** second word of key is 0xFFFFFFFE for sparse variable initialisation streams
+                    const bool philoxRNGRequired = isSparseInitPhiloxRNGRequired(s.getArchetype());
+                    if(philoxRNGRequired) {
+                        genSynapseRNGStreams(os, "sparseInitRNGStreams", model, s, model.getBatchSize());
+                    }
 
-                // If postsynaptic learning is required, initially zero column lengths
-                if (!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
-                    os << "// Zero column lengths" << std::endl;
-                    os << "std::fill_n(group.colLength, group.numTrgNeurons, 0);" << std::endl;
-                }
+                    // If connectivity is stored in the tiled layout, declare vector to hold where each row-major synapse is moved to
+                    // **NOTE** this is calculated for the first batch instance of each group and reused by the others
+                    const unsigned int tileSize = getSparseLayoutTileSize(s.getArchetype());
+                    if(tileSize != 0) {
+                        os << "std::vector<" << getSynapseIndexType(s.getArchetype()) << "> tiledSynapse;" << std::endl;
+                    }
+                    os << "for(unsigned int g = 0; g < " << (s.getGroups().size() * model.getBatchSize()) << "; g++)";
+                    {
+                        CodeStream::Scope b(os);
 
-                os << "// Loop through presynaptic neurons" << std::endl;
-                os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)" << std::endl;
-                {
-                    CodeStream::Scope b(os);
+                        // Get reference to group
+                        genGetMergedGroup(os, "SynapseSparseInit", s.getIndex());
 
-                    // Generate sparse initialisation code
-                    if(s.getArchetype().isWUVarInitRequired()) {
-                        Substitutions popSubs(&funcSubs);
-                        popSubs.addVarSubstitution("id_pre", "i");
-                        popSubs.addVarSubstitution("row_len", "group.rowLength[i]");
-                        sgSparseInitHandler(os, s, popSubs);
-                    }
+                        // If model is batched, connectivity and hence column-major remapping is shared so only build it for the first batch instance
+                        const std::string firstBatchCondition = (model.getBatchSize() > 1) ? ("if((g % " + std::to_string(model.getBatchSize()) + ") == 0) ") : "";
+
+                        // If postsynaptic learning is required, initially zero column lengths
+                        const bool csr = (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR);
+                        if (!s.getArchetype().getWUModel()->getLearnPostCode().empty() && !csr) {
+                            os << "// Zero column lengths" << std::endl;
+                            os << firstBatchCondition << "std::fill_n(group.colLength, group.numTrgNeurons, 0);" << std::endl;
+                        }
+
+                        // If connectivity is stored in the sliced layout, build it from the row-major connectivity
+                        if(isSparseLayoutSliced(s.getArchetype())) {
+                            {
+                                os << firstBatchCondition;
+                                CodeStream::Scope b(os);
+                                genSlicedLayout(os, s);
+                            }
+
+                            // Slice any synapse variables which aren't initialised here as their values were provided row-major
+                            if(s.getArchetype().getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+                                const auto vars = s.getArchetype().getWUModel()->getVars();
+                                for(size_t k = 0; k < vars.size(); k++) {
+                                    if(s.getArchetype().getWUVarInitialisers().at(k).getSnippet()->getCode().empty()) {
+                                        genSliceArray(os, s, vars[k].type, vars[k].name);
+                                    }
+                                }
+                            }
+                        }
 
-                    // If postsynaptic learning is required
-                    if(!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
-                        os << "// Loop through synapses in corresponding matrix row" << std::endl;
-                        os << "for(unsigned int j = 0; j < group.rowLength[i]; j++)" << std::endl;
+                        os << "// Loop through presynaptic neurons" << std::endl;
+                        os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)" << std::endl;
                         {
                             CodeStream::Scope b(os);
 
-                            // If postsynaptic learning is required, calculate column length and remapping
-                            if(!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
-                                os << "// Calculate index of this synapse in the row-major matrix" << std::endl;
-                                os << "const unsigned int rowMajorIndex = (i * group.rowStride) + j;" << std::endl;
-                                os << "// Using this, lookup postsynaptic target" << std::endl;
-                                os << "const unsigned int postIndex = group.ind[rowMajorIndex];" << std::endl;
-                                os << "// From this calculate index of this synapse in the column-major matrix" << std::endl;
-                                os << "const unsigned int colMajorIndex = (postIndex * group.colStride) + group.colLength[postIndex];" << std::endl;
-                                os << "// Increment column length corresponding to this postsynaptic neuron" << std::endl;
-                                os << "group.colLength[postIndex]++;" << std::endl;
-                                os << "// Add remapping entry" << std::endl;
-                                os << "group.remap[colMajorIndex] = rowMajorIndex;" << std::endl;
+                            // Generate sparse initialisation code
+                            if(s.getArchetype().isWUVarInitRequired()) {
+                                Substitutions popSubs(&funcSubs);
+                                if(philoxRNGRequired) {
+                                    os << "PhiloxRNG initRNG(philoxRNGKey, 0xFFFFFFFEu, i, sparseInitRNGStreams[g], 0);" << std::endl;
+                                    popSubs.addVarSubstitution("rng", "initRNG");
+                                    addCounterBasedRNGFunctionSubstitutions(popSubs, model.getPrecision());
+                                }
+                                popSubs.addVarSubstitution("id_pre", "i");
+                                popSubs.addVarSubstitution("row_len", csr ? "(group.rowPtr[i + 1] - group.rowPtr[i])" : "group.rowLength[i]");
+                                sgSparseInitHandler(os, s, popSubs);
+                            }
+
+                            // If postsynaptic learning is required
+                            if(!s.getArchetype().getWUModel()->getLearnPostCode().empty() && !csr) {
+                                os << "// Loop through synapses in corresponding matrix row" << std::endl;
+                                os << firstBatchCondition << "for(unsigned int j = 0; j < group.rowLength[i]; j++)" << std::endl;
+                                {
+                                    CodeStream::Scope b(os);
+
+                                    // If postsynaptic learning is required, calculate column length and remapping
+                                    if(!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
+                                        os << "// Calculate index of this synapse in the row-major matrix" << std::endl;
+                                        os << "const " << getSynapseIndexType(s.getArchetype()) << " rowMajorIndex = (" << getSynapseIndexCast(s) << "i * group.rowStride) + j;" << std::endl;
+                                        os << "// Using this, lookup postsynaptic target" << std::endl;
+                                        os << "const unsigned int postIndex = group.ind[rowMajorIndex];" << std::endl;
+                                        os << "// From this calculate index of this synapse in the column-major matrix" << std::endl;
+                                        os << "const " << getSynapseIndexType(s.getArchetype()) << " colMajorIndex = (" << getSynapseIndexCast(s) << "postIndex * group.colStride) + group.colLength[postIndex];" << std::endl;
+                                        os << "// Increment column length corresponding to this postsynaptic neuron" << std::endl;
+                                        os << "group.colLength[postIndex]++;" << std::endl;
+                                        os << "// Add remapping entry" << std::endl;
+                                        os << "group.remap[colMajorIndex] = rowMajorIndex;" << std::endl;
+                                    }
+                                }
                             }
                         }
+
+                        // If postsynaptic learning is required with CSR connectivity, build column pointers and remapping with a counting sort
+                        if(!s.getArchetype().getWUModel()->getLearnPostCode().empty() && csr) {
+                            os << firstBatchCondition;
+                            CodeStream::Scope b(os);
+                            os << "// Count synapses targetting each postsynaptic neuron" << std::endl;
+                            os << "std::fill_n(group.colPtr, group.numTrgNeurons + 1, 0);" << std::endl;
+                            os << "for (" << getSynapseIndexType(s.getArchetype()) << " n = 0; n < group.rowPtr[group.numSrcNeurons]; n++)";
+                            {
+                                CodeStream::Scope b(os);
+                                os << "group.colPtr[group.ind[n] + 1]++;" << std::endl;
+                            }
+
+                            os << "// Convert counts into pointers to the start of each column" << std::endl;
+                            os << "for (unsigned int j = 0; j < group.numTrgNeurons; j++)";
+                            {
+                                CodeStream::Scope b(os);
+                                os << "group.colPtr[j + 1] += group.colPtr[j];" << std::endl;
+                            }
+
+                            os << "// Add remapping entries, advancing column pointers to the end of each column" << std::endl;
+                            os << "for (" << getSynapseIndexType(s.getArchetype()) << " n = 0; n < group.rowPtr[group.numSrcNeurons]; n++)";
+                            {
+                                CodeStream::Scope b(os);
+                                os << "group.remap[group.colPtr[group.ind[n]]++] = n;" << std::endl;
+                            }
+
+                            os << "// Shift column pointers back to the start of each column" << std::endl;
+                            os << "for (unsigned int j = group.numTrgNeurons; j > 0; j--)";
+                            {
+                                CodeStream::Scope b(os);
+                                os << "group.colPtr[j] = group.colPtr[j - 1];" << std::endl;
+                            }
+                            os << "group.colPtr[0] = 0;" << std::endl;
+                        }
+
+                        // If connectivity is stored in the tiled layout, move it and synapse variables, which are initialised row-major, into it
+                        if(tileSize != 0) {
+                            {
+                                os << firstBatchCondition;
+                                CodeStream::Scope b(os);
+                                genTiledLayout(os, s);
+                            }
+
+                            if(s.getArchetype().getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+                                for(const auto &v : s.getArchetype().getWUModel()->getVars()) {
+                                    genTileArray(os, s, v.type, v.name);
+                                }
+                            }
+
+                            // **NOTE** connectivity is shared between batch instances so it's only moved once all of their variables have been moved
+                            if(model.getBatchSize() > 1) {
+                                os << "if((g % " << model.getBatchSize() << ") == " << (model.getBatchSize() - 1) << ") ";
+                            }
+                            genTileArray(os, s, s.getArchetype().getSparseIndType(), "ind");
+                        }
                     }
-                }
-            }
+                });
         }
     }
 }
 //--------------------------------------------------------------------------
-size_t Backend::getSynapticMatrixRowStride(const SynapseGroupInternal &sg) const
-{
-    if (sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-        return sg.getMaxConnections();
-    }
-    else if(m_Preferences.enableBitmaskOptimisations && (sg.getMatrixType() & SynapseMatrixConnectivity::BITMASK)) {
-        return padSize(sg.getTrgNeuronGroup()->getNumNeurons(), 32);
-    }
-    else {
-        return sg.getTrgNeuronGroup()->getNumNeurons();
-    }
-}
-//--------------------------------------------------------------------------
-void Backend::genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
+void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
 {
-    const ModelSpecInternal &model = modelMerged.getModel();
-
-    os << "// Standard C++ includes" << std::endl;
-    os << "#include <algorithm>" << std::endl;
-    os << "#include <chrono>" << std::endl;
-    os << "#include <iostream>" << std::endl;
-    os << "#include <random>" << std::endl;
-    os << std::endl;
-    os << "// Standard C includes" << std::endl;
-    os << "#include <cmath>" << std::endl;
-    os << "#include <cstdint>" << std::endl;
-    os << "#include <cstring>" << std::endl;
-
-     // If a global RNG is required, define standard host distributions as recreating them each call is slow
-    if(isGlobalRNGRequired(modelMerged)) {
-        os << "EXPORT_VAR " << "std::uniform_real_distribution<" << model.getPrecision() << "> standardUniformDistribution;" << std::endl;
-        os << "EXPORT_VAR " << "std::normal_distribution<" << model.getPrecision() << "> standardNormalDistribution;" << std::endl;
-        os << "EXPORT_VAR " << "std::exponential_distribution<" << model.getPrecision() << "> standardExponentialDistribution;" << std::endl;
-        os << std::endl;
-    }
-}
-//--------------------------------------------------------------------------
-void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &) const
-{
-    os << "#define SUPPORT_CODE_FUNC inline" << std::endl;
+    BackendCPU::genDefinitionsInternalPreamble(os, modelMerged);
 
-    // On windows, define an inline function, matching the signature of __builtin_clz which counts leading zeros
+    // If vectorised neuron updates or the sliced sparse layout are enabled, define macro to tell compiler that loops have no loop-carried dependencies
+    if(m_Preferences.enableVectorisedNeuronUpdate || m_Preferences.enableSlicedSparseLayout) {
 #ifdef _WIN32
-    os << "#include <intrin.h>" << std::endl;
-    os << std::endl;
-    os << "int inline gennCLZ(unsigned int value)";
-    {
-        CodeStream::Scope b(os);
-        os << "unsigned long leadingZero = 0;" << std::endl;
-        os << "if( _BitScanReverse(&leadingZero, value))";
-        {
-            CodeStream::Scope b(os);
-            os << "return 31 - leadingZero;" << std::endl;
-        }
-        os << "else";
-        {
-            CodeStream::Scope b(os);
-            os << "return 32;" << std::endl;
-        }
-    }
-    // Otherwise, on *nix, use __builtin_clz intrinsic
+        os << "#define GENN_IVDEP __pragma(loop(ivdep))" << std::endl;
 #else
-    os << "#define gennCLZ __builtin_clz" << std::endl;
+        os << "#if defined(__clang__)" << std::endl;
+        os << "#define GENN_IVDEP _Pragma(\"clang loop vectorize(assume_safety)\")" << std::endl;
+        os << "#elif defined(__GNUC__)" << std::endl;
+        os << "#define GENN_IVDEP _Pragma(\"GCC ivdep\")" << std::endl;
+        os << "#else" << std::endl;
+        os << "#define GENN_IVDEP" << std::endl;
+        os << "#endif" << std::endl;
 #endif
-    os << std::endl;
-}
-//--------------------------------------------------------------------------
-void Backend::genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
-{
-    const ModelSpecInternal &model = modelMerged.getModel();
-
-    // If a global RNG is required, implement standard host distributions as recreating them each call is slow
-    if(isGlobalRNGRequired(modelMerged)) {
-        os << "std::uniform_real_distribution<" << model.getPrecision() << "> standardUniformDistribution(" << model.scalarExpr(0.0) << ", " << model.scalarExpr(1.0) << ");" << std::endl;
-        os << "std::normal_distribution<" << model.getPrecision() << "> standardNormalDistribution(" << model.scalarExpr(0.0) << ", " << model.scalarExpr(1.0) << ");" << std::endl;
-        os << "std::exponential_distribution<" << model.getPrecision() << "> standardExponentialDistribution(" << model.scalarExpr(1.0) << ");" << std::endl;
         os << std::endl;
     }
-    os << "template<class T>" << std::endl;
-    os << "T *getSymbolAddress(T &devSymbol)";
-    {
-        CodeStream::Scope b(os);
-        os << "return &devSymbol;" << std::endl;
-    }
-    os << std::endl;
-}
-//--------------------------------------------------------------------------
-void Backend::genAllocateMemPreamble(CodeStream &, const ModelSpecMerged &) const
-{
-}
-//--------------------------------------------------------------------------
-void Backend::genStepTimeFinalisePreamble(CodeStream &, const ModelSpecMerged &) const
-{
-}
-//--------------------------------------------------------------------------
-void Backend::genVariableDefinition(CodeStream &definitions, CodeStream &, const std::string &type, const std::string &name, VarLocation) const
-{
-    definitions << "EXPORT_VAR " << type << " " << name << ";" << std::endl;
-}
-//--------------------------------------------------------------------------
-void Backend::genVariableImplementation(CodeStream &os, const std::string &type, const std::string &name, VarLocation) const
-{
-    os << type << " " << name << ";" << std::endl;
-}
-//--------------------------------------------------------------------------
-MemAlloc Backend::genVariableAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation, size_t count) const
-{
-    os << name << " = new " << type << "[" << count << "];" << std::endl;
-
-    return MemAlloc::host(count * getSize(type));
-}
-//--------------------------------------------------------------------------
-void Backend::genVariableFree(CodeStream &os, const std::string &name, VarLocation) const
-{
-    os << "delete[] " << name << ";" << std::endl;
-}
-//--------------------------------------------------------------------------
-void Backend::genExtraGlobalParamDefinition(CodeStream &definitions, const std::string &type, const std::string &name, VarLocation) const
-{
-    definitions << "EXPORT_VAR " << type << " " << name << ";" << std::endl;
-}
-//--------------------------------------------------------------------------
-void Backend::genExtraGlobalParamImplementation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const
-{
-    genVariableImplementation(os, type, name, loc);
-}
-//--------------------------------------------------------------------------
-void Backend::genExtraGlobalParamAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation) const
-{
-    // Get underlying type
-    // **NOTE** could use std::remove_pointer but it seems unnecessarily elaborate
-    const std::string underlyingType = Utils::getUnderlyingType(type);
-
-    os << name << " = new " << underlyingType << "[count];" << std::endl;
-}
-//--------------------------------------------------------------------------
-void Backend::genExtraGlobalParamPush(CodeStream &, const std::string &, const std::string &, VarLocation) const
-{
-    assert(!m_Preferences.automaticCopy);
-}
-//--------------------------------------------------------------------------
-void Backend::genExtraGlobalParamPull(CodeStream &, const std::string &, const std::string &, VarLocation) const
-{
-    assert(!m_Preferences.automaticCopy);
-}
-//--------------------------------------------------------------------------
-void Backend::genMergedGroupImplementation(CodeStream &os, const std::string &suffix, size_t idx, size_t numGroups) const
-{
-    os << "Merged" << suffix << "Group" << idx << " merged" << suffix << "Group" << idx << "[" << numGroups << "];" << std::endl;
-}
-//--------------------------------------------------------------------------
-void Backend::genMergedGroupPush(CodeStream &os, const std::string &suffix, size_t idx, size_t numGroups) const
-{
-    os << "std::copy_n(group, " << numGroups << ", merged" << suffix << "Group" << idx << ");" << std::endl;
-}
-//--------------------------------------------------------------------------
-void Backend::genMergedExtraGlobalParamPush(CodeStream &os, const std::string &suffix, size_t mergedGroupIdx, size_t groupIdx,
-                                            const std::string &fieldName, const std::string &egpName) const
-{
-    os << "merged" << suffix << "Group" << mergedGroupIdx << "[" << groupIdx << "]." << fieldName << " = " << egpName << ";" << std::endl;
-}
-//--------------------------------------------------------------------------
-void Backend::genPopVariableInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const
-{
-    Substitutions varSubs(&kernelSubs);
-    handler(os, varSubs);
 }
 //--------------------------------------------------------------------------
 void Backend::genVariableInit(CodeStream &os, const std::string &count, const std::string &indexVarName,
@@ -768,6 +1010,9 @@ void Backend::genSynapseVariableRowInit(CodeStream &os, const SynapseGroupMerged
     if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
         os << "for (unsigned j = 0; j < group.rowLength[" << kernelSubs["id_pre"] << "]; j++)";
     }
+    else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+        os << "for (" << getSynapseIndexType(sg.getArchetype()) << " j = group.rowPtr[" << kernelSubs["id_pre"] << "]; j < group.rowPtr[" << kernelSubs["id_pre"] << " + 1]; j++)";
+    }
     else {
         os << "for (unsigned j = 0; j < group.numTrgNeurons; j++)";
     }
@@ -775,322 +1020,277 @@ void Backend::genSynapseVariableRowInit(CodeStream &os, const SynapseGroupMerged
         CodeStream::Scope b(os);
 
         Substitutions varSubs(&kernelSubs);
-        if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-            varSubs.addVarSubstitution("id_syn", "(" + kernelSubs["id_pre"] + " * group.rowStride) + j");
-            varSubs.addVarSubstitution("id_post", "group.ind[(" + kernelSubs["id_pre"] + " * group.rowStride) + j]");
+        if(isSparseLayoutSliced(sg.getArchetype())) {
+            os << "const " << getSynapseIndexType(sg.getArchetype()) << " n = group.slicedRowStart[" << kernelSubs["id_pre"] << "] + (" << getSynapseIndexCast(sg) << "j * group.slicedRowStride[" << kernelSubs["id_pre"] << "]);" << std::endl;
+            varSubs.addVarSubstitution("id_syn", "n");
+            varSubs.addVarSubstitution("id_post", "group.ind[n]");
+        }
+        else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+            varSubs.addVarSubstitution("id_syn", "(" + getSynapseIndexCast(sg) + kernelSubs["id_pre"] + " * group.rowStride) + j");
+            varSubs.addVarSubstitution("id_post", "group.ind[(" + getSynapseIndexCast(sg) + kernelSubs["id_pre"] + " * group.rowStride) + j]");
+        }
+        else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+            varSubs.addVarSubstitution("id_syn", "j");
+            varSubs.addVarSubstitution("id_post", "group.ind[j]");
         }
         else {
-            varSubs.addVarSubstitution("id_syn", "(" + kernelSubs["id_pre"] + " * group.rowStride) + j");
+            varSubs.addVarSubstitution("id_syn", "(" + getSynapseIndexCast(sg) + kernelSubs["id_pre"] + " * group.rowStride) + j");
             varSubs.addVarSubstitution("id_post", "j");
         }
         handler(os, varSubs);
     }
 }
 //--------------------------------------------------------------------------
-void Backend::genVariablePush(CodeStream&, const std::string&, const std::string&, VarLocation, bool, size_t) const
-{
-    assert(!m_Preferences.automaticCopy);
-}
-//--------------------------------------------------------------------------
-void Backend::genVariablePull(CodeStream&, const std::string&, const std::string&, VarLocation, size_t) const
-{
-    assert(!m_Preferences.automaticCopy);
-}
-//--------------------------------------------------------------------------
-void Backend::genCurrentVariablePush(CodeStream &, const NeuronGroupInternal &, const std::string &, const std::string &, VarLocation) const
-{
-    assert(!m_Preferences.automaticCopy);
-}
-//--------------------------------------------------------------------------
-void Backend::genCurrentVariablePull(CodeStream &, const NeuronGroupInternal &, const std::string &, const std::string &, VarLocation) const
-{
-    assert(!m_Preferences.automaticCopy);
-}
-//--------------------------------------------------------------------------
-void Backend::genCurrentTrueSpikePush(CodeStream&, const NeuronGroupInternal&) const
-{
-    assert(!m_Preferences.automaticCopy);
-}
-//--------------------------------------------------------------------------
-void Backend::genCurrentTrueSpikePull(CodeStream&, const NeuronGroupInternal&) const
-{
-    assert(!m_Preferences.automaticCopy);
-}
-//--------------------------------------------------------------------------
-void Backend::genCurrentSpikeLikeEventPush(CodeStream&, const NeuronGroupInternal&) const
+bool Backend::isSparseLayoutSliced(const SynapseGroupInternal &sg) const
 {
-    assert(!m_Preferences.automaticCopy);
-}
-//--------------------------------------------------------------------------
-void Backend::genCurrentSpikeLikeEventPull(CodeStream&, const NeuronGroupInternal&) const
-{
-    assert(!m_Preferences.automaticCopy);
-}
-//--------------------------------------------------------------------------
-MemAlloc Backend::genGlobalRNG(CodeStream &definitions, CodeStream &, CodeStream &runner, CodeStream &, CodeStream &) const
-{
-    definitions << "EXPORT_VAR " << "std::mt19937 rng;" << std::endl;
-    runner << "std::mt19937 rng;" << std::endl;
-
-    return MemAlloc::host(sizeof(std::mt19937));
+    // **NOTE** postsynaptic learning finds the presynaptic neuron of each synapse by dividing its row-major index by the row stride
+    return (m_Preferences.enableSlicedSparseLayout && (sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE)
+            && sg.getWUModel()->getLearnPostCode().empty());
 }
 //--------------------------------------------------------------------------
-MemAlloc Backend::genPopulationRNG(CodeStream &, CodeStream &, CodeStream &, CodeStream &, CodeStream &,
-                                   const std::string&, size_t) const
+unsigned int Backend::getSparseLayoutTileSize(const SynapseGroupInternal &sg) const
 {
-    // No need for population RNGs for single-threaded CPU
-    return MemAlloc::zero();
-}
-//--------------------------------------------------------------------------
-void Backend::genTimer(CodeStream &, CodeStream &, CodeStream &, CodeStream &, CodeStream &, CodeStream &, const std::string &, bool) const
-{
-    // Timing single-threaded CPU backends don't require any additional state
-}
-//--------------------------------------------------------------------------
-void Backend::genReturnFreeDeviceMemoryBytes(CodeStream &os) const
-{
-    // There is no 'device' when using single-threaded CPU backend
-    os << "return 0;" << std::endl;
-}
-//--------------------------------------------------------------------------
-void Backend::genMakefilePreamble(std::ostream &os) const
-{
-    std::string linkFlags = "-shared ";
-    std::string cxxFlags = "-c -fPIC -std=c++11 -MMD -MP -Wno-return-type-c-linkage";
-    cxxFlags += " " + m_Preferences.userCxxFlagsGNU;
-    if (m_Preferences.optimizeCode) {
-        cxxFlags += " -O3 -ffast-math";
+    // **NOTE** postsynaptic learning finds the presynaptic neuron of each synapse by dividing its row-major index by the row stride
+    if(m_Preferences.postsynapticTileSize != 0 && (sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE)
+       && sg.getWUModel()->getLearnPostCode().empty())
+    {
+        return m_Preferences.postsynapticTileSize;
     }
-    if (m_Preferences.debugCode) {
-        cxxFlags += " -O0 -g";
+    else {
+        return 0;
     }
-
-#ifdef MPI_ENABLE
-    // If MPI is enabled, add MPI include path
-    cxxFlags +=" -I\"$(MPI_PATH)/include\"";
-#endif
-
-    // Write variables to preamble
-    os << "CXXFLAGS := " << cxxFlags << std::endl;
-    os << "LINKFLAGS := " << linkFlags << std::endl;
-
-    os << std::endl;
-}
-//--------------------------------------------------------------------------
-void Backend::genMakefileLinkRule(std::ostream &os) const
-{
-    os << "\t@$(CXX) $(LINKFLAGS) -o $@ $(OBJECTS)" << std::endl;
-}
-//--------------------------------------------------------------------------
-void Backend::genMakefileCompileRule(std::ostream &os) const
-{
-    os << "%.o: %.cc %.d" << std::endl;
-    os << "\t@$(CXX) $(CXXFLAGS) -o $@ $<" << std::endl;
-}
-//--------------------------------------------------------------------------
-void Backend::genMSBuildConfigProperties(std::ostream&) const
-{
-}
-//--------------------------------------------------------------------------
-void Backend::genMSBuildImportProps(std::ostream&) const
-{
-}
-//--------------------------------------------------------------------------
-void Backend::genMSBuildItemDefinitions(std::ostream &os) const
-{
-    // Add item definition for host compilation
-    os << "\t\t<ClCompile>" << std::endl;
-    os << "\t\t\t<WarningLevel>Level3</WarningLevel>" << std::endl;
-    os << "\t\t\t<Optimization Condition=\"'$(Configuration)'=='Release'\">MaxSpeed</Optimization>" << std::endl;
-    os << "\t\t\t<Optimization Condition=\"'$(Configuration)'=='Debug'\">Disabled</Optimization>" << std::endl;
-    os << "\t\t\t<FunctionLevelLinking Condition=\"'$(Configuration)'=='Release'\">true</FunctionLevelLinking>" << std::endl;
-    os << "\t\t\t<IntrinsicFunctions Condition=\"'$(Configuration)'=='Release'\">true</IntrinsicFunctions>" << std::endl;
-    os << "\t\t\t<ExceptionHandling>SyncCThrow</ExceptionHandling>" << std::endl;
-    os << "\t\t\t<PreprocessorDefinitions Condition=\"'$(Configuration)'=='Release'\">WIN32;WIN64;NDEBUG;_CONSOLE;BUILDING_GENERATED_CODE;%(PreprocessorDefinitions)</PreprocessorDefinitions>" << std::endl;
-    os << "\t\t\t<PreprocessorDefinitions Condition=\"'$(Configuration)'=='Debug'\">WIN32;WIN64;_DEBUG;_CONSOLE;BUILDING_GENERATED_CODE;%(PreprocessorDefinitions)</PreprocessorDefinitions>" << std::endl;
-    os << "\t\t\t<FloatingPointModel>" << (m_Preferences.optimizeCode ? "Fast" : "Precise") << "</FloatingPointModel>" << std::endl;
-    os << "\t\t</ClCompile>" << std::endl;
-
-    // Add item definition for linking
-    os << "\t\t<Link>" << std::endl;
-    os << "\t\t\t<GenerateDebugInformation>true</GenerateDebugInformation>" << std::endl;
-    os << "\t\t\t<EnableCOMDATFolding Condition=\"'$(Configuration)'=='Release'\">true</EnableCOMDATFolding>" << std::endl;
-    os << "\t\t\t<OptimizeReferences Condition=\"'$(Configuration)'=='Release'\">true</OptimizeReferences>" << std::endl;
-    os << "\t\t\t<SubSystem>Console</SubSystem>" << std::endl;
-    os << "\t\t\t<AdditionalDependencies>kernel32.lib;user32.lib;gdi32.lib;winspool.lib;comdlg32.lib;advapi32.lib;shell32.lib;ole32.lib;oleaut32.lib;uuid.lib;odbc32.lib;odbccp32.lib;%(AdditionalDependencies)</AdditionalDependencies>" << std::endl;
-    os << "\t\t</Link>" << std::endl;
-}
-//--------------------------------------------------------------------------
-void Backend::genMSBuildCompileModule(const std::string &moduleName, std::ostream &os) const
-{
-    os << "\t\t<ClCompile Include=\"" << moduleName << ".cc\" />" << std::endl;
-}
-//--------------------------------------------------------------------------
-void Backend::genMSBuildImportTarget(std::ostream&) const
-{
 }
 //--------------------------------------------------------------------------
-bool Backend::isGlobalRNGRequired(const ModelSpecMerged &modelMerged) const
+void Backend::genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const SynapseGroupMerged &sg, const Substitutions &popSubs,
+                                   bool trueSpike, SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
+                                   SynapseGroupMergedHandler wumProceduralConnectHandler) const
 {
-    // If any neuron groups require simulation RNGs or require RNG for initialisation, return true
-    // **NOTE** this takes postsynaptic model initialisation into account
-    const ModelSpecInternal &model = modelMerged.getModel();
-    if(std::any_of(model.getNeuronGroups().cbegin(), model.getNeuronGroups().cend(),
-        [](const ModelSpec::NeuronGroupValueType &n)
-        {
-            return n.second.isSimRNGRequired() || n.second.isInitRNGRequired();
-        }))
-    {
-        return true;
+    // If connectivity is stored in the tiled layout, process spikes one tile at a time
+    if(getSparseLayoutTileSize(sg.getArchetype()) != 0) {
+        genTiledPresynapticUpdate(os, modelMerged, sg, popSubs, trueSpike, wumThreshHandler, wumSimHandler);
     }
-
-    // If any synapse groups require an RNG for weight update model initialisation, return true
-    if(std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
-        [](const ModelSpec::SynapseGroupValueType &s)
-        {
-            return s.second.isWUInitRNGRequired();
-        }))
-    {
-        return true;
+    else {
+        genRowPresynapticUpdate(os, modelMerged, sg, popSubs, trueSpike, false, wumThreshHandler, wumSimHandler, wumProceduralConnectHandler);
     }
-
-    return false;
 }
 //--------------------------------------------------------------------------
-void Backend::genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const SynapseGroupMerged &sg, const Substitutions &popSubs,
-                                   bool trueSpike, SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler) const
+void Backend::genTiledPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const SynapseGroupMerged &sg, const Substitutions &popSubs,
+                                        bool trueSpike, SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler) const
 {
     // Get suffix based on type of events
     const std::string eventSuffix = trueSpike ? "" : "Evnt";
     const auto *wu = sg.getArchetype().getWUModel();
-
-    // Detect spike events or spikes and do the update
-    os << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << std::endl;
-    if (sg.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
-        os << "for (unsigned int i = 0; i < group.srcSpkCnt" << eventSuffix << "[preReadDelaySlot]; i++)";
-    }
-    else {
-        os << "for (unsigned int i = 0; i < group.srcSpkCnt" << eventSuffix << "[0]; i++)";
-    }
+    const std::string indexType = getSynapseIndexType(sg.getArchetype());
+    const unsigned int tileSize = getSparseLayoutTileSize(sg.getArchetype());
+
+    // **NOTE** every event is processed once for each tile but, within a tile, input is only accumulated into its own postsynaptic neurons
+    os << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << " one tile of postsynaptic neurons at a time" << std::endl;
+    os << "const unsigned int numTiles" << eventSuffix << " = (group.numTrgNeurons + " << tileSize - 1 << ") / " << tileSize << ";" << std::endl;
+    os << "const " << indexType << " *tileRowPtr" << eventSuffix << " = group.tileRowPtr;" << std::endl;
+    os << "for(unsigned int tile = 0; tile < numTiles" << eventSuffix << "; tile++)";
     {
         CodeStream::Scope b(os);
-        if (!wu->getSimSupportCode().empty()) {
-            os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) <<  ";" << std::endl;
+        if (sg.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
+            os << "for (unsigned int i = 0; i < group.srcSpkCnt" << eventSuffix << "[preReadDelaySlot]; i++)";
         }
+        else {
+            os << "for (unsigned int i = 0; i < group.srcSpkCnt" << eventSuffix << "[0]; i++)";
+        }
+        {
+            CodeStream::Scope b(os);
+            if (!wu->getSimSupportCode().empty()) {
+                os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) <<  ";" << std::endl;
+            }
 
-        const std::string queueOffset = sg.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "preReadDelayOffset + " : "";
-        os << "const unsigned int ipre = group.srcSpk" << eventSuffix << "[" << queueOffset << "i];" << std::endl;
+            const std::string queueOffset = sg.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "preReadDelayOffset + " : "";
+            os << "const unsigned int ipre = group.srcSpk" << eventSuffix << "[" << queueOffset << "i];" << std::endl;
 
-        // If this is a spike-like event, insert threshold check for this presynaptic neuron
-        if (!trueSpike) {
-            os << "if(";
+            // If this is a spike-like event, insert threshold check for this presynaptic neuron
+            if (!trueSpike) {
+                os << "if(";
 
-            Substitutions threshSubs(&popSubs);
-            threshSubs.addVarSubstitution("id_pre", "ipre");
+                Substitutions threshSubs(&popSubs);
+                threshSubs.addVarSubstitution("id_pre", "ipre");
 
-            // Generate weight update threshold condition
-            wumThreshHandler(os, sg, threshSubs);
+                // Generate weight update threshold condition
+                wumThreshHandler(os, sg, threshSubs);
 
-            os << ")";
-            os << CodeStream::OB(10);
-        }
+                os << ")";
+                os << CodeStream::OB(10);
+            }
 
-        Substitutions synSubs(&popSubs);
-        synSubs.addVarSubstitution("id_pre", "ipre");
-        synSubs.addVarSubstitution("id_post", "ipost");
-        synSubs.addVarSubstitution("id_syn", "synAddress");
+            Substitutions synSubs(&popSubs);
+            synSubs.addVarSubstitution("id_pre", "ipre");
+            synSubs.addVarSubstitution("id_post", "ipost");
+            synSubs.addVarSubstitution("id_syn", "synAddress");
 
-        if(sg.getArchetype().isDendriticDelayRequired()) {
-            synSubs.addFuncSubstitution("addToInSynDelay", 2, "group.denDelay[" + sg.getDendriticDelayOffset("$(1)") + "ipost] += $(0)");
-        }
-        else {
-            synSubs.addFuncSubstitution("addToInSyn", 1, "group.inSyn[ipost] += $(0)");
-        }
+            if(sg.getArchetype().isDendriticDelayRequired()) {
+                synSubs.addFuncSubstitution("addToInSynDelay", 2, "group.denDelay[" + sg.getDendriticDelayOffset("$(1)") + "ipost] += $(0)");
+            }
+            else {
+                synSubs.addFuncSubstitution("addToInSyn", 1, "group.inSyn[ipost] += $(0)");
+            }
 
-        if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-            os << "const unsigned int npost = group.rowLength[ipre];" << std::endl;
-            os << "for (unsigned int j = 0; j < npost; j++)";
+            // Loop through the synapses of this row which target this tile
+            os << "for (" << indexType << " synAddress = tileRowPtr" << eventSuffix << "[ipre]; synAddress < tileRowPtr" << eventSuffix << "[ipre + 1]; synAddress++)";
             {
                 CodeStream::Scope b(os);
-
-                // **TODO** seperate stride from max connection
-                os << "const unsigned int synAddress = (ipre * group.rowStride) + j;" << std::endl;
                 os << "const unsigned int ipost = group.ind[synAddress];" << std::endl;
 
                 wumSimHandler(os, sg, synSubs);
             }
-        }
-        else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL) {
-            throw std::runtime_error("The single-threaded CPU backend does not support procedural connectivity.");
-        }
-        else if(m_Preferences.enableBitmaskOptimisations && (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK)) {
-            // Determine the number of words in each row
-            os << "const unsigned int rowWords = ((group.numTrgNeurons + 32 - 1) / 32);" << std::endl;
-            os << "for(unsigned int w = 0; w < rowWords; w++)";
-            {
-                CodeStream::Scope b(os);
-
-                // Read row word
-                os << "uint32_t connectivityWord = group.gp[(ipre * rowWords) + w];" << std::endl;
-
-                // Set ipost to first synapse in connectivity word
-                os << "unsigned int ipost = w * 32;" << std::endl;
-
-                // While there any bits left
-                os << "while(connectivityWord != 0)";
-                {
-                    CodeStream::Scope b(os);
 
-                    // Cound leading zeros (as bits are indexed backwards this is index of next synapse)
-                    os << "const int numLZ = gennCLZ(connectivityWord);" << std::endl;
-
-                    // Shift off zeros and the one just discovered
-                    // **NOTE** << 32 appears to result in undefined behaviour
-                    os << "connectivityWord = (numLZ == 31) ? 0 : (connectivityWord << (numLZ + 1));" << std::endl;
-
-                    // Add to ipost
-                    os << "ipost += numLZ;" << std::endl;
-
-                    // If we aren't in padding region
-                    // **TODO** don't bother checking if there is no padding
-                    os << "if(ipost < group.numTrgNeurons)";
-                    {
-                        CodeStream::Scope b(os);
-                        wumSimHandler(os, sg, synSubs);
-                    }
-
-                    // Increment ipost to take into account fact the next CLZ will go from bit AFTER synapse
-                    os << "ipost++;" << std::endl;
-                }
+            if (!trueSpike) {
+                os << CodeStream::CB(10);
             }
         }
-        // Otherwise (DENSE or BITMASK)
-        else {
-            os << "for (unsigned int ipost = 0; ipost < group.numTrgNeurons; ipost++)";
-            {
-                CodeStream::Scope b(os);
 
-                if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
-                    os << "const uint64_t gid = (ipre * (uint64_t)group.numTrgNeurons + ipost);" << std::endl;
-                    os << "if (B(group.gp[gid / 32], gid & 31))" << CodeStream::OB(20);
-                }
+        // **NOTE** the row pointers of each tile follow those of the previous one
+        os << "tileRowPtr" << eventSuffix << " += group.numSrcNeurons;" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+bool Backend::isSlicedSynapseDynamicsIndependent(const SynapseGroupMerged &sg) const
+{
+    // **NOTE** the rows at each position of a slice are distinct but several of them may target the same postsynaptic neuron
+    // so synapse dynamics which add to postsynaptic input or access postsynaptic state may have loop-carried dependencies.
+    // Extra global parameters are also excluded as they can be indexed arbitrarily.
+    const auto *wum = sg.getArchetype().getWUModel();
+    const std::string &code = wum->getSynapseDynamicsCode();
+    return ((code.find("$(addToInSyn") == std::string::npos) && (code.find("_post)") == std::string::npos)
+            && (code.find("$(id_post)") == std::string::npos) && wum->getExtraGlobalParams().empty());
+}
+//--------------------------------------------------------------------------
+void Backend::genSlicedLayout(CodeStream &os, const SynapseGroupMerged &sg) const
+{
+    // **NOTE** a stable sort is used so rows of the same length stay in their original order
+    const std::string indexType = getSynapseIndexType(sg.getArchetype());
+    const unsigned int sliceSize = m_Preferences.sparseSliceSize;
+    const unsigned int windowSize = m_Preferences.sparseSortWindowSize;
+    os << "// Sort rows within each window by descending length" << std::endl;
+    os << "for(unsigned int windowBegin = 0; windowBegin < group.numSrcNeurons; windowBegin += " << windowSize << ")";
+    {
+        CodeStream::Scope b(os);
+        os << "unsigned int *windowRows = &group.slicedRowOrder[windowBegin];" << std::endl;
+        os << "unsigned int *windowRowsEnd = &group.slicedRowOrder[std::min(windowBegin + " << windowSize << "u, group.numSrcNeurons)];" << std::endl;
+        os << "std::iota(windowRows, windowRowsEnd, windowBegin);" << std::endl;
+        os << "std::stable_sort(windowRows, windowRowsEnd," << std::endl;
+        os << "                 [&group](unsigned int a, unsigned int b){ return group.rowLength[a] > group.rowLength[b]; });" << std::endl;
+    }
 
-                os << "const unsigned int synAddress = (ipre * group.numTrgNeurons) + ipost;" << std::endl;
+    // **NOTE** each slice is padded to the length of its first and hence longest row
+    os << "// Interleave the synapses of each slice of rows so the synapses at each position within them are contiguous" << std::endl;
+    os << indexType << " sliceStart = 0;" << std::endl;
+    os << "for(unsigned int sliceBegin = 0; sliceBegin < group.numSrcNeurons; sliceBegin += " << sliceSize << ")";
+    {
+        CodeStream::Scope b(os);
+        os << "const unsigned int sliceStride = std::min(" << sliceSize << "u, group.numSrcNeurons - sliceBegin);" << std::endl;
+        os << "for(unsigned int r = 0; r < sliceStride; r++)";
+        {
+            CodeStream::Scope b(os);
+            os << "group.slicedRowStart[group.slicedRowOrder[sliceBegin + r]] = sliceStart + r;" << std::endl;
+            os << "group.slicedRowStride[group.slicedRowOrder[sliceBegin + r]] = sliceStride;" << std::endl;
+        }
+        os << "sliceStart += " << getSynapseIndexCast(sg) << "sliceStride * group.rowLength[group.slicedRowOrder[sliceBegin]];" << std::endl;
+    }
 
-                wumSimHandler(os, sg, synSubs);
+    // Move postsynaptic indices into sliced layout
+    genSliceArray(os, sg, sg.getArchetype().getSparseIndType(), "ind");
+}
+//--------------------------------------------------------------------------
+void Backend::genSliceArray(CodeStream &os, const SynapseGroupMerged &sg, const std::string &type, const std::string &name) const
+{
+    CodeStream::Scope b(os);
+    os << "// Move " << name << " from row-major into sliced layout" << std::endl;
+    os << "const std::vector<" << type << "> rowMajor(group." << name << ", group." << name << " + (" << getSynapseIndexCast(sg) << "group.numSrcNeurons * group.rowStride));" << std::endl;
+    os << "for(unsigned int i = 0; i < group.numSrcNeurons; i++)";
+    {
+        CodeStream::Scope b(os);
+        os << "for(unsigned int j = 0; j < group.rowLength[i]; j++)";
+        {
+            CodeStream::Scope b(os);
+            os << "group." << name << "[group.slicedRowStart[i] + (" << getSynapseIndexCast(sg) << "j * group.slicedRowStride[i])] = rowMajor[(" << getSynapseIndexCast(sg) << "i * group.rowStride) + j];" << std::endl;
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genTiledLayout(CodeStream &os, const SynapseGroupMerged &sg) const
+{
+    const std::string indexType = getSynapseIndexType(sg.getArchetype());
+    const unsigned int tileSize = getSparseLayoutTileSize(sg.getArchetype());
+    os << "const unsigned int numTiles = (group.numTrgNeurons + " << tileSize - 1 << ") / " << tileSize << ";" << std::endl;
+
+    // **NOTE** synapses in each row of each tile stay in their row-major order
+    os << "// Count the synapses of each row which target each tile" << std::endl;
+    os << "std::fill_n(group.tileRowPtr, (" << getSynapseIndexCast(sg) << "numTiles * group.numSrcNeurons) + 1, 0);" << std::endl;
+    os << "for(unsigned int i = 0; i < group.numSrcNeurons; i++)";
+    {
+        CodeStream::Scope b(os);
+        os << "for(unsigned int j = 0; j < group.rowLength[i]; j++)";
+        {
+            CodeStream::Scope b(os);
+            os << "const unsigned int tile = group.ind[(" << getSynapseIndexCast(sg) << "i * group.rowStride) + j] / " << tileSize << ";" << std::endl;
+            os << "group.tileRowPtr[(" << getSynapseIndexCast(sg) << "tile * group.numSrcNeurons) + i + 1]++;" << std::endl;
+        }
+    }
 
-                if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
-                    os << CodeStream::CB(20);
-                }
-            }
+    os << "// Convert counts into pointers to the start of each row within each tile" << std::endl;
+    os << "std::partial_sum(group.tileRowPtr, group.tileRowPtr + (" << getSynapseIndexCast(sg) << "numTiles * group.numSrcNeurons) + 1, group.tileRowPtr);" << std::endl;
+
+    os << "// Calculate where each synapse is moved to, advancing a cursor along each row of each tile" << std::endl;
+    os << "std::vector<" << indexType << "> tileCursor(group.tileRowPtr, group.tileRowPtr + (" << getSynapseIndexCast(sg) << "numTiles * group.numSrcNeurons));" << std::endl;
+    os << "tiledSynapse.resize(" << getSynapseIndexCast(sg) << "group.numSrcNeurons * group.rowStride);" << std::endl;
+    os << "for(unsigned int i = 0; i < group.numSrcNeurons; i++)";
+    {
+        CodeStream::Scope b(os);
+        os << "for(unsigned int j = 0; j < group.rowLength[i]; j++)";
+        {
+            CodeStream::Scope b(os);
+            os << "const " << indexType << " rowMajorIndex = (" << getSynapseIndexCast(sg) << "i * group.rowStride) + j;" << std::endl;
+            os << "const unsigned int tile = group.ind[rowMajorIndex] / " << tileSize << ";" << std::endl;
+            os << "tiledSynapse[rowMajorIndex] = tileCursor[(" << getSynapseIndexCast(sg) << "tile * group.numSrcNeurons) + i]++;" << std::endl;
         }
-        // If this is a spike-like event, close braces around threshold check
-        if (!trueSpike) {
-            os << CodeStream::CB(10);
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genTileArray(CodeStream &os, const SynapseGroupMerged &sg, const std::string &type, const std::string &name) const
+{
+    CodeStream::Scope b(os);
+    os << "// Move " << name << " from row-major into tiled layout" << std::endl;
+    os << "const std::vector<" << type << "> rowMajor(group." << name << ", group." << name << " + (" << getSynapseIndexCast(sg) << "group.numSrcNeurons * group.rowStride));" << std::endl;
+    os << "for(unsigned int i = 0; i < group.numSrcNeurons; i++)";
+    {
+        CodeStream::Scope b(os);
+        os << "for(unsigned int j = 0; j < group.rowLength[i]; j++)";
+        {
+            CodeStream::Scope b(os);
+            os << "const " << getSynapseIndexType(sg.getArchetype()) << " rowMajorIndex = (" << getSynapseIndexCast(sg) << "i * group.rowStride) + j;" << std::endl;
+            os << "group." << name << "[tiledSynapse[rowMajorIndex]] = rowMajor[rowMajorIndex];" << std::endl;
         }
     }
 }
 //--------------------------------------------------------------------------
+bool Backend::isNeuronUpdateVectorised(const NeuronGroupMerged &ng) const
+{
+    // **NOTE** global RNG has state shared between neurons and weight update model pre and postsynaptic
+    // spike code is run when spikes are emitted so would read neuron state after it had been updated
+    return (m_Preferences.enableVectorisedNeuronUpdate
+            && (!ng.getArchetype().isSimRNGRequired() || m_Preferences.enableCounterBasedRNG)
+            && ng.getArchetype().getOutSynWithPreCode().empty() && ng.getArchetype().getInSynWithPostCode().empty());
+}
+//--------------------------------------------------------------------------
+void Backend::genGetMergedGroup(CodeStream &os, const std::string &suffix, size_t idx) const
+{
+    // **NOTE** in re-entrant models, merged group arrays are thread-local and compilers recompute the address of thread-local
+    // variables each time a reference to one is used. In shared libraries this requires a call to __tls_get_addr so copy group instead
+    if(m_Preferences.enableReentrantModel) {
+        os << "const auto group = merged" << suffix << "Group" << idx << "[g];" << std::endl;
+    }
+    else {
+        os << "const auto &group = merged" << suffix << "Group" << idx << "[g]; " << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
 void Backend::genEmitSpike(CodeStream &os, const NeuronGroupMerged &ng, const Substitutions &subs, bool trueSpike) const
 {
     // Determine if delay is required and thus, at what offset we should write into the spike queue
@@ -1112,6 +1312,11 @@ void Backend::genEmitSpike(CodeStream &os, const NeuronGroupMerged &ng, const Su
         const std::string queueOffset = ng.getArchetype().isDelayRequired() ? "writeDelayOffset + " : "";
         os << "group.sT[" << queueOffset << subs["id"] << "] = " << subs["t"] << ";" << std::endl;
     }
+
+    // If this is a true spike and spike recording is enabled, set neuron's bit in this timestep's recording words
+    if(trueSpike && ng.getArchetype().isSpikeRecordingEnabled()) {
+        os << "group.recordSpk[recordingOffset + (" << subs["id"] << " / 32)] |= (1u << (" << subs["id"] << " % 32));" << std::endl;
+    }
 }
 }   // namespace SingleThreadedCPU
 }   // namespace CodeGenerator
@@ -1,8 +1,14 @@
 #include "code_generator/backendBase.h"
 
+// Standard C++ includes
+#include <algorithm>
+#include <limits>
+
 // GeNN includes
 #include "gennUtils.h"
 #include "logging.h"
+#include "neuronGroupInternal.h"
+#include "synapseGroupInternal.h"
 
 // Macro for simplifying defining type sizes
 #define TYPE(T) {#T, sizeof(T)}
@@ -47,3 +53,20 @@ size_t CodeGenerator::BackendBase::getSize(const std::string &type) const
         }
     }
 }
+//--------------------------------------------------------------------------
+bool CodeGenerator::BackendBase::areSixtyFourBitSynapseIndicesRequired(const SynapseGroupInternal &sg) const
+{
+    // CSR synapses are stored contiguously so the maximum index is determined by the maximum number of synapses
+    if(sg.getMatrixType() & SynapseMatrixConnectivity::CSR) {
+        return (sg.getMaxSynapses() > std::numeric_limits<uint32_t>::max());
+    }
+    // Otherwise, synapses are indexed by presynaptic neuron and position within (padded) row
+    else {
+        const size_t maxRowMajorSynapses = (size_t)sg.getSrcNeuronGroup()->getNumNeurons() * getSynapticMatrixRowStride(sg);
+
+        // **NOTE** column-major remapping structures used for postsynaptic learning with sparse connectivity are indexed in the same way
+        const size_t maxColMajorSynapses = (sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE)
+            ? ((size_t)sg.getTrgNeuronGroup()->getNumNeurons() * sg.getMaxSourceConnections()) : 0;
+        return (std::max(maxRowMajorSynapses, maxColMajorSynapses) > std::numeric_limits<uint32_t>::max());
+    }
+}
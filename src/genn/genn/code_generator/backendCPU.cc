@@ -0,0 +1,978 @@
+#include "code_generator/backendCPU.h"
+
+// Standard C++ includes
+#include <algorithm>
+#include <random>
+#include <sstream>
+
+// Filesystem includes
+#include "path.h"
+
+// GeNN includes
+#include "gennUtils.h"
+#include "modelSpecInternal.h"
+
+// GeNN code generator includes
+#include "code_generator/codeStream.h"
+#include "code_generator/expressionParser.h"
+#include "code_generator/modelSpecMerged.h"
+#include "code_generator/substitutions.h"
+
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+const std::vector<CodeGenerator::FunctionTemplate> cpuFunctions = {
+    {"gennrand_uniform", 0, "standardUniformDistribution($(rng))", "standardUniformDistribution($(rng))"},
+    {"gennrand_normal", 0, "standardNormalDistribution($(rng))", "standardNormalDistribution($(rng))"},
+    {"gennrand_exponential", 0, "standardExponentialDistribution($(rng))", "standardExponentialDistribution($(rng))"},
+    {"gennrand_log_normal", 2, "std::lognormal_distribution<double>($(0), $(1))($(rng))", "std::lognormal_distribution<float>($(0), $(1))($(rng))"},
+    {"gennrand_gamma", 1, "std::gamma_distribution<double>($(0), 1.0)($(rng))", "std::gamma_distribution<float>($(0), 1.0f)($(rng))"}
+};
+
+//! Functions used with counter-based Philox RNGs e.g. when regenerating procedural connectivity
+/*! **NOTE** unlike the global host distributions used elsewhere, which may cache state between calls
+    (std::normal_distribution generates values in pairs), distributions are recreated on each call
+    so that the numbers drawn only depend on the key and counter of the RNG */
+const std::vector<CodeGenerator::FunctionTemplate> cpuCounterBasedRNGFunctions = {
+    {"gennrand_uniform", 0, "std::uniform_real_distribution<double>(0.0, 1.0)($(rng))", "std::uniform_real_distribution<float>(0.0f, 1.0f)($(rng))"},
+    {"gennrand_normal", 0, "std::normal_distribution<double>(0.0, 1.0)($(rng))", "std::normal_distribution<float>(0.0f, 1.0f)($(rng))"},
+    {"gennrand_exponential", 0, "std::exponential_distribution<double>(1.0)($(rng))", "std::exponential_distribution<float>(1.0f)($(rng))"},
+    {"gennrand_log_normal", 2, "std::lognormal_distribution<double>($(0), $(1))($(rng))", "std::lognormal_distribution<float>($(0), $(1))($(rng))"},
+    {"gennrand_gamma", 1, "std::gamma_distribution<double>($(0), 1.0)($(rng))", "std::gamma_distribution<float>($(0), 1.0f)($(rng))"}
+};
+
+//! Number of postsynaptic neurons whose weighted sums are accumulated together
+/*! **NOTE** 1024 double-precision sums take 8KB so, along with the rows of weights streaming through, stay in L1 cache */
+const unsigned int weightedSumBlockSize = 1024;
+}   // Anonymous namespace
+
+//--------------------------------------------------------------------------
+// CodeGenerator::BackendCPU
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+size_t BackendCPU::getSynapticMatrixRowStride(const SynapseGroupInternal &sg) const
+{
+    if (sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+        return sg.getMaxConnections();
+    }
+    else if(m_CPUPreferences.enableBitmaskOptimisations && (sg.getMatrixType() & SynapseMatrixConnectivity::BITMASK)) {
+        return padSize(sg.getTrgNeuronGroup()->getNumNeurons(), 32);
+    }
+    else {
+        return sg.getTrgNeuronGroup()->getNumNeurons();
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
+{
+    const ModelSpecInternal &model = modelMerged.getModel();
+
+    os << "// Standard C++ includes" << std::endl;
+    os << "#include <algorithm>" << std::endl;
+    os << "#include <chrono>" << std::endl;
+    os << "#include <iostream>" << std::endl;
+    os << "#include <numeric>" << std::endl;
+    os << "#include <random>" << std::endl;
+    os << "#include <stdexcept>" << std::endl;
+    os << "#include <string>" << std::endl;
+    os << "#include <vector>" << std::endl;
+    os << std::endl;
+    os << "// Standard C includes" << std::endl;
+    os << "#include <cmath>" << std::endl;
+    os << "#include <cstdint>" << std::endl;
+    os << "#include <cstdio>" << std::endl;
+    os << "#include <cstring>" << std::endl;
+
+     // If a global RNG is required, define standard host distributions as recreating them each call is slow
+    if(isGlobalRNGRequired(modelMerged)) {
+        os << "EXPORT_VAR " << "std::uniform_real_distribution<" << model.getPrecision() << "> standardUniformDistribution;" << std::endl;
+        os << "EXPORT_VAR " << "std::normal_distribution<" << model.getPrecision() << "> standardNormalDistribution;" << std::endl;
+        os << "EXPORT_VAR " << "std::exponential_distribution<" << model.getPrecision() << "> standardExponentialDistribution;" << std::endl;
+        os << std::endl;
+    }
+
+    // If a counter-based RNG is required, declare key used to generate all Philox RNG streams
+    if(isPhiloxRNGRequired(modelMerged)) {
+        os << "EXPORT_VAR uint32_t philoxRNGKey;" << std::endl;
+        os << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
+{
+    os << "#define SUPPORT_CODE_FUNC inline" << std::endl;
+
+    // On windows, define an inline function, matching the signature of __builtin_clz which counts leading zeros
+#ifdef _WIN32
+    os << "#include <intrin.h>" << std::endl;
+    os << std::endl;
+    os << "int inline gennCLZ(unsigned int value)";
+    {
+        CodeStream::Scope b(os);
+        os << "unsigned long leadingZero = 0;" << std::endl;
+        os << "if( _BitScanReverse(&leadingZero, value))";
+        {
+            CodeStream::Scope b(os);
+            os << "return 31 - leadingZero;" << std::endl;
+        }
+        os << "else";
+        {
+            CodeStream::Scope b(os);
+            os << "return 32;" << std::endl;
+        }
+    }
+    // Otherwise, on *nix, use __builtin_clz intrinsic
+#else
+    os << "#define gennCLZ __builtin_clz" << std::endl;
+#endif
+    os << std::endl;
+
+    // If a counter-based RNG is required for procedural connectivity or simulation, generate Philox RNG
+    if(isPhiloxRNGRequired(modelMerged)) {
+        genHostPhiloxRNG(os);
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
+{
+    const ModelSpecInternal &model = modelMerged.getModel();
+
+    // If a global RNG is required, implement standard host distributions as recreating them each call is slow
+    if(isGlobalRNGRequired(modelMerged)) {
+        os << getStateStorageSpecifier() << "std::uniform_real_distribution<" << model.getPrecision() << "> standardUniformDistribution(" << model.scalarExpr(0.0) << ", " << model.scalarExpr(1.0) << ");" << std::endl;
+        os << getStateStorageSpecifier() << "std::normal_distribution<" << model.getPrecision() << "> standardNormalDistribution(" << model.scalarExpr(0.0) << ", " << model.scalarExpr(1.0) << ");" << std::endl;
+        os << getStateStorageSpecifier() << "std::exponential_distribution<" << model.getPrecision() << "> standardExponentialDistribution(" << model.scalarExpr(1.0) << ");" << std::endl;
+        os << std::endl;
+    }
+    if(isPhiloxRNGRequired(modelMerged)) {
+        os << getStateStorageSpecifier() << "uint32_t philoxRNGKey;" << std::endl;
+        os << std::endl;
+    }
+    os << "template<class T>" << std::endl;
+    os << "T *getSymbolAddress(T &devSymbol)";
+    {
+        CodeStream::Scope b(os);
+        os << "return &devSymbol;" << std::endl;
+    }
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genAllocateMemPreamble(CodeStream &, const ModelSpecMerged &) const
+{
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genStepTimeFinalisePreamble(CodeStream &, const ModelSpecMerged &) const
+{
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genVariableDefinition(CodeStream &definitions, CodeStream &, const std::string &type, const std::string &name, VarLocation) const
+{
+    definitions << "EXPORT_VAR " << type << " " << name << ";" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genVariableImplementation(CodeStream &os, const std::string &type, const std::string &name, VarLocation) const
+{
+    os << getStateStorageSpecifier() << type << " " << name << ";" << std::endl;
+}
+//--------------------------------------------------------------------------
+MemAlloc BackendCPU::genVariableAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation, size_t count) const
+{
+    os << name << " = new " << type << "[" << count << "];" << std::endl;
+
+    return MemAlloc::host(count * getSize(type));
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genVariableFree(CodeStream &os, const std::string &name, VarLocation) const
+{
+    os << "delete[] " << name << ";" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genExtraGlobalParamDefinition(CodeStream &definitions, const std::string &type, const std::string &name, VarLocation) const
+{
+    definitions << "EXPORT_VAR " << type << " " << name << ";" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genExtraGlobalParamImplementation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const
+{
+    genVariableImplementation(os, type, name, loc);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genExtraGlobalParamAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation) const
+{
+    // Get underlying type
+    // **NOTE** could use std::remove_pointer but it seems unnecessarily elaborate
+    const std::string underlyingType = Utils::getUnderlyingType(type);
+
+    os << name << " = new " << underlyingType << "[count];" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genExtraGlobalParamPush(CodeStream &, const std::string &, const std::string &, VarLocation) const
+{
+    assert(!m_CPUPreferences.automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genExtraGlobalParamPull(CodeStream &, const std::string &, const std::string &, VarLocation) const
+{
+    assert(!m_CPUPreferences.automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMergedGroupImplementation(CodeStream &os, const std::string &suffix, size_t idx, size_t numGroups) const
+{
+    os << getStateStorageSpecifier() << "Merged" << suffix << "Group" << idx << " merged" << suffix << "Group" << idx << "[" << numGroups << "];" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMergedGroupPush(CodeStream &os, const std::string &suffix, size_t idx, size_t numGroups) const
+{
+    os << "std::copy_n(group, " << numGroups << ", merged" << suffix << "Group" << idx << ");" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMergedExtraGlobalParamPush(CodeStream &os, const std::string &suffix, size_t mergedGroupIdx, size_t groupIdx,
+                                               const std::string &fieldName, const std::string &egpName) const
+{
+    os << "merged" << suffix << "Group" << mergedGroupIdx << "[" << groupIdx << "]." << fieldName << " = " << egpName << ";" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genPopVariableInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const
+{
+    Substitutions varSubs(&kernelSubs);
+    handler(os, varSubs);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genVariablePush(CodeStream&, const std::string&, const std::string&, VarLocation, bool, size_t) const
+{
+    assert(!m_CPUPreferences.automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genVariablePull(CodeStream&, const std::string&, const std::string&, VarLocation, size_t) const
+{
+    assert(!m_CPUPreferences.automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genCurrentVariablePush(CodeStream &, const NeuronGroupInternal &, const std::string &, const std::string &, VarLocation) const
+{
+    assert(!m_CPUPreferences.automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genCurrentVariablePull(CodeStream &, const NeuronGroupInternal &, const std::string &, const std::string &, VarLocation) const
+{
+    assert(!m_CPUPreferences.automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genCurrentTrueSpikePush(CodeStream&, const NeuronGroupInternal&) const
+{
+    assert(!m_CPUPreferences.automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genCurrentTrueSpikePull(CodeStream&, const NeuronGroupInternal&) const
+{
+    assert(!m_CPUPreferences.automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genCurrentSpikeLikeEventPush(CodeStream&, const NeuronGroupInternal&) const
+{
+    assert(!m_CPUPreferences.automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genCurrentSpikeLikeEventPull(CodeStream&, const NeuronGroupInternal&) const
+{
+    assert(!m_CPUPreferences.automaticCopy);
+}
+//--------------------------------------------------------------------------
+MemAlloc BackendCPU::genGlobalRNG(CodeStream &definitions, CodeStream &, CodeStream &runner, CodeStream &, CodeStream &) const
+{
+    definitions << "EXPORT_VAR " << "std::mt19937 rng;" << std::endl;
+    runner << getStateStorageSpecifier() << "std::mt19937 rng;" << std::endl;
+
+    return MemAlloc::host(sizeof(std::mt19937));
+}
+//--------------------------------------------------------------------------
+MemAlloc BackendCPU::genPopulationRNG(CodeStream &, CodeStream &, CodeStream &, CodeStream &, CodeStream &,
+                                      const std::string&, size_t) const
+{
+    // No need for population RNGs for CPU backends
+    return MemAlloc::zero();
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genTimer(CodeStream &, CodeStream &, CodeStream &, CodeStream &, CodeStream &, CodeStream &, const std::string &, bool) const
+{
+    // Timing CPU backends don't require any additional state
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genReturnFreeDeviceMemoryBytes(CodeStream &os) const
+{
+    // There is no 'device' when using CPU backends
+    os << "return 0;" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMakefilePreamble(std::ostream &os) const
+{
+    std::string linkFlags = "-shared ";
+    std::string cxxFlags = "-c -fPIC -std=c++11 -MMD -MP -Wno-return-type-c-linkage";
+    if(isOpenMPRequired()) {
+        linkFlags += "-fopenmp ";
+        cxxFlags += " -fopenmp";
+    }
+    cxxFlags += " " + m_CPUPreferences.userCxxFlagsGNU;
+    if (m_CPUPreferences.optimizeCode) {
+        cxxFlags += " -O3 -ffast-math";
+    }
+    if (m_CPUPreferences.debugCode) {
+        cxxFlags += " -O0 -g";
+    }
+
+#ifdef MPI_ENABLE
+    // If MPI is enabled, add MPI include path
+    cxxFlags +=" -I\"$(MPI_PATH)/include\"";
+#endif
+
+    // Write variables to preamble
+    os << "CXXFLAGS := " << cxxFlags << std::endl;
+    os << "LINKFLAGS := " << linkFlags << std::endl;
+
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMakefileLinkRule(std::ostream &os) const
+{
+    os << "\t@$(CXX) $(LINKFLAGS) -o $@ $(OBJECTS)" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMakefileCompileRule(std::ostream &os) const
+{
+    os << "%.o: %.cc %.d" << std::endl;
+    os << "\t@$(CXX) $(CXXFLAGS) -o $@ $<" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMSBuildConfigProperties(std::ostream&) const
+{
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMSBuildImportProps(std::ostream&) const
+{
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMSBuildItemDefinitions(std::ostream &os) const
+{
+    // Add item definition for host compilation
+    os << "\t\t<ClCompile>" << std::endl;
+    os << "\t\t\t<WarningLevel>Level3</WarningLevel>" << std::endl;
+    os << "\t\t\t<Optimization Condition=\"'$(Configuration)'=='Release'\">MaxSpeed</Optimization>" << std::endl;
+    os << "\t\t\t<Optimization Condition=\"'$(Configuration)'=='Debug'\">Disabled</Optimization>" << std::endl;
+    os << "\t\t\t<FunctionLevelLinking Condition=\"'$(Configuration)'=='Release'\">true</FunctionLevelLinking>" << std::endl;
+    os << "\t\t\t<IntrinsicFunctions Condition=\"'$(Configuration)'=='Release'\">true</IntrinsicFunctions>" << std::endl;
+    os << "\t\t\t<ExceptionHandling>SyncCThrow</ExceptionHandling>" << std::endl;
+    os << "\t\t\t<PreprocessorDefinitions Condition=\"'$(Configuration)'=='Release'\">WIN32;WIN64;NDEBUG;_CONSOLE;BUILDING_GENERATED_CODE;%(PreprocessorDefinitions)</PreprocessorDefinitions>" << std::endl;
+    os << "\t\t\t<PreprocessorDefinitions Condition=\"'$(Configuration)'=='Debug'\">WIN32;WIN64;_DEBUG;_CONSOLE;BUILDING_GENERATED_CODE;%(PreprocessorDefinitions)</PreprocessorDefinitions>" << std::endl;
+    os << "\t\t\t<FloatingPointModel>" << (m_CPUPreferences.optimizeCode ? "Fast" : "Precise") << "</FloatingPointModel>" << std::endl;
+    if(isOpenMPRequired()) {
+        os << "\t\t\t<OpenMPSupport>true</OpenMPSupport>" << std::endl;
+    }
+    os << "\t\t</ClCompile>" << std::endl;
+
+    // Add item definition for linking
+    os << "\t\t<Link>" << std::endl;
+    os << "\t\t\t<GenerateDebugInformation>true</GenerateDebugInformation>" << std::endl;
+    os << "\t\t\t<EnableCOMDATFolding Condition=\"'$(Configuration)'=='Release'\">true</EnableCOMDATFolding>" << std::endl;
+    os << "\t\t\t<OptimizeReferences Condition=\"'$(Configuration)'=='Release'\">true</OptimizeReferences>" << std::endl;
+    os << "\t\t\t<SubSystem>Console</SubSystem>" << std::endl;
+    os << "\t\t\t<AdditionalDependencies>kernel32.lib;user32.lib;gdi32.lib;winspool.lib;comdlg32.lib;advapi32.lib;shell32.lib;ole32.lib;oleaut32.lib;uuid.lib;odbc32.lib;odbccp32.lib;%(AdditionalDependencies)</AdditionalDependencies>" << std::endl;
+    os << "\t\t</Link>" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMSBuildCompileModule(const std::string &moduleName, std::ostream &os) const
+{
+    os << "\t\t<ClCompile Include=\"" << moduleName << ".cc\" />" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMSBuildImportTarget(std::ostream&) const
+{
+}
+//--------------------------------------------------------------------------
+bool BackendCPU::isGlobalRNGRequired(const ModelSpecMerged &modelMerged) const
+{
+    // If any neuron groups require simulation RNGs (which aren't counter-based) or require RNG for initialisation, return true
+    // **NOTE** this takes postsynaptic model initialisation into account
+    const ModelSpecInternal &model = modelMerged.getModel();
+    if(std::any_of(model.getNeuronGroups().cbegin(), model.getNeuronGroups().cend(),
+        [this](const ModelSpec::NeuronGroupValueType &n)
+        {
+            return (n.second.isSimRNGRequired() && !m_CPUPreferences.enableCounterBasedRNG) || n.second.isInitRNGRequired();
+        }))
+    {
+        return true;
+    }
+
+    // If any synapse groups require an RNG for weight update model initialisation, return true
+    if(std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
+        [](const ModelSpec::SynapseGroupValueType &s)
+        {
+            return s.second.isWUInitRNGRequired();
+        }))
+    {
+        return true;
+    }
+
+    return false;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genRowPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const SynapseGroupMerged &sg, const Substitutions &popSubs,
+                                         bool trueSpike, bool parallel, SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
+                                         SynapseGroupMergedHandler wumProceduralConnectHandler) const
+{
+    // Get suffix based on type of events
+    const std::string eventSuffix = trueSpike ? "" : "Evnt";
+    const auto *wu = sg.getArchetype().getWUModel();
+
+    // Detect spike events or spikes and do the update
+    // **NOTE** if spikes are processed in parallel, each updates a distinct row of synapses so only input to the postsynaptic neurons needs to be atomic
+    os << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << std::endl;
+    if(parallel) {
+        os << "#pragma omp parallel for" << std::endl;
+    }
+    if (sg.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
+        os << "for (unsigned int i = 0; i < group.srcSpkCnt" << eventSuffix << "[preReadDelaySlot]; i++)";
+    }
+    else {
+        os << "for (unsigned int i = 0; i < group.srcSpkCnt" << eventSuffix << "[0]; i++)";
+    }
+    {
+        CodeStream::Scope b(os);
+        if (!wu->getSimSupportCode().empty()) {
+            os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) <<  ";" << std::endl;
+        }
+
+        const std::string queueOffset = sg.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "preReadDelayOffset + " : "";
+        os << "const unsigned int ipre = group.srcSpk" << eventSuffix << "[" << queueOffset << "i];" << std::endl;
+
+        // If this is a spike-like event, insert threshold check for this presynaptic neuron
+        if (!trueSpike) {
+            os << "if(";
+
+            Substitutions threshSubs(&popSubs);
+            threshSubs.addVarSubstitution("id_pre", "ipre");
+
+            // Generate weight update threshold condition
+            wumThreshHandler(os, sg, threshSubs);
+
+            os << ")";
+            os << CodeStream::OB(10);
+        }
+
+        Substitutions synSubs(&popSubs);
+        synSubs.addVarSubstitution("id_pre", "ipre");
+        synSubs.addVarSubstitution("id_post", "ipost");
+        synSubs.addVarSubstitution("id_syn", "synAddress");
+
+        if(sg.getArchetype().isDendriticDelayRequired()) {
+            synSubs.addFuncSubstitution("addToInSynDelay", 2, parallel ? ("gennAtomicAdd(&group.denDelay[" + sg.getDendriticDelayOffset("$(1)") + "ipost], $(0))")
+                                                                       : ("group.denDelay[" + sg.getDendriticDelayOffset("$(1)") + "ipost] += $(0)"));
+        }
+        else {
+            synSubs.addFuncSubstitution("addToInSyn", 1, parallel ? "gennAtomicAdd(&group.inSyn[ipost], $(0))" : "group.inSyn[ipost] += $(0)");
+        }
+
+        if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+            // If connectivity is stored in the sliced layout, consecutive synapses in the row are separated by the number of rows in its slice
+            const bool sliced = isSparseLayoutSliced(sg.getArchetype());
+            if(sliced) {
+                os << "const " << getSynapseIndexType(sg.getArchetype()) << " rowStart = group.slicedRowStart[ipre];" << std::endl;
+                os << "const unsigned int rowStride = group.slicedRowStride[ipre];" << std::endl;
+            }
+            os << "const unsigned int npost = group.rowLength[ipre];" << std::endl;
+            os << "for (unsigned int j = 0; j < npost; j++)";
+            {
+                CodeStream::Scope b(os);
+
+                // **TODO** seperate stride from max connection
+                if(sliced) {
+                    os << "const " << getSynapseIndexType(sg.getArchetype()) << " synAddress = rowStart + (" << getSynapseIndexCast(sg) << "j * rowStride);" << std::endl;
+                }
+                else {
+                    os << "const " << getSynapseIndexType(sg.getArchetype()) << " synAddress = (" << getSynapseIndexCast(sg) << "ipre * group.rowStride) + j;" << std::endl;
+                }
+                os << "const unsigned int ipost = group.ind[synAddress];" << std::endl;
+
+                wumSimHandler(os, sg, synSubs);
+            }
+        }
+        else if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+            os << "for (" << getSynapseIndexType(sg.getArchetype()) << " synAddress = group.rowPtr[ipre]; synAddress < group.rowPtr[ipre + 1]; synAddress++)";
+            {
+                CodeStream::Scope b(os);
+                os << "const unsigned int ipost = group.ind[synAddress];" << std::endl;
+
+                wumSimHandler(os, sg, synSubs);
+            }
+        }
+        else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL) {
+            const std::string &precision = modelMerged.getModel().getPrecision();
+
+            // Create substitution stack for generating procedural connectivity code
+            // **NOTE** the whole row is always processed by a single thread
+            Substitutions connSubs(&synSubs);
+            connSubs.addVarSubstitution("num_threads", "1");
+            connSubs.addVarSubstitution("id_post_begin", "0");
+            connSubs.addVarSubstitution("id_thread", "0");
+            connSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
+
+            // Create another substitution stack for generating presynaptic simulation code
+            Substitutions presynapticUpdateSubs(&synSubs);
+
+            // If connectivity or weights require an RNG, create a Philox RNG whose counter is unique to this row of this group
+            // **NOTE** this means that rows are regenerated identically every time they are processed
+            if(isProceduralRNGRequired(sg.getArchetype())) {
+                // **NOTE** second word of key is zero for procedural connectivity streams
+                // **NOTE** streams are indexed by synapse group in the model so rows don't depend on how groups are merged
+                // **NOTE** connectivity is shared between batch instances so use the index of the group rather than the instance
+                const std::string groupIndex = (modelMerged.getModel().getBatchSize() > 1) ? ("(g / " + std::to_string(modelMerged.getModel().getBatchSize()) + ")") : "g";
+                os << "PhiloxRNG connectRNG(philoxRNGKey, 0, ipre, proceduralRNGStreams[" << groupIndex << "], 0);" << std::endl;
+
+                connSubs.addVarSubstitution("rng", "connectRNG");
+                addCounterBasedRNGFunctionSubstitutions(connSubs, precision);
+
+                if(sg.getArchetype().getMatrixType() & SynapseMatrixWeight::PROCEDURAL) {
+                    presynapticUpdateSubs.addVarSubstitution("rng", "connectRNG");
+                    addCounterBasedRNGFunctionSubstitutions(presynapticUpdateSubs, precision);
+                }
+            }
+
+            // Replace $(id_post) with first 'function' parameter as simulation code is
+            // going to be, in turn, substituted into procedural connectivity generation code
+            presynapticUpdateSubs.addVarSubstitution("id_post", "$(0)");
+            if(sg.getArchetype().isDendriticDelayRequired()) {
+                presynapticUpdateSubs.addFuncSubstitution("addToInSynDelay", 2, parallel ? ("gennAtomicAdd(&group.denDelay[" + sg.getDendriticDelayOffset("$(1)") + "$(id_post)], $(0))")
+                                                                                         : ("group.denDelay[" + sg.getDendriticDelayOffset("$(1)") + "$(id_post)] += $(0)"));
+            }
+            else {
+                presynapticUpdateSubs.addFuncSubstitution("addToInSyn", 1, parallel ? "gennAtomicAdd(&group.inSyn[$(id_post)], $(0))" : "group.inSyn[$(id_post)] += $(0)");
+            }
+
+            // Generate presynaptic simulation code into new stringstream-backed code stream
+            std::ostringstream presynapticUpdateStream;
+            CodeStream presynapticUpdate(presynapticUpdateStream);
+            wumSimHandler(presynapticUpdate, sg, presynapticUpdateSubs);
+
+            // When a synapse should be 'added', substitute in presynaptic update code
+            connSubs.addFuncSubstitution("addSynapse", 1, presynapticUpdateStream.str());
+
+            // Generate procedural connectivity code
+            wumProceduralConnectHandler(os, sg, connSubs);
+        }
+        else if(m_CPUPreferences.enableBitmaskOptimisations && (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK)) {
+            // Determine the number of words in each row
+            os << "const unsigned int rowWords = ((group.numTrgNeurons + 32 - 1) / 32);" << std::endl;
+            os << "for(unsigned int w = 0; w < rowWords; w++)";
+            {
+                CodeStream::Scope b(os);
+
+                // Read row word
+                os << "uint32_t connectivityWord = group.gp[(ipre * rowWords) + w];" << std::endl;
+
+                // Set ipost to first synapse in connectivity word
+                os << "unsigned int ipost = w * 32;" << std::endl;
+
+                // While there any bits left
+                os << "while(connectivityWord != 0)";
+                {
+                    CodeStream::Scope b(os);
+
+                    // Cound leading zeros (as bits are indexed backwards this is index of next synapse)
+                    os << "const int numLZ = gennCLZ(connectivityWord);" << std::endl;
+
+                    // Shift off zeros and the one just discovered
+                    // **NOTE** << 32 appears to result in undefined behaviour
+                    os << "connectivityWord = (numLZ == 31) ? 0 : (connectivityWord << (numLZ + 1));" << std::endl;
+
+                    // Add to ipost
+                    os << "ipost += numLZ;" << std::endl;
+
+                    // If we aren't in padding region
+                    // **TODO** don't bother checking if there is no padding
+                    os << "if(ipost < group.numTrgNeurons)";
+                    {
+                        CodeStream::Scope b(os);
+                        wumSimHandler(os, sg, synSubs);
+                    }
+
+                    // Increment ipost to take into account fact the next CLZ will go from bit AFTER synapse
+                    os << "ipost++;" << std::endl;
+                }
+            }
+        }
+        // Otherwise (DENSE or BITMASK)
+        else {
+            os << "for (unsigned int ipost = 0; ipost < group.numTrgNeurons; ipost++)";
+            {
+                CodeStream::Scope b(os);
+
+                if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+                    os << "const uint64_t gid = (ipre * (uint64_t)group.numTrgNeurons + ipost);" << std::endl;
+                    os << "if (B(group.gp[gid / 32], gid & 31))" << CodeStream::OB(20);
+                }
+
+                os << "const " << getSynapseIndexType(sg.getArchetype()) << " synAddress = (" << getSynapseIndexCast(sg) << "ipre * group.numTrgNeurons) + ipost;" << std::endl;
+
+                wumSimHandler(os, sg, synSubs);
+
+                if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+                    os << CodeStream::CB(20);
+                }
+            }
+        }
+        // If this is a spike-like event, close braces around threshold check
+        if (!trueSpike) {
+            os << CodeStream::CB(10);
+        }
+    }
+}
+//--------------------------------------------------------------------------
+bool BackendCPU::isSynapseDynamicsWeightedSum(const SynapseGroupInternal &sg) const
+{
+    // **NOTE** procedural weights are excluded as they may be generated using random numbers
+    // and dendritic delays as input isn't accumulated in inSyn
+    if(!(sg.getMatrixType() & SynapseMatrixConnectivity::DENSE) || (sg.getMatrixType() & SynapseMatrixWeight::PROCEDURAL)
+       || sg.isDendriticDelayRequired())
+    {
+        return false;
+    }
+
+    // Synapse dynamics must consist of a single addToInSyn statement
+    const std::string &code = sg.getWUModel()->getSynapseDynamicsCode();
+    const auto call = ExpressionParser::parseFunctionSubstitutionStatement(code, "addToInSyn");
+    if(!call || call->children.size() != 2) {
+        return false;
+    }
+
+    // If its argument has no side-effects, synapses can be processed in any order
+    return !ExpressionParser::hasSideEffects(*call->children[1], code);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genWeightedSumSynapseDynamics(CodeStream &os, const SynapseGroupMerged &sg, const Substitutions &popSubs,
+                                               const std::string &postBegin, const std::string &postEnd,
+                                               SynapseGroupMergedHandler synapseDynamicsHandler) const
+{
+    os << "for(unsigned int blockBegin = " << postBegin << "; blockBegin < " << postEnd << "; blockBegin += " << weightedSumBlockSize << ")";
+    {
+        CodeStream::Scope b(os);
+        os << "const unsigned int blockEnd = std::min(blockBegin + " << weightedSumBlockSize << "u, " << postEnd << ");" << std::endl;
+        os << "scalar weightedSum[" << weightedSumBlockSize << "] = {};" << std::endl;
+
+        // Loop through rows, accumulating the weighted sum of this block of postsynaptic neurons
+        // **NOTE** row start is calculated with 64-bit arithmetic so the compiler can
+        // tell that synapse indices within the row don't wrap and vectorise the loop
+        os << "for(unsigned int i = 0; i < group.numSrcNeurons; i++)";
+        {
+            CodeStream::Scope b(os);
+            os << "const uint64_t rowStart = (uint64_t)i * group.numTrgNeurons;" << std::endl;
+            os << "for(unsigned int j = blockBegin; j < blockEnd; j++)";
+            {
+                CodeStream::Scope b(os);
+
+                Substitutions synSubs(&popSubs);
+                synSubs.addVarSubstitution("id_syn", "rowStart + j");
+                synSubs.addVarSubstitution("id_pre", "i");
+                synSubs.addVarSubstitution("id_post", "j");
+                synSubs.addFuncSubstitution("addToInSyn", 1, "weightedSum[j - blockBegin] += $(0)");
+
+                synapseDynamicsHandler(os, sg, synSubs);
+            }
+        }
+
+        // Add weighted sums to postsynaptic input
+        os << "for(unsigned int j = blockBegin; j < blockEnd; j++)";
+        {
+            CodeStream::Scope b(os);
+            os << "group.inSyn[j] += weightedSum[j - blockBegin];" << std::endl;
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMergedGroup(CodeStream &os, ModuleHandler moduleHandler, const std::string &suffix, size_t idx, size_t numGroups,
+                                const std::string &params, const std::string &args, HostHandler handler) const
+{
+    CodeStream::Scope b(os);
+    if(m_CPUPreferences.splitMergedGroupModules) {
+        const std::string name = "merged" + suffix + "Group" + std::to_string(idx);
+        const std::string functionName = "process" + suffix + "Group" + std::to_string(idx);
+
+        // Generate module containing a function to process the merged group
+        // **NOTE** merged group array is implemented alongside its push function so declare it here
+        moduleHandler(name,
+            [&](CodeStream &os)
+            {
+                os << "extern " << getStateStorageSpecifier() << "Merged" << suffix << "Group" << idx << " " << name << "[" << numGroups << "];" << std::endl;
+                os << std::endl;
+                os << "void " << functionName << "(" << params << ")";
+                {
+                    CodeStream::Scope b(os);
+                    handler(os);
+                }
+            });
+
+        // Declare and call function
+        os << "void " << functionName << "(" << params << ");" << std::endl;
+        os << functionName << "(" << args << ");" << std::endl;
+    }
+    else {
+        handler(os);
+    }
+}
+//--------------------------------------------------------------------------
+bool BackendCPU::isPhiloxRNGRequired(const ModelSpecMerged &modelMerged) const
+{
+    const ModelSpecInternal &model = modelMerged.getModel();
+
+    // If any synapse groups require an RNG to generate procedural connectivity or weights, return true
+    if(isProceduralRNGRequired(model)) {
+        return true;
+    }
+
+    // If any synapse groups use counter-based RNGs to initialise sparse connectivity or variables, return true
+    if(std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
+                   [this](const ModelSpec::SynapseGroupValueType &s)
+                   {
+                       return isConnectivityInitPhiloxRNGRequired(s.second) || isSparseInitPhiloxRNGRequired(s.second);
+                   }))
+    {
+        return true;
+    }
+
+    // Return true if counter-based RNGs are enabled and any neuron groups require simulation RNGs
+    return (m_CPUPreferences.enableCounterBasedRNG
+            && std::any_of(model.getNeuronGroups().cbegin(), model.getNeuronGroups().cend(),
+                           [](const ModelSpec::NeuronGroupValueType &n){ return n.second.isSimRNGRequired(); }));
+}
+//--------------------------------------------------------------------------
+bool BackendCPU::isConnectivityInitPhiloxRNGRequired(const SynapseGroupInternal &sg) const
+{
+    // **NOTE** CSR and bitmask rows can't be built independently so always use the global RNG
+    return (m_CPUPreferences.enableCounterBasedRNG && (sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE)
+            && Utils::isRNGRequired(sg.getConnectivityInitialiser().getSnippet()->getRowBuildCode()));
+}
+//--------------------------------------------------------------------------
+bool BackendCPU::isSparseInitPhiloxRNGRequired(const SynapseGroupInternal &sg) const
+{
+    return (m_CPUPreferences.enableCounterBasedRNG
+            && ((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (sg.getMatrixType() & SynapseMatrixConnectivity::CSR))
+            && (sg.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)
+            && Utils::isRNGRequired(sg.getWUVarInitialisers()));
+}
+//--------------------------------------------------------------------------
+bool BackendCPU::isConnectivityCacheable(const ModelSpecInternal &model, const SynapseGroupInternal &sg) const
+{
+    // Connectivity built from extra global parameters can't be cached as their values are only known at runtime
+    const auto *snippet = sg.getConnectivityInitialiser().getSnippet();
+    if(m_CPUPreferences.connectivityCacheDirectory.empty() || !snippet->getExtraGlobalParams().empty()) {
+        return false;
+    }
+
+    // Random connectivity can only be cached if the seed is fixed and each row is built using its own counter-based RNG stream
+    // **NOTE** the state of the global RNG depends on everything initialised before the synapse group so can't be reproduced
+    if(Utils::isRNGRequired(snippet->getRowBuildCode())) {
+        return ((model.getSeed() != 0) && isConnectivityInitPhiloxRNGRequired(sg));
+    }
+    else {
+        return true;
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genConnectivityCacheFiles(CodeStream &os, const ModelSpecInternal &model, const SynapseGroupMerged &sg) const
+{
+    // **NOTE** paths are absolute so cache is found wherever the model is run from
+    const filesystem::path cachePath = filesystem::path(m_CPUPreferences.connectivityCacheDirectory).make_absolute();
+    os << "const char *const connectivityCacheFiles[] = {";
+    for(const auto &s : sg.getGroups()) {
+        const std::string filename = Utils::getHexDigest(getConnectivityCacheHashDigest(model, s.get())) + ".bin";
+        os << "\"" << (cachePath / filename).str(filesystem::path::posix_path) << "\", ";
+    }
+    os << "};" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genReadConnectivityCache(CodeStream &os, const SynapseGroupMerged &sg) const
+{
+    os << "// If connectivity has already been cached, read it rather than building it" << std::endl;
+    CodeStream::Scope b(os);
+    os << "FILE *cacheFile = fopen(connectivityCacheFiles[g], \"rb\");" << std::endl;
+    os << "if(cacheFile != nullptr)";
+    {
+        CodeStream::Scope b(os);
+
+        // Read connectivity, checking that the file is long enough and won't overflow the arrays being read into
+        if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+            os << "bool cached = (fread(group.rowLength, sizeof(unsigned int), group.numSrcNeurons, cacheFile) == group.numSrcNeurons);" << std::endl;
+            os << "for(unsigned int i = 0; cached && i < group.numSrcNeurons; i++)";
+            {
+                CodeStream::Scope b(os);
+                os << "cached = ((group.rowLength[i] <= group.rowStride)" << std::endl;
+                os << "          && (fread(&group.ind[" << getSynapseIndexCast(sg) << "i * group.rowStride], sizeof(group.ind[0]), group.rowLength[i], cacheFile) == group.rowLength[i]));" << std::endl;
+            }
+        }
+        else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+            os << "bool cached = ((fread(group.rowPtr, sizeof(group.rowPtr[0]), group.numSrcNeurons + 1, cacheFile) == (group.numSrcNeurons + 1))" << std::endl;
+            os << "               && (group.rowPtr[group.numSrcNeurons] <= group.maxSynapses));" << std::endl;
+            os << "cached = cached && (fread(group.ind, sizeof(group.ind[0]), group.rowPtr[group.numSrcNeurons], cacheFile) == group.rowPtr[group.numSrcNeurons]);" << std::endl;
+        }
+        else {
+            assert(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK);
+            os << "const size_t numWords = ((((size_t)group.numSrcNeurons * (size_t)group.rowStride) + 32 - 1) / 32);" << std::endl;
+            os << "bool cached = (fread(group.gp, sizeof(uint32_t), numWords, cacheFile) == numWords);" << std::endl;
+        }
+
+        // Check that nothing follows the cached connectivity
+        os << "cached = cached && (fgetc(cacheFile) == EOF);" << std::endl;
+        os << "fclose(cacheFile);" << std::endl;
+        os << "if(cached)";
+        {
+            CodeStream::Scope b(os);
+            os << "continue;" << std::endl;
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genWriteConnectivityCache(CodeStream &os, const SynapseGroupMerged &sg) const
+{
+    os << "// Write connectivity to cache" << std::endl;
+    os << "// **NOTE** connectivity is written to a temporary file which is then renamed so partially-written files are never read" << std::endl;
+    CodeStream::Scope b(os);
+    os << "const std::string tmpCacheFile = std::string(connectivityCacheFiles[g]) + \".tmp\";" << std::endl;
+    os << "FILE *cacheFile = fopen(tmpCacheFile.c_str(), \"wb\");" << std::endl;
+    os << "if(cacheFile != nullptr)";
+    {
+        CodeStream::Scope b(os);
+        if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+            os << "bool written = (fwrite(group.rowLength, sizeof(unsigned int), group.numSrcNeurons, cacheFile) == group.numSrcNeurons);" << std::endl;
+            os << "for(unsigned int i = 0; written && i < group.numSrcNeurons; i++)";
+            {
+                CodeStream::Scope b(os);
+                os << "written = (fwrite(&group.ind[" << getSynapseIndexCast(sg) << "i * group.rowStride], sizeof(group.ind[0]), group.rowLength[i], cacheFile) == group.rowLength[i]);" << std::endl;
+            }
+        }
+        else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+            os << "bool written = ((fwrite(group.rowPtr, sizeof(group.rowPtr[0]), group.numSrcNeurons + 1, cacheFile) == (group.numSrcNeurons + 1))" << std::endl;
+            os << "                && (fwrite(group.ind, sizeof(group.ind[0]), group.rowPtr[group.numSrcNeurons], cacheFile) == group.rowPtr[group.numSrcNeurons]));" << std::endl;
+        }
+        else {
+            assert(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK);
+            os << "const size_t numWords = ((((size_t)group.numSrcNeurons * (size_t)group.rowStride) + 32 - 1) / 32);" << std::endl;
+            os << "bool written = (fwrite(group.gp, sizeof(uint32_t), numWords, cacheFile) == numWords);" << std::endl;
+        }
+
+        // Close file and, if everything was written successfully, rename it to its final name
+        os << "written = (fclose(cacheFile) == 0) && written;" << std::endl;
+        os << "if(!written || (rename(tmpCacheFile.c_str(), connectivityCacheFiles[g]) != 0))";
+        {
+            CodeStream::Scope b(os);
+            os << "remove(tmpCacheFile.c_str());" << std::endl;
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genNeuronRNGStreams(CodeStream &os, const ModelSpecInternal &model, const NeuronGroupMerged &ng) const
+{
+    // **NOTE** second word of key is zero for procedural connectivity streams
+    // **NOTE** each batch instance uses a separate stream
+    if(m_CPUPreferences.enableCounterBasedRNG && ng.getArchetype().isSimRNGRequired()) {
+        os << "const uint32_t neuronRNGStreams[] = {";
+        for(const auto &n : ng.getGroups()) {
+            for(unsigned int b = 0; b < model.getBatchSize(); b++) {
+                os << (getNeuronGroupIndex(model, n.get()) + 1 + (b * model.getNeuronGroups().size())) << ", ";
+            }
+        }
+        os << "};" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::addNeuronSimRNGSubstitution(CodeStream &os, const NeuronGroupMerged &ng, Substitutions &popSubs, const std::string &ftype) const
+{
+    if(ng.getArchetype().isSimRNGRequired()) {
+        // If counter-based RNGs are enabled, create Philox RNG keyed by population and counting from neuron and timestep
+        // **NOTE** this means random numbers don't depend on how neurons are divided between threads or groups are merged
+        if(m_CPUPreferences.enableCounterBasedRNG) {
+            // **NOTE** population-level code has no neuron ID so use a counter value no individual neuron can have
+            const std::string id = popSubs.hasVarSubstitution("id") ? popSubs["id"] : "0xFFFFFFFFu";
+            os << "PhiloxRNG simRNG(philoxRNGKey, neuronRNGStreams[g], " << id << ", (uint32_t)iT, (uint32_t)(iT >> 32));" << std::endl;
+            popSubs.addVarSubstitution("rng", "simRNG");
+            addCounterBasedRNGFunctionSubstitutions(popSubs, ftype);
+        }
+        // Otherwise, substitute in global RNG
+        else {
+            popSubs.addVarSubstitution("rng", "rng");
+        }
+    }
+}
+//--------------------------------------------------------------------------
+std::string BackendCPU::getSynapseIndexCast(const SynapseGroupMerged &sg) const
+{
+    return areSixtyFourBitSynapseIndicesRequired(sg.getArchetype()) ? "(uint64_t)" : "";
+}
+//--------------------------------------------------------------------------
+size_t BackendCPU::getConnectivityCacheHashDigest(const ModelSpecInternal &model, const SynapseGroupInternal &sg) const
+{
+    // Hash snippet, the values of all its parameters and the size and format of the matrix being built
+    size_t hash = sg.getConnectivityInitHashDigest();
+    Utils::updateHash(sg.getConnectivityInitialiser().getParams(), hash);
+    Utils::updateHash(sg.getConnectivityInitialiser().getDerivedParams(), hash);
+    Utils::updateHash(sg.getSrcNeuronGroup()->getNumNeurons(), hash);
+    Utils::updateHash(sg.getTrgNeuronGroup()->getNumNeurons(), hash);
+    Utils::updateHash(getSynapticMatrixRowStride(sg), hash);
+    Utils::updateHash(sg.getMaxSynapses(), hash);
+
+    // If connectivity is random, it also depends on the seed, the precision and the RNG stream used to build it
+    if(Utils::isRNGRequired(sg.getConnectivityInitialiser().getSnippet()->getRowBuildCode())) {
+        Utils::updateHash(model.getSeed(), hash);
+        Utils::updateHash(model.getPrecision(), hash);
+        Utils::updateHash(getSynapseGroupIndex(model, sg), hash);
+    }
+    return hash;
+}
+//--------------------------------------------------------------------------
+const std::vector<FunctionTemplate> &BackendCPU::getCPUFunctions()
+{
+    return cpuFunctions;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::addCounterBasedRNGFunctionSubstitutions(Substitutions &subs, const std::string &ftype)
+{
+    for(const auto &f : cpuCounterBasedRNGFunctions) {
+        subs.addFuncSubstitution(f.genericName, f.numArguments,
+                                 (ftype == "double") ? f.doublePrecisionTemplate : f.singlePrecisionTemplate);
+    }
+}
+//--------------------------------------------------------------------------
+bool BackendCPU::isProceduralRNGRequired(const SynapseGroupInternal &sg)
+{
+    return (sg.isProceduralConnectivityRNGRequired()
+            || ((sg.getMatrixType() & SynapseMatrixWeight::PROCEDURAL) && Utils::isRNGRequired(sg.getWUVarInitialisers())));
+}
+//--------------------------------------------------------------------------
+bool BackendCPU::isProceduralRNGRequired(const ModelSpecInternal &model)
+{
+    return std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
+                       [](const ModelSpec::SynapseGroupValueType &s){ return isProceduralRNGRequired(s.second); });
+}
+//--------------------------------------------------------------------------
+size_t BackendCPU::getNeuronGroupIndex(const ModelSpecInternal &model, const NeuronGroupInternal &ng)
+{
+    return std::distance(model.getNeuronGroups().cbegin(), model.getNeuronGroups().find(ng.getName()));
+}
+//--------------------------------------------------------------------------
+size_t BackendCPU::getSynapseGroupIndex(const ModelSpecInternal &model, const SynapseGroupInternal &sg)
+{
+    return std::distance(model.getSynapseGroups().cbegin(), model.getSynapseGroups().find(sg.getName()));
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genSynapseRNGStreams(CodeStream &os, const std::string &name, const ModelSpecInternal &model,
+                                      const SynapseGroupMerged &sg, unsigned int batchSize)
+{
+    os << "const uint32_t " << name << "[] = {";
+    for(const auto &s : sg.getGroups()) {
+        for(unsigned int b = 0; b < batchSize; b++) {
+            os << (getSynapseGroupIndex(model, s.get()) + (b * model.getSynapseGroups().size())) << ", ";
+        }
+    }
+    os << "};" << std::endl;
+}
+}   // namespace CodeGenerator
@@ -1,22 +1,7 @@
 #include "code_generator/codeGenUtils.h"
 
-// Is C++ regex library operational?
-// We assume it is for:
-// 1) Compilers that don't define __GNUCC__
-// 2) Clang
-// 3) GCC 5.X.Y and future
-// 4) Any future (4.10.Y?) GCC 4.X.Y releases
-// 5) GCC 4.9.1 and subsequent patch releases (GCC fully implemented regex in 4.9.0
-// BUT bug 61227 https://gcc.gnu.org/bugzilla/show_bug.cgi?id=61227 prevented \w from working until 4.9.1)
-#if !defined(__GNUC__) || \
-    __clang__ || \
-    __GNUC__ > 4 || \
-    (__GNUC__ == 4 && (__GNUC_MINOR__ > 9 || \
-                      (__GNUC_MINOR__ == 9 && __GNUC_PATCHLEVEL__ >= 1)))
-    #include <regex>
-#else
-    #error "GeNN now requires a functioning std::regex implementation - please upgrade your version of GCC to at least 4.9.1"
-#endif
+// Standard C++ includes
+#include <unordered_map>
 
 // Standard C includes
 #include <cstring>
@@ -103,27 +88,113 @@ const char *mathsFuncs[][MathsFuncMax] = {
 };
 
 //--------------------------------------------------------------------------
-/*! \brief This function converts code to contain only explicit single precision (float) function calls (C99 standard)
+//! Can character be part of a C identifier i.e. is it in [0-9a-zA-Z_]?
+//--------------------------------------------------------------------------
+inline bool isIdentifierChar(char c)
+{
+    return ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_');
+}
+
+//--------------------------------------------------------------------------
+//! Is character whitespace (matching the ECMAScript regex \s class)?
+//--------------------------------------------------------------------------
+inline bool isWhitespaceChar(char c)
+{
+    return (c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r');
+}
+
+//--------------------------------------------------------------------------
+/*! \brief Single-pass tokeniser which walks code splitting out maximal runs of identifier characters.
+ *
+ * For each identifier, getReplacement is called with the code and the [begin, end) range of the
+ * identifier and should return a pointer to the replacement string or nullptr to leave it unchanged.
+ * Returns true if any replacements were made.
  */
 //--------------------------------------------------------------------------
-void ensureMathFunctionFtype(std::string &code, const std::string &type)
+template<typename R>
+bool identifierSubstitute(std::string &code, R getReplacement)
 {
-    using namespace CodeGenerator;
+    std::string output;
+    size_t copied = 0;
+    for(size_t i = 0; i < code.size();) {
+        // Skip characters which can't start an identifier
+        if(!isIdentifierChar(code[i])) {
+            i++;
+            continue;
+        }
 
-    // If type is double, substitute any single precision maths functions for double precision version
-    if (type == "double") {
-        for(const auto &m : mathsFuncs) {
-            regexFuncSubstitute(code, m[MathsFuncSingle], m[MathsFuncDouble]);
+        // Find end of identifier
+        const size_t begin = i;
+        while(i < code.size() && isIdentifierChar(code[i])) {
+            i++;
+        }
+
+        // If identifier should be replaced, copy preceding code and replacement into output
+        const std::string *replacement = getReplacement(code, begin, i);
+        if(replacement) {
+            output.append(code, copied, begin - copied);
+            output.append(*replacement);
+            copied = i;
         }
     }
-    // Otherwise, substitute any double precision maths functions for single precision version
+
+    // If nothing was replaced, leave code unmodified and return false
+    if(copied == 0) {
+        return false;
+    }
+    // Otherwise, copy remaining code onto output and replace
     else {
-        for(const auto &m : mathsFuncs) {
-            regexFuncSubstitute(code, m[MathsFuncDouble], m[MathsFuncSingle]);
-        }
+        output.append(code, copied, std::string::npos);
+        code = std::move(output);
+        return true;
     }
 }
 
+//--------------------------------------------------------------------------
+//! Is identifier ending at end followed by a bracket (with optional whitespace) i.e. is it a function call
+//--------------------------------------------------------------------------
+bool isFunctionCall(const std::string &code, size_t end)
+{
+    while(end < code.size() && isWhitespaceChar(code[end])) {
+        end++;
+    }
+    return (end < code.size() && code[end] == '(');
+}
+
+//--------------------------------------------------------------------------
+//! Build hash map of maths functions from one precision to another
+//--------------------------------------------------------------------------
+std::unordered_map<std::string, std::string> buildMathsFuncMap(MathsFunc from, MathsFunc to)
+{
+    std::unordered_map<std::string, std::string> map;
+    for(const auto &m : mathsFuncs) {
+        map.emplace(m[from], m[to]);
+    }
+    return map;
+}
+
+//--------------------------------------------------------------------------
+/*! \brief This function converts code to contain only explicit single precision (float) function calls (C99 standard)
+ */
+//--------------------------------------------------------------------------
+void ensureMathFunctionFtype(std::string &code, const std::string &type)
+{
+    // Hash maps from single to double precision maths functions and vice-versa
+    static const auto singleToDouble = buildMathsFuncMap(MathsFuncSingle, MathsFuncDouble);
+    static const auto doubleToSingle = buildMathsFuncMap(MathsFuncDouble, MathsFuncSingle);
+
+    // If type is double, substitute any single precision maths functions for double precision version
+    // Otherwise, substitute any double precision maths functions for single precision version
+    // **NOTE** no function name in one map is the replacement of another so a single pass is sufficient
+    const auto &funcs = (type == "double") ? singleToDouble : doubleToSingle;
+    identifierSubstitute(code,
+                         [&funcs](const std::string &c, size_t begin, size_t end)
+                         {
+                             const auto f = funcs.find(c.substr(begin, end - begin));
+                             return (f != funcs.cend() && isFunctionCall(c, end)) ? &f->second : nullptr;
+                         });
+}
+
 //--------------------------------------------------------------------------
 /*! \brief This function is part of the parser that converts any floating point constant in a code snippet to a floating point constant with an explicit precision (by appending "f" or removing it).
  */
@@ -150,48 +221,6 @@ void doFinal(std::string &code, unsigned int i, const std::string &type, unsigne
     }
 }
 
-bool regexSubstitute(std::string &s, const std::regex &regex, const std::string &format)
-{
-    // **NOTE** the following code performs the same function as std::regex_replace
-    // but has a return value indicating whether any replacements are made
-    // see http://en.cppreference.com/w/cpp/regex/regex_replace
-
-    // Create regex iterator to iterate over matches found in code
-    std::sregex_iterator matchesBegin(s.cbegin(), s.cend(), regex);
-    std::sregex_iterator matchesEnd;
-
-    // If there are no matches, leave s unmodified and return false
-    if(matchesBegin == matchesEnd) {
-        return false;
-    }
-    // Otherwise
-    else {
-        // Loop through matches
-        std::string output;
-        for(std::sregex_iterator m = matchesBegin;;) {
-            // Copy the non-matched subsequence (m->prefix()) onto output
-            std::copy(m->prefix().first, m->prefix().second, std::back_inserter(output));
-
-            // Then replaces the matched subsequence with the formatted replacement string
-            m->format(std::back_inserter(output), format);
-
-            // If there are no subsequent matches
-            if(std::next(m) == matchesEnd) {
-                // Copy the remaining non-matched characters onto output
-                std::copy(m->suffix().first, m->suffix().second, std::back_inserter(output));
-                break;
-            }
-            // Otherwise go onto next match
-            else {
-                m++;
-            }
-        }
-
-        // Set reference to newly processed version and return true
-        s = output;
-        return true;
-    }
-}
 }    // Anonymous namespace
 
 //--------------------------------------------------------------------------
@@ -212,37 +241,30 @@ void substitute(std::string &s, const std::string &trg, const std::string &rep)
 }
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting variable  names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting variable names in the neuron code strings or other templates
 //--------------------------------------------------------------------------
 bool regexVarSubstitute(std::string &s, const std::string &trg, const std::string &rep)
 {
-    // Build a regex to match variable name with at least one
-    // character that can't be in a variable name on either side (or an end/beginning of string)
-    // **NOTE** the suffix is non-capturing so two instances of variables separated by a single character are matched e.g. a*a
-    std::regex regex("(^|[^0-9a-zA-Z_])" + trg + "(?=$|[^a-zA-Z0-9_])");
-
-    // Create format string to replace in text
-    // **NOTE** preceding character is captured as C++ regex doesn't support lookbehind so this needs to be replaced in
-    const std::string format = "$1" + rep;
-
-    return regexSubstitute(s, regex, format);
+    // Replace identifiers which exactly match target i.e. which have a character that
+    // can't be in a variable name (or the beginning/end of the string) on either side
+    return identifierSubstitute(s,
+                                [&trg, &rep](const std::string &c, size_t begin, size_t end)
+                                {
+                                    return (c.compare(begin, end - begin, trg) == 0) ? &rep : nullptr;
+                                });
 }
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting function  names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting function names in the neuron code strings or other templates
 //--------------------------------------------------------------------------
 bool regexFuncSubstitute(std::string &s, const std::string &trg, const std::string &rep)
 {
-    // Build a regex to match function name with at least one
-    // character that can't be part of the function name on the left and a bracket on the right (with optional whitespace)
-    // **NOTE** the suffix is non-capturing so two instances of functions separated by a single character are matched e.g. sin(cos(x));
-    std::regex regex("(^|[^0-9a-zA-Z_])" + trg + "(?=\\s*\\()");
-
-    // Create format string to replace in text
-    // **NOTE** preceding character is captured as C++ regex doesn't support lookbehind so this needs to be replaced in
-    const std::string format = "$1" + rep;
-
-    return regexSubstitute(s, regex, format);
+    // Replace identifiers which exactly match target and are followed by a bracket (with optional whitespace)
+    return identifierSubstitute(s,
+                                [&trg, &rep](const std::string &c, size_t begin, size_t end)
+                                {
+                                    return (c.compare(begin, end - begin, trg) == 0 && isFunctionCall(c, end)) ? &rep : nullptr;
+                                });
 }
 
 //--------------------------------------------------------------------------
@@ -341,7 +363,8 @@ void functionSubstitute(std::string &code, const std::string &funcName,
             }
 
             // Find start of next function to replace
-            found = code.find(funcStart);
+            // **NOTE** search resumes at the start of the replacement as it may itself contain calls
+            found = code.find(funcStart, found);
         }
     }
 }
@@ -367,6 +390,82 @@ void genMergedGroupSpikeCountReset(CodeStream &os, const NeuronGroupMerged &n)
     }
 }
 
+void genHostPhiloxRNG(CodeStream &os)
+{
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// Counter-based Philox4x32-10 RNG" << std::endl;
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "class PhiloxRNG";
+    {
+        CodeStream::Scope b(os);
+        os << "public:" << std::endl;
+        os << "typedef uint32_t result_type;" << std::endl;
+        os << std::endl;
+        os << "PhiloxRNG(uint32_t key0, uint32_t key1, uint32_t counter1, uint32_t counter2, uint32_t counter3)" << std::endl;
+        os << ":   m_Key{key0, key1}, m_Counter{0, counter1, counter2, counter3}, m_Index(4)" << std::endl;
+        {
+            CodeStream::Scope b(os);
+        }
+        os << std::endl;
+        os << "static constexpr result_type min(){ return 0; }" << std::endl;
+        os << "static constexpr result_type max(){ return 0xFFFFFFFFu; }" << std::endl;
+        os << std::endl;
+        os << "result_type operator()()";
+        {
+            CodeStream::Scope b(os);
+
+            // Once all four words of the last block have been consumed, generate next block
+            os << "if(m_Index == 4)";
+            {
+                CodeStream::Scope b(os);
+                os << "generateBlock();" << std::endl;
+                os << "m_Counter[0]++;" << std::endl;
+                os << "m_Index = 0;" << std::endl;
+            }
+            os << "return m_Output[m_Index++];" << std::endl;
+        }
+        os << std::endl;
+        os << "private:" << std::endl;
+        os << "void generateBlock()";
+        {
+            CodeStream::Scope b(os);
+            os << "uint32_t c0 = m_Counter[0], c1 = m_Counter[1], c2 = m_Counter[2], c3 = m_Counter[3];" << std::endl;
+            os << "uint32_t k0 = m_Key[0], k1 = m_Key[1];" << std::endl;
+            os << "for(unsigned int r = 0; r < 10; r++)";
+            {
+                CodeStream::Scope b(os);
+
+                // Bump key using Weyl sequence after first round
+                os << "if(r > 0)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "k0 += 0x9E3779B9u;" << std::endl;
+                    os << "k1 += 0xBB67AE85u;" << std::endl;
+                }
+
+                // Philox S-box
+                os << "const uint64_t p0 = (uint64_t)0xD2511F53u * c0;" << std::endl;
+                os << "const uint64_t p1 = (uint64_t)0xCD9E8D57u * c2;" << std::endl;
+                os << "c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;" << std::endl;
+                os << "c1 = (uint32_t)p1;" << std::endl;
+                os << "c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;" << std::endl;
+                os << "c3 = (uint32_t)p0;" << std::endl;
+            }
+            os << "m_Output[0] = c0;" << std::endl;
+            os << "m_Output[1] = c1;" << std::endl;
+            os << "m_Output[2] = c2;" << std::endl;
+            os << "m_Output[3] = c3;" << std::endl;
+        }
+        os << std::endl;
+        os << "uint32_t m_Key[2];" << std::endl;
+        os << "uint32_t m_Counter[4];" << std::endl;
+        os << "uint32_t m_Output[4];" << std::endl;
+        os << "unsigned int m_Index;" << std::endl;
+    }
+    os << ";" << std::endl;
+    os << std::endl;
+}
+
 void genScalarEGPPush(CodeStream &os, const MergedEGPMap &mergedEGPs, const std::string &suffix, const BackendBase &backend)
 {
     // Loop through all merged EGPs
@@ -485,6 +584,20 @@ std::string ensureFtype(const std::string &oldcode, const std::string &type)
     return code;
 }
 
+//--------------------------------------------------------------------------
+/*! \brief Is name a single or double precision standard C maths function?
+ */
+//--------------------------------------------------------------------------
+bool isMathsFunction(const std::string &name)
+{
+    for(const auto &m : mathsFuncs) {
+        if(name == m[MathsFuncDouble] || name == m[MathsFuncSingle]) {
+            return true;
+        }
+    }
+    return false;
+}
+
 //--------------------------------------------------------------------------
 /*! \brief This function checks for unknown variable definitions and returns a gennError if any are found
  */
@@ -492,10 +605,23 @@ std::string ensureFtype(const std::string &oldcode, const std::string &type)
 
 void checkUnreplacedVariables(const std::string &code, const std::string &codeName)
 {
-    std::regex rgx("\\$\\([\\w]+\\)");
+    // Scan code for any remaining $(name) tokens
     std::string vars= "";
-    for (std::sregex_iterator it(code.begin(), code.end(), rgx), end; it != end; it++) {
-        vars+= it->str().substr(2,it->str().size()-3) + ", ";
+    for(size_t found = code.find("$("); found != std::string::npos; found = code.find("$(", found)) {
+        size_t end = found + 2;
+        while(end < code.size() && isIdentifierChar(code[end])) {
+            end++;
+        }
+
+        // If token is a non-empty name followed by a closing bracket, add name to list and skip over it
+        if(end > (found + 2) && end < code.size() && code[end] == ')') {
+            vars+= code.substr(found + 2, end - found - 2) + ", ";
+            found = end + 1;
+        }
+        // Otherwise, continue from next character
+        else {
+            found++;
+        }
     }
     if (vars.size() > 0) {
         vars= vars.substr(0, vars.size()-2);
@@ -535,7 +661,7 @@ void neuronSubstitutionsInSynapticCode(
         substitutions.addVarSubstitution(v.name + sourceSuffix,
                                          varPrefix + "group." + v.name + destSuffix + "[" + varIdx + "]" + varSuffix);
     }
-    substitutions.addParamValueSubstitution(neuronModel->getParamNames(), ng->getParams(), sourceSuffix);
+    substitutions.addParamValueSubstitution(neuronModel->getParamNames(), ng->getParams(), ng->getDynamicParams(), sourceSuffix, "group.", destSuffix);
     substitutions.addVarValueSubstitution(neuronModel->getDerivedParams(), ng->getDerivedParams(), sourceSuffix);
     substitutions.addVarNameSubstitution(neuronModel->getExtraGlobalParams(), sourceSuffix, "group.", destSuffix);
 }
@@ -0,0 +1,1102 @@
+#include "code_generator/expressionParser.h"
+
+// Standard C++ includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+// Standard C includes
+#include <cstdlib>
+#include <cstring>
+
+// GeNN includes
+#include "gennUtils.h"
+
+// GeNN code generator includes
+#include "code_generator/codeGenUtils.h"
+
+using namespace CodeGenerator::ExpressionParser;
+
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+// Multi-character punctuators, longest first so they are matched greedily
+const char *multiCharPunctuators[] = {
+    "<<=", ">>=",
+    "->", "++", "--", "<<", ">>", "<=", ">=", "==", "!=", "&&", "||",
+    "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=", "::"};
+
+// Tokens which can legitimately follow a complete expression
+const char *terminators[] = {
+    ";", ")", "]", "}", ",", ":",
+    "=", "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=", "<<=", ">>="};
+
+// Tokens after which a complete expression can begin
+const char *expressionStarts[] = {
+    ";", "{", "}", "(", "[", ",", "?", ":", "return", "else",
+    "=", "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=", "<<=", ">>="};
+
+// Binary operators and their precedence
+const std::pair<const char*, int> binaryOperators[] = {
+    {"*", 10}, {"/", 10}, {"%", 10},
+    {"+", 9}, {"-", 9},
+    {"<<", 8}, {">>", 8},
+    {"<", 7}, {"<=", 7}, {">", 7}, {">=", 7},
+    {"==", 6}, {"!=", 6},
+    {"&", 5},
+    {"^", 4},
+    {"|", 3},
+    {"&&", 2},
+    {"||", 1}};
+
+// Prefix operators
+const char *unaryOperators[] = {"-", "+", "!", "~", "*", "&", "++", "--"};
+
+template<size_t N>
+bool isOneOf(const std::string &text, const char *(&options)[N])
+{
+    return std::any_of(std::begin(options), std::end(options),
+                       [&text](const char *o){ return (text == o); });
+}
+
+inline bool isIdentifierStart(char c)
+{
+    return ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_');
+}
+
+inline bool isDigit(char c)
+{
+    return (c >= '0' && c <= '9');
+}
+
+inline bool isIdentifierChar(char c)
+{
+    return (isIdentifierStart(c) || isDigit(c));
+}
+
+bool isPunctuator(const Token &token, const char *text)
+{
+    return (token.type == Token::Type::Punctuator && token.text == text);
+}
+
+bool isKeyword(const Token &token, const char *text)
+{
+    return (token.type == Token::Type::Identifier && token.text == text);
+}
+
+bool isTerminator(const std::vector<Token> &tokens, size_t pos)
+{
+    return (pos == tokens.size()
+            || (tokens[pos].type == Token::Type::Punctuator && isOneOf(tokens[pos].text, terminators)));
+}
+
+bool isExpressionStart(const std::vector<Token> &tokens, size_t pos)
+{
+    return (pos == 0 || isOneOf(tokens[pos - 1].text, expressionStarts));
+}
+
+int getBinaryPrecedence(const Token &token)
+{
+    if(token.type == Token::Type::Punctuator) {
+        const auto op = std::find_if(std::begin(binaryOperators), std::end(binaryOperators),
+                                     [&token](const std::pair<const char*, int> &o){ return (token.text == o.first); });
+        if(op != std::end(binaryOperators)) {
+            return op->second;
+        }
+    }
+    return -1;
+}
+
+//--------------------------------------------------------------------------
+// Literal parsing
+//--------------------------------------------------------------------------
+// Parse numeric literal, returning false if it is of a type we don't evaluate (e.g. hex, octal or suffixed integers)
+bool parseLiteral(const std::string &text, Constant &value)
+{
+    const bool floatSuffix = (text.back() == 'f' || text.back() == 'F');
+    const bool floatingPoint = (text.find_first_of(".eE") != std::string::npos);
+
+    // Hexadecimal literals and any suffixes other than a single float suffix are left alone
+    if(text.find_first_of("xX") != std::string::npos) {
+        return false;
+    }
+    const size_t digitsEnd = floatSuffix ? (text.size() - 1) : text.size();
+    if(std::any_of(text.cbegin(), text.cbegin() + digitsEnd,
+                   [](char c){ return !isDigit(c) && c != '.' && c != 'e' && c != 'E' && c != '+' && c != '-'; }))
+    {
+        return false;
+    }
+
+    char *end;
+    if(floatingPoint) {
+        if(floatSuffix) {
+            value.type = Constant::Type::Float;
+            value.floatValue = std::strtof(text.c_str(), &end);
+        }
+        else {
+            value.type = Constant::Type::Double;
+            value.floatValue = std::strtod(text.c_str(), &end);
+        }
+        return (end == (text.c_str() + digitsEnd) && std::isfinite(value.floatValue));
+    }
+    // Float suffix on an integer isn't valid C and leading zeros indicate octal
+    else if(floatSuffix || (text.size() > 1 && text[0] == '0')) {
+        return false;
+    }
+    else {
+        value.type = Constant::Type::Int;
+        value.intValue = std::strtoll(text.c_str(), &end, 10);
+        return (end == (text.c_str() + text.size()) && value.intValue <= std::numeric_limits<int32_t>::max());
+    }
+}
+
+//--------------------------------------------------------------------------
+// Parser
+//--------------------------------------------------------------------------
+class Parser
+{
+public:
+    Parser(const std::vector<Token> &tokens, size_t pos) : m_Tokens(tokens), m_Pos(pos)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // Public API
+    //--------------------------------------------------------------------------
+    std::unique_ptr<Node> parseTernary()
+    {
+        auto condition = parseBinary(1);
+        if(!condition || !match("?")) {
+            return condition;
+        }
+
+        auto trueExpr = parseTernary();
+        if(!trueExpr || !match(":")) {
+            return nullptr;
+        }
+
+        auto falseExpr = parseTernary();
+        if(!falseExpr) {
+            return nullptr;
+        }
+
+        auto node = createNode(Node::Type::Ternary, "", condition->begin, falseExpr->end);
+        node->children.push_back(std::move(condition));
+        node->children.push_back(std::move(trueExpr));
+        node->children.push_back(std::move(falseExpr));
+        return node;
+    }
+
+    size_t getPos() const{ return m_Pos; }
+
+private:
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+    bool atEnd() const{ return (m_Pos == m_Tokens.size()); }
+
+    const Token &peek() const{ return m_Tokens[m_Pos]; }
+
+    bool match(const char *text)
+    {
+        if(!atEnd() && isPunctuator(peek(), text)) {
+            m_Pos++;
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+    static std::unique_ptr<Node> createNode(Node::Type type, const std::string &op, size_t begin, size_t end)
+    {
+        std::unique_ptr<Node> node(new Node);
+        node->type = type;
+        node->op = op;
+        node->begin = begin;
+        node->end = end;
+        return node;
+    }
+
+    // Is node a bracketed identifier e.g. (scalar) which would make a following +, -, * or & ambiguous?
+    static bool isPossibleCast(const Node &node)
+    {
+        return (node.type == Node::Type::Paren && node.children[0]->type == Node::Type::Opaque);
+    }
+
+    std::unique_ptr<Node> parseBinary(int minPrecedence)
+    {
+        auto lhs = parseUnary();
+        if(!lhs) {
+            return nullptr;
+        }
+
+        while(!atEnd()) {
+            const int precedence = getBinaryPrecedence(peek());
+            if(precedence < minPrecedence) {
+                break;
+            }
+
+            // If lhs might be a C-style cast e.g. (scalar)-x, we can't tell whether
+            // the operator is binary or unary so give up on this expression
+            const std::string &op = peek().text;
+            if(isPossibleCast(*lhs) && (op == "+" || op == "-" || op == "*" || op == "&")) {
+                return nullptr;
+            }
+            m_Pos++;
+
+            // All binary operators are left-associative so parse rhs at higher precedence
+            auto rhs = parseBinary(precedence + 1);
+            if(!rhs) {
+                return nullptr;
+            }
+
+            auto node = createNode(Node::Type::Binary, op, lhs->begin, rhs->end);
+            node->children.push_back(std::move(lhs));
+            node->children.push_back(std::move(rhs));
+            lhs = std::move(node);
+        }
+        return lhs;
+    }
+
+    std::unique_ptr<Node> parseUnary()
+    {
+        if(!atEnd() && peek().type == Token::Type::Punctuator && isOneOf(peek().text, unaryOperators)) {
+            const Token &opToken = peek();
+            m_Pos++;
+
+            auto operand = parseUnary();
+            if(!operand) {
+                return nullptr;
+            }
+
+            auto node = createNode(Node::Type::Unary, opToken.text, opToken.begin, operand->end);
+            node->children.push_back(std::move(operand));
+            return node;
+        }
+        else {
+            return parsePostfix();
+        }
+    }
+
+    std::unique_ptr<Node> parsePostfix()
+    {
+        auto node = parsePrimary();
+        while(node && !atEnd()) {
+            const Token &token = peek();
+
+            // Function call
+            // **NOTE** if node is a possible cast, (type)(x) is also fine as the arguments are self-contained
+            if(isPunctuator(token, "(")) {
+                node = parseCall(std::move(node), "(", ")");
+            }
+            // Subscript
+            else if(isPunctuator(token, "[")) {
+                node = parseCall(std::move(node), "[", "]");
+            }
+            // Member access
+            else if(isPunctuator(token, ".") || isPunctuator(token, "->")) {
+                m_Pos++;
+                if(atEnd() || peek().type != Token::Type::Identifier) {
+                    return nullptr;
+                }
+                auto member = createNode(Node::Type::Opaque, "", peek().begin, peek().end);
+                m_Pos++;
+
+                auto call = createNode(Node::Type::Call, token.text, node->begin, member->end);
+                call->children.push_back(std::move(node));
+                call->children.push_back(std::move(member));
+                node = std::move(call);
+            }
+            // Scope resolution e.g. std::isinf - just extend opaque identifier
+            else if(isPunctuator(token, "::") && node->type == Node::Type::Opaque) {
+                m_Pos++;
+                if(atEnd() || peek().type != Token::Type::Identifier) {
+                    return nullptr;
+                }
+                node->end = peek().end;
+                m_Pos++;
+            }
+            // Postfix increment and decrement
+            else if(isPunctuator(token, "++") || isPunctuator(token, "--")) {
+                m_Pos++;
+                auto postfix = createNode(Node::Type::Postfix, token.text, node->begin, token.end);
+                postfix->children.push_back(std::move(node));
+                node = std::move(postfix);
+            }
+            else {
+                break;
+            }
+        }
+        return node;
+    }
+
+    std::unique_ptr<Node> parseCall(std::unique_ptr<Node> callee, const char *open, const char *close)
+    {
+        // Skip opening bracket
+        m_Pos++;
+
+        auto node = createNode(Node::Type::Call, open, callee->begin, 0);
+        node->children.push_back(std::move(callee));
+
+        // Parse comma-separated arguments until closing bracket
+        if(!match(close)) {
+            do {
+                auto arg = parseTernary();
+                if(!arg) {
+                    return nullptr;
+                }
+                node->children.push_back(std::move(arg));
+            } while(match(","));
+
+            if(atEnd() || !isPunctuator(peek(), close)) {
+                return nullptr;
+            }
+            m_Pos++;
+        }
+        node->end = m_Tokens[m_Pos - 1].end;
+        return node;
+    }
+
+    std::unique_ptr<Node> parsePrimary()
+    {
+        if(atEnd()) {
+            return nullptr;
+        }
+
+        const Token &token = peek();
+        if(token.type == Token::Type::Number) {
+            m_Pos++;
+            auto node = createNode(Node::Type::Opaque, "", token.begin, token.end);
+            if(parseLiteral(token.text, node->value)) {
+                node->type = Node::Type::Literal;
+            }
+            return node;
+        }
+        else if(token.type == Token::Type::Identifier || token.type == Token::Type::String) {
+            m_Pos++;
+            return createNode(Node::Type::Opaque, "", token.begin, token.end);
+        }
+        // GeNN variable reference e.g. $(V) or function substitution e.g. $(addToInSyn, x)
+        else if(isPunctuator(token, "$")) {
+            if((m_Pos + 2) >= m_Tokens.size() || !isPunctuator(m_Tokens[m_Pos + 1], "(")
+               || m_Tokens[m_Pos + 2].type != Token::Type::Identifier)
+            {
+                return nullptr;
+            }
+            const Token &nameToken = m_Tokens[m_Pos + 2];
+            m_Pos += 3;
+
+            // If name is followed by closing bracket, treat reference as an identifier
+            if(match(")")) {
+                return createNode(Node::Type::Opaque, "", token.begin, m_Tokens[m_Pos - 1].end);
+            }
+            // Otherwise, if it's followed by a comma, parse comma-separated arguments until closing bracket
+            else if(match(",")) {
+                auto node = createNode(Node::Type::Call, "$(", token.begin, 0);
+                node->children.push_back(createNode(Node::Type::Opaque, "", nameToken.begin, nameToken.end));
+                do {
+                    auto arg = parseTernary();
+                    if(!arg) {
+                        return nullptr;
+                    }
+                    node->children.push_back(std::move(arg));
+                } while(match(","));
+
+                if(atEnd() || !isPunctuator(peek(), ")")) {
+                    return nullptr;
+                }
+                node->end = peek().end;
+                m_Pos++;
+                return node;
+            }
+            else {
+                return nullptr;
+            }
+        }
+        else if(isPunctuator(token, "(")) {
+            m_Pos++;
+            auto inner = parseTernary();
+            if(!inner || atEnd() || !isPunctuator(peek(), ")")) {
+                return nullptr;
+            }
+
+            auto node = createNode(Node::Type::Paren, "", token.begin, peek().end);
+            node->children.push_back(std::move(inner));
+            m_Pos++;
+            return node;
+        }
+        else {
+            return nullptr;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Members
+    //--------------------------------------------------------------------------
+    const std::vector<Token> &m_Tokens;
+    size_t m_Pos;
+};
+
+//--------------------------------------------------------------------------
+// Replacement
+//--------------------------------------------------------------------------
+//! Range of characters [begin, end) in code to replace with text
+struct Replacement
+{
+    size_t begin;
+    size_t end;
+    std::string text;
+};
+
+//--------------------------------------------------------------------------
+// Evaluation
+//--------------------------------------------------------------------------
+Constant makeInt(int64_t value)
+{
+    return Constant{Constant::Type::Int, value, 0.0};
+}
+
+// Convert constant to type following C's usual arithmetic conversions
+Constant convert(const Constant &value, Constant::Type type)
+{
+    if(value.type == type) {
+        return value;
+    }
+    else if(value.type == Constant::Type::Int) {
+        const double floatValue = (type == Constant::Type::Float) ? (double)(float)value.intValue : (double)value.intValue;
+        return Constant{type, 0, floatValue};
+    }
+    else {
+        // Float to double is exact and double is never converted to float
+        return Constant{type, 0, value.floatValue};
+    }
+}
+
+bool isTrue(const Constant &value)
+{
+    return (value.type == Constant::Type::Int) ? (value.intValue != 0) : (value.floatValue != 0.0);
+}
+
+bool isIntRepresentable(int64_t value)
+{
+    return (value >= std::numeric_limits<int32_t>::min() && value <= std::numeric_limits<int32_t>::max());
+}
+
+bool evaluateIntBinary(const std::string &op, int64_t a, int64_t b, Constant &value)
+{
+    int64_t result;
+    if(op == "+") {
+        result = a + b;
+    }
+    else if(op == "-") {
+        result = a - b;
+    }
+    else if(op == "*") {
+        result = a * b;
+    }
+    // **NOTE** like C++11, C99 defines integer division to truncate towards zero
+    else if(op == "/" && b != 0) {
+        result = a / b;
+    }
+    else if(op == "%" && b != 0) {
+        result = a % b;
+    }
+    else if(op == "&") {
+        result = a & b;
+    }
+    else if(op == "|") {
+        result = a | b;
+    }
+    else if(op == "^") {
+        result = a ^ b;
+    }
+    else if(op == "<<" && a >= 0 && b >= 0 && b < 31) {
+        result = a << b;
+    }
+    else if(op == ">>" && a >= 0 && b >= 0 && b < 31) {
+        result = a >> b;
+    }
+    else {
+        return false;
+    }
+
+    // Don't fold anything which would overflow as this is undefined behaviour in C
+    if(!isIntRepresentable(result)) {
+        return false;
+    }
+    value = makeInt(result);
+    return true;
+}
+
+template<typename T>
+bool evaluateFloatBinary(const std::string &op, T a, T b, Constant::Type type, Constant &value)
+{
+    T result;
+    if(op == "+") {
+        result = a + b;
+    }
+    else if(op == "-") {
+        result = a - b;
+    }
+    else if(op == "*") {
+        result = a * b;
+    }
+    else if(op == "/") {
+        result = a / b;
+    }
+    else {
+        return false;
+    }
+
+    // Don't fold infinities or NaNs as they have no literal representation
+    if(!std::isfinite(result)) {
+        return false;
+    }
+    value = Constant{type, 0, (double)result};
+    return true;
+}
+
+bool evaluateComparison(const std::string &op, const Constant &a, const Constant &b, Constant &value)
+{
+    // Compare in common type
+    const Constant::Type type = std::max(a.type, b.type);
+    const Constant aConv = convert(a, type);
+    const Constant bConv = convert(b, type);
+    const bool isInt = (type == Constant::Type::Int);
+    const double aVal = isInt ? 0.0 : aConv.floatValue;
+    const double bVal = isInt ? 0.0 : bConv.floatValue;
+
+    bool result;
+    if(op == "<") {
+        result = isInt ? (aConv.intValue < bConv.intValue) : (aVal < bVal);
+    }
+    else if(op == "<=") {
+        result = isInt ? (aConv.intValue <= bConv.intValue) : (aVal <= bVal);
+    }
+    else if(op == ">") {
+        result = isInt ? (aConv.intValue > bConv.intValue) : (aVal > bVal);
+    }
+    else if(op == ">=") {
+        result = isInt ? (aConv.intValue >= bConv.intValue) : (aVal >= bVal);
+    }
+    else if(op == "==") {
+        result = isInt ? (aConv.intValue == bConv.intValue) : (aVal == bVal);
+    }
+    else if(op == "!=") {
+        result = isInt ? (aConv.intValue != bConv.intValue) : (aVal != bVal);
+    }
+    else {
+        return false;
+    }
+
+    value = makeInt(result ? 1 : 0);
+    return true;
+}
+
+bool evaluateBinary(const Node &node, Constant &value)
+{
+    const std::string &op = node.op;
+
+    // Logical operators short-circuit so, if lhs determines result, rhs needn't be constant
+    if(op == "&&" || op == "||") {
+        Constant lhs;
+        if(!evaluate(*node.children[0], lhs)) {
+            return false;
+        }
+        if(isTrue(lhs) == (op == "||")) {
+            value = makeInt((op == "||") ? 1 : 0);
+            return true;
+        }
+
+        Constant rhs;
+        if(!evaluate(*node.children[1], rhs)) {
+            return false;
+        }
+        value = makeInt(isTrue(rhs) ? 1 : 0);
+        return true;
+    }
+
+    Constant lhs;
+    Constant rhs;
+    if(!evaluate(*node.children[0], lhs) || !evaluate(*node.children[1], rhs)) {
+        return false;
+    }
+
+    if(op == "<" || op == "<=" || op == ">" || op == ">=" || op == "==" || op == "!=") {
+        return evaluateComparison(op, lhs, rhs, value);
+    }
+
+    // Evaluate arithmetic in common type
+    const Constant::Type type = std::max(lhs.type, rhs.type);
+    if(type == Constant::Type::Int) {
+        return evaluateIntBinary(op, lhs.intValue, rhs.intValue, value);
+    }
+    else if(type == Constant::Type::Float) {
+        return evaluateFloatBinary<float>(op, (float)convert(lhs, type).floatValue,
+                                          (float)convert(rhs, type).floatValue, type, value);
+    }
+    else {
+        return evaluateFloatBinary<double>(op, convert(lhs, type).floatValue,
+                                           convert(rhs, type).floatValue, type, value);
+    }
+}
+
+bool evaluateUnary(const Node &node, Constant &value)
+{
+    Constant operand;
+    if(!evaluate(*node.children[0], operand)) {
+        return false;
+    }
+
+    if(node.op == "+") {
+        value = operand;
+        return true;
+    }
+    else if(node.op == "-") {
+        value = operand;
+        if(operand.type == Constant::Type::Int) {
+            value.intValue = -operand.intValue;
+            return isIntRepresentable(value.intValue);
+        }
+        else {
+            value.floatValue = -operand.floatValue;
+            return true;
+        }
+    }
+    else if(node.op == "!") {
+        value = makeInt(isTrue(operand) ? 0 : 1);
+        return true;
+    }
+    else if(node.op == "~" && operand.type == Constant::Type::Int) {
+        value = makeInt(~operand.intValue);
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
+// Is folding node worthwhile i.e. does it actually contain an operation rather than just brackets and signs?
+bool isFoldable(const Node &node)
+{
+    if(node.type == Node::Type::Binary || node.type == Node::Type::Ternary
+       || (node.type == Node::Type::Unary && (node.op == "!" || node.op == "~")))
+    {
+        return true;
+    }
+    return std::any_of(node.children.cbegin(), node.children.cend(),
+                       [](const std::unique_ptr<Node> &c){ return isFoldable(*c); });
+}
+
+std::string writeConstant(const Constant &value)
+{
+    if(value.type == Constant::Type::Int) {
+        return std::to_string(value.intValue);
+    }
+    else if(value.type == Constant::Type::Float) {
+        return Utils::writePreciseString((float)value.floatValue) + "f";
+    }
+    else {
+        return Utils::writePreciseString(value.floatValue);
+    }
+}
+
+void foldNode(const Node &node, bool bracketed, std::vector<Replacement> &replacements)
+{
+    // If node can be evaluated and it's worth doing so, replace with value, bracketed unless the context already is
+    Constant value;
+    if(node.type != Node::Type::Literal && evaluate(node, value) && isFoldable(node)) {
+        const bool bracket = !bracketed || (node.type == Node::Type::Paren);
+        replacements.push_back(Replacement{node.begin, node.end, bracket ? ("(" + writeConstant(value) + ")") : writeConstant(value)});
+    }
+    // Otherwise, try and fold children
+    // **NOTE** contents of brackets and function call and subscript arguments are already bracketed
+    // but arguments of function substitutions may be inserted anywhere in their replacement
+    else {
+        for(size_t i = 0; i < node.children.size(); i++) {
+            const bool childBracketed = (node.type == Node::Type::Paren
+                                         || (node.type == Node::Type::Call && i > 0 && node.op != "." && node.op != "->" && node.op != "$("));
+            foldNode(*node.children[i], childBracketed, replacements);
+        }
+    }
+}
+
+std::string applyReplacements(const std::string &code, const std::vector<Replacement> &replacements)
+{
+    // **NOTE** replacements are found in order and never overlap
+    std::string output;
+    size_t copied = 0;
+    for(const auto &r : replacements) {
+        output.append(code, copied, r.begin - copied);
+        output.append(r.text);
+        copied = r.end;
+    }
+    output.append(code, copied, std::string::npos);
+    return output;
+}
+
+//--------------------------------------------------------------------------
+// Statements
+//--------------------------------------------------------------------------
+const size_t invalidPos = std::numeric_limits<size_t>::max();
+
+// Find the bracket closing the one at token index pos
+size_t findClosingBracket(const std::vector<Token> &tokens, size_t pos)
+{
+    const std::string &open = tokens[pos].text;
+    const char *close = (open == "(") ? ")" : ((open == "[") ? "]" : "}");
+    int depth = 0;
+    for(size_t i = pos; i < tokens.size(); i++) {
+        if(isPunctuator(tokens[i], open.c_str())) {
+            depth++;
+        }
+        else if(isPunctuator(tokens[i], close) && --depth == 0) {
+            return i;
+        }
+    }
+    return invalidPos;
+}
+
+// Find the token index one past the end of the statement starting at token index pos
+size_t findStatementEnd(const std::vector<Token> &tokens, size_t pos)
+{
+    if(pos >= tokens.size()) {
+        return invalidPos;
+    }
+
+    const Token &token = tokens[pos];
+    if(isPunctuator(token, "{")) {
+        const size_t close = findClosingBracket(tokens, pos);
+        return (close == invalidPos) ? invalidPos : (close + 1);
+    }
+    else if(isKeyword(token, "if") || isKeyword(token, "for") || isKeyword(token, "while") || isKeyword(token, "switch")) {
+        if((pos + 1) >= tokens.size() || !isPunctuator(tokens[pos + 1], "(")) {
+            return invalidPos;
+        }
+        const size_t close = findClosingBracket(tokens, pos + 1);
+        if(close == invalidPos) {
+            return invalidPos;
+        }
+
+        // If this is an if statement with an else branch, statement ends after else branch
+        const size_t end = findStatementEnd(tokens, close + 1);
+        if(isKeyword(token, "if") && end < tokens.size() && isKeyword(tokens[end], "else")) {
+            return findStatementEnd(tokens, end + 1);
+        }
+        return end;
+    }
+    else if(isKeyword(token, "do")) {
+        const size_t end = findStatementEnd(tokens, pos + 1);
+        if(end >= tokens.size() || !isKeyword(tokens[end], "while")) {
+            return invalidPos;
+        }
+        return findStatementEnd(tokens, end);
+    }
+    // Otherwise, statement ends at the first semicolon which isn't bracketed
+    else {
+        int depth = 0;
+        for(size_t i = pos; i < tokens.size(); i++) {
+            if(isPunctuator(tokens[i], "(") || isPunctuator(tokens[i], "[") || isPunctuator(tokens[i], "{")) {
+                depth++;
+            }
+            else if(isPunctuator(tokens[i], ")") || isPunctuator(tokens[i], "]") || isPunctuator(tokens[i], "}")) {
+                if(depth-- == 0) {
+                    return invalidPos;
+                }
+            }
+            else if(isPunctuator(tokens[i], ";") && depth == 0) {
+                return i + 1;
+            }
+        }
+        return invalidPos;
+    }
+}
+
+// Get the code covered by node
+std::string getText(const std::string &code, const Node &node)
+{
+    return code.substr(node.begin, node.end - node.begin);
+}
+
+// Get the code covered by tokens [begin, end)
+std::string getCode(const std::string &code, const std::vector<Token> &tokens, size_t begin, size_t end)
+{
+    return code.substr(tokens[begin].begin, tokens[end - 1].end - tokens[begin].begin);
+}
+}   // Anonymous namespace
+
+//--------------------------------------------------------------------------
+// CodeGenerator::ExpressionParser
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+namespace ExpressionParser
+{
+std::vector<Token> tokenise(const std::string &code)
+{
+    std::vector<Token> tokens;
+    for(size_t i = 0; i < code.size();) {
+        const char c = code[i];
+
+        // Skip whitespace
+        if(::isspace(static_cast<unsigned char>(c))) {
+            i++;
+        }
+        // Skip line comments
+        else if(code.compare(i, 2, "//") == 0) {
+            i = code.find('\n', i);
+            if(i == std::string::npos) {
+                i = code.size();
+            }
+        }
+        // Skip block comments
+        else if(code.compare(i, 2, "/*") == 0) {
+            i = code.find("*/", i + 2);
+            i = (i == std::string::npos) ? code.size() : (i + 2);
+        }
+        // Identifiers
+        else if(isIdentifierStart(c)) {
+            const size_t begin = i;
+            while(i < code.size() && isIdentifierChar(code[i])) {
+                i++;
+            }
+            tokens.push_back(Token{Token::Type::Identifier, code.substr(begin, i - begin), begin, i});
+        }
+        // Numbers (pp-number in C terms so includes suffixes and signed exponents)
+        else if(isDigit(c) || (c == '.' && (i + 1) < code.size() && isDigit(code[i + 1]))) {
+            const size_t begin = i;
+            const bool hex = (code.compare(i, 2, "0x") == 0 || code.compare(i, 2, "0X") == 0);
+            while(i < code.size()
+                  && (isIdentifierChar(code[i]) || code[i] == '.'
+                      || (!hex && (code[i] == '+' || code[i] == '-') && (code[i - 1] == 'e' || code[i - 1] == 'E'))))
+            {
+                i++;
+            }
+            tokens.push_back(Token{Token::Type::Number, code.substr(begin, i - begin), begin, i});
+        }
+        // String and character literals
+        else if(c == '"' || c == '\'') {
+            const size_t begin = i++;
+            while(i < code.size() && code[i] != c) {
+                i += (code[i] == '\\') ? 2 : 1;
+            }
+            i = std::min(i + 1, code.size());
+            tokens.push_back(Token{Token::Type::String, code.substr(begin, i - begin), begin, i});
+        }
+        // Punctuators
+        else {
+            const auto multi = std::find_if(std::begin(multiCharPunctuators), std::end(multiCharPunctuators),
+                                            [&code, i](const char *p){ return (code.compare(i, strlen(p), p) == 0); });
+            const size_t length = (multi == std::end(multiCharPunctuators)) ? 1 : strlen(*multi);
+            tokens.push_back(Token{Token::Type::Punctuator, code.substr(i, length), i, i + length});
+            i += length;
+        }
+    }
+    return tokens;
+}
+//--------------------------------------------------------------------------
+std::unique_ptr<Node> parseExpression(const std::vector<Token> &tokens, size_t &pos)
+{
+    Parser parser(tokens, pos);
+    auto node = parser.parseTernary();
+
+    // If expression parsed and is correctly terminated, update position and return
+    if(node && isTerminator(tokens, parser.getPos())) {
+        pos = parser.getPos();
+        return node;
+    }
+    else {
+        return nullptr;
+    }
+}
+//--------------------------------------------------------------------------
+bool evaluate(const Node &node, Constant &value)
+{
+    switch(node.type) {
+    case Node::Type::Literal:
+        value = node.value;
+        return true;
+
+    case Node::Type::Paren:
+        return evaluate(*node.children[0], value);
+
+    case Node::Type::Unary:
+        return evaluateUnary(node, value);
+
+    case Node::Type::Binary:
+        return evaluateBinary(node, value);
+
+    case Node::Type::Ternary:
+    {
+        // **NOTE** result has common type of both branches so both need to be constant
+        Constant condition;
+        Constant trueValue;
+        Constant falseValue;
+        if(!evaluate(*node.children[0], condition) || !evaluate(*node.children[1], trueValue)
+           || !evaluate(*node.children[2], falseValue))
+        {
+            return false;
+        }
+        const Constant::Type type = std::max(trueValue.type, falseValue.type);
+        value = convert(isTrue(condition) ? trueValue : falseValue, type);
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+//--------------------------------------------------------------------------
+std::unique_ptr<Node> parseFunctionSubstitutionStatement(const std::string &code, const std::string &name)
+{
+    // Parse expression from start of code
+    const auto tokens = tokenise(code);
+    size_t pos = 0;
+    auto node = parseExpression(tokens, pos);
+    if(!node || node->type != Node::Type::Call || node->op != "$(" || getText(code, *node->children[0]) != name) {
+        return nullptr;
+    }
+
+    // Return node if it's followed by the end of the code or a single semicolon
+    if(pos < tokens.size() && isPunctuator(tokens[pos], ";")) {
+        pos++;
+    }
+    return (pos == tokens.size()) ? std::move(node) : nullptr;
+}
+//--------------------------------------------------------------------------
+bool hasSideEffects(const Node &node, const std::string &code)
+{
+    switch(node.type) {
+    // Random number generation e.g. $(gennrand_uniform) advances RNG state
+    case Node::Type::Opaque:
+        return Utils::isRNGRequired(getText(code, node));
+
+    // Postfix increments and decrements always modify their operand
+    case Node::Type::Postfix:
+        return true;
+
+    case Node::Type::Unary:
+        // **NOTE** taking an address lets whatever it's passed to modify the variable e.g. frexp(x, &e)
+        if(node.op == "++" || node.op == "--" || node.op == "&") {
+            return true;
+        }
+        break;
+
+    case Node::Type::Call:
+        // Function substitutions can be replaced with any code so are assumed to have side-effects
+        if(node.op == "$(") {
+            return true;
+        }
+        // Other than standard maths functions, called functions may have side-effects
+        else if(node.op == "(" && (node.children[0]->type != Node::Type::Opaque
+                                   || !isMathsFunction(getText(code, *node.children[0]))))
+        {
+            return true;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return std::any_of(node.children.cbegin(), node.children.cend(),
+                       [&code](const std::unique_ptr<Node> &c){ return hasSideEffects(*c, code); });
+}
+//--------------------------------------------------------------------------
+std::string foldConstants(const std::string &code)
+{
+    const auto tokens = tokenise(code);
+
+    // Loop through tokens, parsing expressions wherever they may start
+    std::vector<Replacement> replacements;
+    for(size_t i = 0; i < tokens.size();) {
+        if(isExpressionStart(tokens, i)) {
+            const auto expression = parseExpression(tokens, i);
+            if(expression) {
+                foldNode(*expression, false, replacements);
+                continue;
+            }
+        }
+        i++;
+    }
+
+    // If there's nothing to replace, return code unchanged
+    if(replacements.empty()) {
+        return code;
+    }
+
+    // Otherwise splice replacements into code
+    return applyReplacements(code, replacements);
+}
+//--------------------------------------------------------------------------
+std::string removeDeadBranches(const std::string &code)
+{
+    const auto tokens = tokenise(code);
+
+    // Loop through tokens, looking for if statements
+    // **NOTE** #if directives are left for the preprocessor
+    std::vector<Replacement> replacements;
+    for(size_t i = 0; i < tokens.size(); i++) {
+        if(!isKeyword(tokens[i], "if") || (i + 1) >= tokens.size() || !isPunctuator(tokens[i + 1], "(")
+           || (i > 0 && isPunctuator(tokens[i - 1], "#")))
+        {
+            continue;
+        }
+
+        // If condition isn't constant, carry on searching inside statement
+        size_t conditionEnd = i + 2;
+        const auto condition = parseExpression(tokens, conditionEnd);
+        Constant value;
+        if(!condition || conditionEnd >= tokens.size() || !isPunctuator(tokens[conditionEnd], ")")
+           || !evaluate(*condition, value))
+        {
+            continue;
+        }
+
+        // Find extent of branches, giving up if they can't be found
+        const size_t thenBegin = conditionEnd + 1;
+        const size_t thenEnd = findStatementEnd(tokens, thenBegin);
+        if(thenEnd == invalidPos) {
+            continue;
+        }
+        const bool hasElse = (thenEnd < tokens.size() && isKeyword(tokens[thenEnd], "else"));
+        const size_t elseEnd = hasElse ? findStatementEnd(tokens, thenEnd + 1) : thenEnd;
+        if(elseEnd == invalidPos) {
+            continue;
+        }
+
+        // Replace statement with whichever branch is taken, removing any dead branches within it
+        // **NOTE** blocks keep their braces so the scope of any variables they declare is unchanged
+        std::string text;
+        if(isTrue(value)) {
+            text = removeDeadBranches(getCode(code, tokens, thenBegin, thenEnd));
+        }
+        else if(hasElse) {
+            text = removeDeadBranches(getCode(code, tokens, thenEnd + 1, elseEnd));
+        }
+
+        // If nothing is left but this statement is the body of another, replace it with an empty block
+        if(text.empty() && i > 0 && (isPunctuator(tokens[i - 1], ")") || isPunctuator(tokens[i - 1], ":")
+                                     || isKeyword(tokens[i - 1], "else") || isKeyword(tokens[i - 1], "do")))
+        {
+            text = "{}";
+        }
+        replacements.push_back(Replacement{tokens[i].begin, tokens[elseEnd - 1].end, text});
+
+        // Continue searching after statement
+        i = elseEnd - 1;
+    }
+
+    return replacements.empty() ? code : applyReplacements(code, replacements);
+}
+//--------------------------------------------------------------------------
+std::string simplify(const std::string &code)
+{
+    return removeDeadBranches(foldConstants(code));
+}
+}   // namespace ExpressionParser
+}   // namespace CodeGenerator
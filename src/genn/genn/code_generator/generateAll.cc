@@ -1,7 +1,14 @@
 #include "code_generator/generateAll.h"
 
 // Standard C++ includes
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -12,9 +19,11 @@
 #include "path.h"
 
 // GeNN includes
+#include "gennUtils.h"
 #include "modelSpecInternal.h"
 
 // Code generator includes
+#include "code_generator/backendBase.h"
 #include "code_generator/codeStream.h"
 #include "code_generator/generateInit.h"
 #include "code_generator/generateNeuronUpdate.h"
@@ -23,6 +32,101 @@
 #include "code_generator/generateRunner.h"
 #include "code_generator/modelSpecMerged.h"
 
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+//! Write contents to file unless it already contains exactly these contents
+/*! Leaving unchanged files untouched preserves their timestamps so the generated Makefile only rebuilds modules which actually changed */
+bool writeIfChanged(const filesystem::path &path, const std::string &contents)
+{
+    // If file exists and has the same size, compare its contents
+    if(path.exists() && path.file_size() == contents.size()) {
+        std::ifstream existingStream(path.str(), std::ios::binary);
+        std::ostringstream existingContents;
+        existingContents << existingStream.rdbuf();
+        if(existingContents.str() == contents) {
+            return false;
+        }
+    }
+
+    // Otherwise, (re)write file
+    std::ofstream stream(path.str(), std::ios::binary);
+    stream << contents;
+    return true;
+}
+//--------------------------------------------------------------------------
+void copyFile(const filesystem::path &source, const filesystem::path &destination)
+{
+    std::ifstream sourceStream(source.str(), std::ios::binary);
+    std::ofstream destinationStream(destination.str(), std::ios::binary);
+    destinationStream << sourceStream.rdbuf();
+}
+//--------------------------------------------------------------------------
+//! Run command to identify compiler, returning its output
+#ifndef _WIN32
+bool getCompilerIdentity(const std::string &command, std::string &identity)
+{
+    // Run command, redirecting stderr as some compilers print their version there
+    FILE *pipe = popen(("(" + command + ") 2>&1").c_str(), "r");
+    if(pipe == nullptr) {
+        return false;
+    }
+
+    // Read all output
+    char buffer[256];
+    identity.clear();
+    while(fgets(buffer, sizeof(buffer), pipe) != nullptr) {
+        identity += buffer;
+    }
+
+    // Command only identified compiler if it succeeded
+    return (pclose(pipe) == 0);
+}
+#endif
+//--------------------------------------------------------------------------
+//! Restore compiled objects and shared library matching the digests of the generated modules from build cache
+/*! Cached files are copied after the generated sources have been written so they are newer and make will not rebuild them.
+    Digests are also written to buildCache.mk so the generated Makefile can add anything it does build to the cache. */
+void restoreBuildCache(const filesystem::path &outputPath, const filesystem::path &cachePath,
+                       const std::vector<std::pair<std::string, std::string>> &modules, const std::vector<std::string> &moduleDigests,
+                       const std::string &libraryDigest)
+{
+    std::ostringstream buildCacheMake;
+    buildCacheMake << "BUILD_CACHE := " << cachePath.str() << std::endl;
+    buildCacheMake << "LIBRARY_DIGEST := " << libraryDigest << std::endl;
+
+    // Loop through modules
+    size_t numRestored = 0;
+    for(size_t i = 0; i < modules.size(); i++) {
+        buildCacheMake << modules[i].first << "_DIGEST := " << moduleDigests[i] << std::endl;
+
+        // If both object and dependency file are cached, restore them
+        // **NOTE** dependency file is restored first as objects depend on them
+        const auto cachedObject = cachePath / (moduleDigests[i] + ".o");
+        const auto cachedDependencies = cachePath / (moduleDigests[i] + ".d");
+        if(cachedObject.exists() && cachedDependencies.exists()) {
+            copyFile(cachedDependencies, outputPath / (modules[i].first + ".d"));
+            copyFile(cachedObject, outputPath / (modules[i].first + ".o"));
+            numRestored++;
+        }
+    }
+
+    // If all objects were restored and library is also cached, restore it
+    const auto cachedLibrary = cachePath / (libraryDigest + ".so");
+    if(numRestored == modules.size() && cachedLibrary.exists()) {
+        copyFile(cachedLibrary, outputPath / "librunner.so");
+        LOGI_CODE_GEN << "Restored all modules and library from build cache";
+    }
+    else {
+        LOGI_CODE_GEN << "Restored " << numRestored << "/" << modules.size() << " modules from build cache";
+    }
+
+    writeIfChanged(outputPath / "buildCache.mk", buildCacheMake.str());
+}
+}   // Anonymous namespace
+
 //--------------------------------------------------------------------------
 // CodeGenerator
 //--------------------------------------------------------------------------
@@ -32,16 +136,23 @@ std::vector<std::string> CodeGenerator::generateAll(const ModelSpecInternal &mod
     // Create directory for generated code
     filesystem::create_directory(outputPath);
 
-    // Open output file streams for generated code files
-    std::ofstream definitionsStream((outputPath / "definitions.h").str());
-    std::ofstream definitionsInternalStream((outputPath / "definitionsInternal.h").str());
-    std::ofstream supportCodeStream((outputPath / "supportCode.h").str());
-    std::ofstream neuronUpdateStream((outputPath / "neuronUpdate.cc").str());
-    std::ofstream synapseUpdateStream((outputPath / "synapseUpdate.cc").str());
-    std::ofstream initStream((outputPath / "init.cc").str());
-    std::ofstream runnerStream((outputPath / "runner.cc").str());
+    // If a connectivity cache is configured, create its directory so the generated initialisation code can write to it
+    const std::string connectivityCacheDirectory = backend.getConnectivityCacheDirectory();
+    if(!connectivityCacheDirectory.empty()) {
+        filesystem::create_directory(filesystem::path(connectivityCacheDirectory));
+    }
+
+    // Create string streams to generate code into
+    // **NOTE** files are only written once generation is complete so unchanged ones can be left untouched
+    std::ostringstream definitionsStream;
+    std::ostringstream definitionsInternalStream;
+    std::ostringstream supportCodeStream;
+    std::ostringstream neuronUpdateStream;
+    std::ostringstream synapseUpdateStream;
+    std::ostringstream initStream;
+    std::ostringstream runnerStream;
 
-    // Wrap output file streams in CodeStreams for formatting
+    // Wrap string streams in CodeStreams for formatting
     CodeStream definitions(definitionsStream);
     CodeStream definitionsInternal(definitionsInternalStream);
     CodeStream supportCode(supportCodeStream);
@@ -51,25 +162,106 @@ std::vector<std::string> CodeGenerator::generateAll(const ModelSpecInternal &mod
     CodeStream runner(runnerStream);
 
     // Create merged model
+    const auto mergeStart = std::chrono::steady_clock::now();
     ModelSpecMerged modelMerged(model, backend);
+    const std::chrono::duration<double> mergeDuration = std::chrono::steady_clock::now() - mergeStart;
+
+    // Handler to generate additional modules e.g. for individual merged groups
+    std::vector<std::pair<std::string, std::string>> additionalModules;
+    auto moduleHandler =
+        [&additionalModules](const std::string &name, BackendBase::HostHandler handler)
+        {
+            std::ostringstream moduleStream;
+            CodeStream module(moduleStream);
+            module << "#include \"definitionsInternal.h\"" << std::endl;
+            module << "#include \"supportCode.h\"" << std::endl;
+            module << std::endl;
+            handler(module);
+            additionalModules.emplace_back(name, moduleStream.str());
+        };
 
     // Generate modules
+    const auto generateStart = std::chrono::steady_clock::now();
     MergedEGPMap mergedEGPs;
     auto mem = generateRunner(definitions, definitionsInternal, runner, mergedEGPs, modelMerged, backend);
-    generateNeuronUpdate(neuronUpdate, mergedEGPs, modelMerged, backend, standaloneModules);
-    generateSynapseUpdate(synapseUpdate, mergedEGPs, modelMerged, backend, standaloneModules);
-    generateInit(init, mergedEGPs, modelMerged, backend, standaloneModules);
+    generateNeuronUpdate(neuronUpdate, mergedEGPs, modelMerged, backend, moduleHandler, standaloneModules);
+    generateSynapseUpdate(synapseUpdate, mergedEGPs, modelMerged, backend, moduleHandler, standaloneModules);
+    generateInit(init, mergedEGPs, modelMerged, backend, moduleHandler, standaloneModules);
 
     generateSupportCode(supportCode, modelMerged);
+    const std::chrono::duration<double> generateDuration = std::chrono::steady_clock::now() - generateStart;
+
+    // Create basic list of modules and their code, adding any additional modules
+    std::vector<std::pair<std::string, std::string>> moduleCode = {{"neuronUpdate", neuronUpdateStream.str()},
+                                                                   {"synapseUpdate", synapseUpdateStream.str()},
+                                                                   {"init", initStream.str()}};
+    moduleCode.insert(moduleCode.end(), additionalModules.cbegin(), additionalModules.cend());
 
-    // Create basic list of modules
-    std::vector<std::string> modules = {"neuronUpdate", "synapseUpdate", "init"};
+    // Write headers and modules whose contents have changed
+    size_t numChanged = 0;
+    numChanged += writeIfChanged(outputPath / "definitions.h", definitionsStream.str());
+    numChanged += writeIfChanged(outputPath / "definitionsInternal.h", definitionsInternalStream.str());
+    numChanged += writeIfChanged(outputPath / "supportCode.h", supportCodeStream.str());
+    numChanged += writeIfChanged(outputPath / "runner.cc", runnerStream.str());
+    for(const auto &m : moduleCode) {
+        numChanged += writeIfChanged(outputPath / (m.first + ".cc"), m.second);
+    }
+    LOGD_CODE_GEN << numChanged << "/" << (moduleCode.size() + 4) << " generated files changed";
 
     // If we aren't building standalone modules
     if(!standaloneModules) {
         // Because it won't be included in each
         // module, add runner to list of modules
-        modules.push_back("runner");
+        moduleCode.emplace_back("runner", runnerStream.str());
+
+        // If a build cache is configured
+        const std::string buildCacheDirectory = backend.getBuildCacheDirectory();
+        if(!buildCacheDirectory.empty()) {
+#ifdef _WIN32
+            LOGW_CODE_GEN << "Build cache is only supported when building with make - ignoring";
+#else
+            // Identify the compiler the generated Makefile will use as, even with the same flags,
+            // objects built by different compilers or for different targets can't be mixed
+            std::string compilerIdentity;
+            if(!getCompilerIdentity(backend.getCompilerIdentityCommand(), compilerIdentity)) {
+                throw std::runtime_error("Unable to identify compiler for build cache: " + compilerIdentity);
+            }
+
+            // Hash everything every module is compiled with i.e. compiler, headers and compiler flags
+            std::ostringstream compileFlags;
+            backend.genMakefilePreamble(compileFlags);
+            backend.genMakefileCompileRule(compileFlags);
+            size_t commonHash = 0;
+            Utils::updateHash(definitionsStream.str(), commonHash);
+            Utils::updateHash(definitionsInternalStream.str(), commonHash);
+            Utils::updateHash(supportCodeStream.str(), commonHash);
+            Utils::updateHash(compileFlags.str(), commonHash);
+            Utils::updateHash(compilerIdentity, commonHash);
+
+            // Library is additionally keyed by the link rule
+            std::ostringstream linkRule;
+            backend.genMakefileLinkRule(linkRule);
+            size_t libraryHash = 0;
+            Utils::updateHash(linkRule.str(), libraryHash);
+
+            // Calculate digest of each module by combining common hash with its name and code
+            std::vector<std::string> moduleDigests;
+            for(const auto &m : moduleCode) {
+                size_t moduleHash = commonHash;
+                Utils::updateHash(m.first, moduleHash);
+                Utils::updateHash(m.second, moduleHash);
+                moduleDigests.push_back(Utils::getHexDigest(moduleHash));
+
+                // Library's digest combines those of all modules
+                Utils::updateHash(moduleHash, libraryHash);
+            }
+
+            // Create cache directory if it doesn't exist and restore anything that's already been built
+            const filesystem::path cachePath(buildCacheDirectory);
+            filesystem::create_directory(cachePath);
+            restoreBuildCache(outputPath, cachePath.make_absolute(), moduleCode, moduleDigests, Utils::getHexDigest(libraryHash));
+#endif
+        }
 
         // **YUCK** this is kinda (ab)using standaloneModules for things it's not intended for but...
         // Show memory usage
@@ -94,8 +286,13 @@ std::vector<std::string> CodeGenerator::generateAll(const ModelSpecInternal &mod
         LOGI << "\t" << modelMerged.getMergedSynapseSparseInitGroups().size() << " merged synapse sparse init groups";
         LOGI << "\t" << modelMerged.getMergedNeuronSpikeQueueUpdateGroups().size() << " merged neuron spike queue update groups";
         LOGI << "\t" << modelMerged.getMergedSynapseDendriticDelayUpdateGroups().size() << " merged synapse dendritic delay update groups";
+        LOGI << "Merging took " << mergeDuration.count() << "s and generating code took " << generateDuration.count() << "s";
     }
 
     // Return list of modules
+    std::vector<std::string> modules;
+    modules.reserve(moduleCode.size());
+    std::transform(moduleCode.cbegin(), moduleCode.cend(), std::back_inserter(modules),
+                   [](const std::pair<std::string, std::string> &m){ return m.first; });
     return modules;
 }
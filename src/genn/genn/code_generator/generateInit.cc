@@ -190,7 +190,7 @@ void genInitWUVarCode(CodeGenerator::CodeStream &os, const CodeGenerator::Backen
 // CodeGenerator
 //--------------------------------------------------------------------------
 void CodeGenerator::generateInit(CodeStream &os, const MergedEGPMap &mergedEGPs, const ModelSpecMerged &modelMerged,
-                                 const BackendBase &backend, bool standaloneModules)
+                                 const BackendBase &backend, BackendBase::ModuleHandler moduleHandler, bool standaloneModules)
 {
     if(standaloneModules) {
         os << "#include \"runner.cc\"" << std::endl;
@@ -201,10 +201,10 @@ void CodeGenerator::generateInit(CodeStream &os, const MergedEGPMap &mergedEGPs,
 
     // Generate functions to push merged synapse group structures
     const ModelSpecInternal &model = modelMerged.getModel();
-    genMergedGroupPush(os, modelMerged.getMergedNeuronInitGroups(), mergedEGPs, "NeuronInit", backend);
-    genMergedGroupPush(os, modelMerged.getMergedSynapseDenseInitGroups(), mergedEGPs, "SynapseDenseInit", backend);
+    genMergedGroupPush(os, modelMerged.getMergedNeuronInitGroups(), mergedEGPs, "NeuronInit", backend, modelMerged.getModel().getBatchSize());
+    genMergedGroupPush(os, modelMerged.getMergedSynapseDenseInitGroups(), mergedEGPs, "SynapseDenseInit", backend, modelMerged.getModel().getBatchSize());
     genMergedGroupPush(os, modelMerged.getMergedSynapseConnectivityInitGroups(), mergedEGPs, "SynapseConnectivityInit", backend);
-    genMergedGroupPush(os, modelMerged.getMergedSynapseSparseInitGroups(), mergedEGPs, "SynapseSparseInit", backend);
+    genMergedGroupPush(os, modelMerged.getMergedSynapseSparseInitGroups(), mergedEGPs, "SynapseSparseInit", backend, modelMerged.getModel().getBatchSize());
 
     backend.genInit(os, modelMerged,
         // Local neuron group initialisation
@@ -377,5 +377,6 @@ void CodeGenerator::generateInit(CodeStream &os, const MergedEGPMap &mergedEGPs,
         [&backend, &mergedEGPs](CodeStream &os)
         {
             genScalarEGPPush(os, mergedEGPs, "SynapseSparseInit", backend);
-        });
+        },
+        moduleHandler);
 }
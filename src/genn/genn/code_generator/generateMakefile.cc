@@ -31,14 +31,35 @@ void CodeGenerator::generateMakefile(std::ostream &os, const BackendBase &backen
     os << "DEPS := $(OBJECTS:.o=.d)" << std::endl;
     os << std::endl;
 
+    // If a build cache is used, include the digests of the generated modules written by generateAll
+    const bool buildCache = !backend.getBuildCacheDirectory().empty();
+    if(buildCache) {
+        os << "include buildCache.mk" << std::endl;
+        os << std::endl;
+    }
+
     // Generate phony rules for all and clean
-    os << ".PHONY: all clean" << std::endl;
+    os << ".PHONY: all clean" << (buildCache ? " cache" : "") << std::endl;
     os << std::endl;
 
     // Add rule to build runner
-    os << "all: librunner.so" << std::endl;
+    os << "all: librunner.so" << (buildCache ? " cache" : "") << std::endl;
     os << std::endl;
 
+    // If a build cache is used, add rule to copy any objects and library which aren't yet in it
+    // **NOTE** files are copied to a temporary name and then renamed so other builds never see partial files
+    if(buildCache) {
+        os << "cache: librunner.so" << std::endl;
+        os << "\t@mkdir -p \"$(BUILD_CACHE)\"" << std::endl;
+        for(const auto &m : moduleNames) {
+            const std::string cached = "\"$(BUILD_CACHE)/$(" + m + "_DIGEST)";
+            os << "\t@test -f " << cached << ".o\" || (cp " << m << ".d " << cached << ".d\" && cp " << m << ".o " << cached << ".o.$$$$\" && mv " << cached << ".o.$$$$\" " << cached << ".o\")" << std::endl;
+        }
+        const std::string cachedLibrary = "\"$(BUILD_CACHE)/$(LIBRARY_DIGEST)";
+        os << "\t@test -f " << cachedLibrary << ".so\" || (cp librunner.so " << cachedLibrary << ".so.$$$$\" && mv " << cachedLibrary << ".so.$$$$\" " << cachedLibrary << ".so\")" << std::endl;
+        os << std::endl;
+    }
+
     // Add rule to build shared library from objects
     os << "librunner.so: $(OBJECTS)" << std::endl;
     backend.genMakefileLinkRule(os);
@@ -2,6 +2,7 @@
 
 // Standard C++ includes
 #include <iostream>
+#include <sstream>
 #include <string>
 
 // PLOG includes
@@ -14,6 +15,7 @@
 #include "code_generator/backendBase.h"
 #include "code_generator/codeGenUtils.h"
 #include "code_generator/codeStream.h"
+#include "code_generator/expressionParser.h"
 #include "code_generator/modelSpecMerged.h"
 #include "code_generator/substitutions.h"
 #include "code_generator/teeStream.h"
@@ -28,7 +30,7 @@ void addNeuronModelSubstitutions(CodeGenerator::Substitutions &substitution, con
 {
     const NeuronModels::Base *nm = ng.getNeuronModel();
     substitution.addVarNameSubstitution(nm->getVars(), sourceSuffix, "l", destSuffix);
-    substitution.addParamValueSubstitution(nm->getParamNames(), ng.getParams(), sourceSuffix);
+    substitution.addParamValueSubstitution(nm->getParamNames(), ng.getParams(), ng.getDynamicParams(), sourceSuffix, "group.", destSuffix);
     substitution.addVarValueSubstitution(nm->getDerivedParams(), ng.getDerivedParams(), sourceSuffix);
     substitution.addVarNameSubstitution(nm->getExtraGlobalParams(), sourceSuffix, "group.");
 }
@@ -38,7 +40,7 @@ void addNeuronModelSubstitutions(CodeGenerator::Substitutions &substitution, con
 // CodeGenerator
 //--------------------------------------------------------------------------
 void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mergedEGPs, const ModelSpecMerged &modelMerged,
-                                         const BackendBase &backend, bool standaloneModules)
+                                         const BackendBase &backend, BackendBase::ModuleHandler moduleHandler, bool standaloneModules)
 {
     if(standaloneModules) {
         os << "#include \"runner.cc\"" << std::endl;
@@ -51,8 +53,8 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
 
     // Generate functions to push merged neuron group structures
 
-    genMergedGroupPush(os, modelMerged.getMergedNeuronSpikeQueueUpdateGroups(), mergedEGPs, "NeuronSpikeQueueUpdate", backend);
-    genMergedGroupPush(os, modelMerged.getMergedNeuronUpdateGroups(), mergedEGPs, "NeuronUpdate", backend);
+    genMergedGroupPush(os, modelMerged.getMergedNeuronSpikeQueueUpdateGroups(), mergedEGPs, "NeuronSpikeQueueUpdate", backend, modelMerged.getModel().getBatchSize());
+    genMergedGroupPush(os, modelMerged.getMergedNeuronUpdateGroups(), mergedEGPs, "NeuronUpdate", backend, modelMerged.getModel().getBatchSize());
 
     // Neuron update kernel
     backend.genNeuronUpdate(os, modelMerged,
@@ -64,6 +66,51 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
             const ModelSpecInternal &model = modelMerged.getModel();
             const NeuronModels::Base *nm = ng.getArchetype().getNeuronModel();
 
+            // If neuron model generates the spikes of the whole population at once
+            std::string popSpikeCode = nm->getPopulationSpikeCode();
+            if(!popSpikeCode.empty()) {
+                const std::string &name = ng.getArchetype().getName();
+                if(!nm->getVars().empty() || !nm->getSimCode().empty()
+                   || !nm->getThresholdConditionCode().empty() || !nm->getResetCode().empty())
+                {
+                    throw std::runtime_error("Neuron group '" + name + "' uses population spike code so cannot have variables, sim, threshold condition or reset code");
+                }
+                if(!ng.getArchetype().getInSyn().empty() || !ng.getArchetype().getCurrentSources().empty()) {
+                    throw std::runtime_error("Neuron group '" + name + "' uses population spike code so cannot have incoming synapses or current sources");
+                }
+                if(ng.getArchetype().isSpikeEventRequired()) {
+                    throw std::runtime_error("Neuron group '" + name + "' uses population spike code so cannot emit spike-like events");
+                }
+
+                // Generate code to emit a spike from the neuron passed as first 'function' parameter
+                // **NOTE** this is copied into a local so any code inserted by emit handlers can index with it
+                std::ostringstream emitSpikeStream;
+                CodeStream emitSpike(emitSpikeStream);
+                {
+                    CodeStream::Scope b(emitSpike);
+                    emitSpike << "const unsigned int spikeID = $(0);" << std::endl;
+
+                    Substitutions spikeSubs(&popSubs);
+                    spikeSubs.addVarSubstitution("id", "spikeID");
+                    genEmitTrueSpike(emitSpike, ng, spikeSubs);
+                }
+
+                Substitutions neuronSubs(&popSubs);
+                neuronSubs.addVarSubstitution("num_neurons", "group.numNeurons");
+                neuronSubs.addFuncSubstitution("addSpike", 1, emitSpikeStream.str());
+                addNeuronModelSubstitutions(neuronSubs, ng.getArchetype());
+
+                if (!nm->getSupportCode().empty()) {
+                    os << "using namespace " << modelMerged.getNeuronUpdateSupportCodeNamespace(nm->getSupportCode()) <<  ";" << std::endl;
+                }
+
+                os << "// generate population spikes" << std::endl;
+                neuronSubs.applyCheckUnreplaced(popSpikeCode, "populationSpikeCode : merged" + std::to_string(ng.getIndex()));
+                popSpikeCode = ensureFtype(popSpikeCode, model.getPrecision());
+                os << popSpikeCode << std::endl;
+                return;
+            }
+
             // Generate code to copy neuron state into local variable
             for(const auto &v : nm->getVars()) {
                 if(v.access == VarAccess::READ_ONLY) {
@@ -159,7 +206,7 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                 else {
                     inSynSubs.addVarValueSubstitution(psm->getVars(), sg->getPSConstInitVals());
                 }
-                inSynSubs.addParamValueSubstitution(psm->getParamNames(), sg->getPSParams());
+                inSynSubs.addParamValueSubstitution(psm->getParamNames(), sg->getPSParams(), sg->getPSDynamicParams(), "", "group.", "InSyn" + std::to_string(i));
 
                 // Create iterators to iterate over the names of the postsynaptic model's derived parameters
                 inSynSubs.addVarValueSubstitution(psm->getDerivedParams(), sg->getPSDerivedParams());
@@ -214,7 +261,7 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                 Substitutions currSourceSubs(&popSubs);
                 currSourceSubs.addFuncSubstitution("injectCurrent", 1, "Isyn += $(0)");
                 currSourceSubs.addVarNameSubstitution(csm->getVars(), "", "lcs");
-                currSourceSubs.addParamValueSubstitution(csm->getParamNames(), cs->getParams());
+                currSourceSubs.addParamValueSubstitution(csm->getParamNames(), cs->getParams(), cs->getDynamicParams(), "", "group.", "CS" + std::to_string(i));
                 currSourceSubs.addVarValueSubstitution(csm->getDerivedParams(), cs->getDerivedParams());
                 currSourceSubs.addVarNameSubstitution(csm->getExtraGlobalParams(), "", "group.", "CS" + std::to_string(i));
 
@@ -242,6 +289,9 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
 
                 neuronSubs.applyCheckUnreplaced(thCode, "thresholdConditionCode : merged" + std::to_string(ng.getIndex()));
                 thCode= ensureFtype(thCode, model.getPrecision());
+                if(backend.isConstantFoldingEnabled()) {
+                    thCode = ExpressionParser::foldConstants(thCode);
+                }
 
                 if (nm->isAutoRefractoryRequired()) {
                     os << "const bool oldSpike= (" << thCode << ");" << std::endl;
@@ -258,6 +308,9 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
             std::string sCode = nm->getSimCode();
             neuronSubs.applyCheckUnreplaced(sCode, "simCode : merged" + std::to_string(ng.getIndex()));
             sCode = ensureFtype(sCode, model.getPrecision());
+            if(backend.isConstantFoldingEnabled()) {
+                sCode = ExpressionParser::simplify(sCode);
+            }
 
             os << sCode << std::endl;
 
@@ -324,6 +377,9 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                         std::string rCode = nm->getResetCode();
                         neuronSubs.applyCheckUnreplaced(rCode, "resetCode : merged" + std::to_string(ng.getIndex()));
                         rCode = ensureFtype(rCode, model.getPrecision());
+                        if(backend.isConstantFoldingEnabled()) {
+                            rCode = ExpressionParser::simplify(rCode);
+                        }
 
                         os << "// spike reset code" << std::endl;
                         os << rCode << std::endl;
@@ -417,7 +473,7 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                     os << preSubs["id"] << "];" << std::endl;
                 }
 
-                preSubs.addParamValueSubstitution(sg->getWUModel()->getParamNames(), sg->getWUParams());
+                preSubs.addParamValueSubstitution(sg->getWUModel()->getParamNames(), sg->getWUParams(), sg->getWUDynamicParams(), "", "group.", "WUPre" + std::to_string(i));
                 preSubs.addVarValueSubstitution(sg->getWUModel()->getDerivedParams(), sg->getWUDerivedParams());
                 preSubs.addVarNameSubstitution(sg->getWUModel()->getExtraGlobalParams(), "", "group.", "WUPre" + std::to_string(i));
                 preSubs.addVarNameSubstitution(sg->getWUModel()->getPreVars(), "", "l");
@@ -465,7 +521,7 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                     os << postSubs["id"] << "];" << std::endl;
                 }
 
-                postSubs.addParamValueSubstitution(sg->getWUModel()->getParamNames(), sg->getWUParams());
+                postSubs.addParamValueSubstitution(sg->getWUModel()->getParamNames(), sg->getWUParams(), sg->getWUDynamicParams(), "", "group.", "WUPost" + std::to_string(i));
                 postSubs.addVarValueSubstitution(sg->getWUModel()->getDerivedParams(), sg->getWUDerivedParams());
                 postSubs.addVarNameSubstitution(sg->getWUModel()->getExtraGlobalParams(), "", "group.", "WUPost" + std::to_string(i));
                 postSubs.addVarNameSubstitution(sg->getWUModel()->getPostVars(), "", "l");
@@ -499,5 +555,6 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
         [&backend, &mergedEGPs](CodeStream &os)
         {
             genScalarEGPPush(os, mergedEGPs, "NeuronUpdate", backend);
-        });
+        },
+        moduleHandler);
 }
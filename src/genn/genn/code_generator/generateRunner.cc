@@ -3,6 +3,8 @@
 // Standard C++ includes
 #include <sstream>
 #include <string>
+#include <tuple>
+#include <vector>
 
 // GeNN includes
 #include "gennUtils.h"
@@ -143,24 +145,66 @@ void orderNeuronGroupChildren(const NeuronGroupMerged &m, std::vector<std::vecto
     const std::vector<T> &archetypeChildren = (m.getArchetype().*getVectorFunc)();
     orderNeuronGroupChildren(m, archetypeChildren, sortedGroupChildren, getVectorFunc, isCompatibleFunc);
 }
-
+//-------------------------------------------------------------------------
+// Sizes of the arrays allocated for a single batch instance of each group
+//-------------------------------------------------------------------------
+size_t getNumSpikeCounts(const NeuronGroupInternal &ng)
+{
+    return ng.isTrueSpikeRequired() ? ng.getNumDelaySlots() : 1;
+}
+//-------------------------------------------------------------------------
+size_t getNumSpikes(const NeuronGroupInternal &ng)
+{
+    return ng.isTrueSpikeRequired() ? ng.getNumNeurons() * ng.getNumDelaySlots() : ng.getNumNeurons();
+}
+//-------------------------------------------------------------------------
+size_t getNeuronVarSize(const NeuronGroupInternal &ng, const std::string &varName)
+{
+    return ng.isVarQueueRequired(varName) ? ng.getNumNeurons() * ng.getNumDelaySlots() : ng.getNumNeurons();
+}
+//-------------------------------------------------------------------------
+size_t getSynapseVarSize(const BackendBase &backend, const SynapseGroupInternal &sg)
+{
+    return (sg.getMatrixType() & SynapseMatrixConnectivity::CSR)
+        ? sg.getMaxSynapses()
+        : sg.getSrcNeuronGroup()->getNumNeurons() * backend.getSynapticMatrixRowStride(sg);
+}
+//-------------------------------------------------------------------------
+size_t getSynapsePreVarSize(const SynapseGroupInternal &sg)
+{
+    return (sg.getDelaySteps() == NO_DELAY)
+        ? sg.getSrcNeuronGroup()->getNumNeurons()
+        : sg.getSrcNeuronGroup()->getNumNeurons() * sg.getSrcNeuronGroup()->getNumDelaySlots();
+}
+//-------------------------------------------------------------------------
+size_t getSynapsePostVarSize(const SynapseGroupInternal &sg)
+{
+    return (sg.getBackPropDelaySteps() == NO_DELAY)
+        ? sg.getTrgNeuronGroup()->getNumNeurons()
+        : sg.getTrgNeuronGroup()->getNumNeurons() * sg.getTrgNeuronGroup()->getNumDelaySlots();
+}
 //-------------------------------------------------------------------------
 void genMergedNeuronStruct(const BackendBase &backend, CodeStream &definitionsInternal,
                            CodeStream &definitionsInternalFunc, CodeStream &runnerVarAlloc,
                            MergedEGPMap &mergedEGPs, const NeuronGroupMerged &m,
-                           const std::string &precision, const std::string &timePrecision, bool init)
+                           const std::string &precision, const std::string &timePrecision,
+                           unsigned int batchSize, bool init)
 {
     MergedNeuronStructGenerator gen(m);
 
     gen.addField("unsigned int", "numNeurons",
                  [](const NeuronGroupInternal &ng, size_t){ return std::to_string(ng.getNumNeurons()); });
 
-    gen.addPointerField("unsigned int", "spkCnt", backend.getArrayPrefix() + "glbSpkCnt");
-    gen.addPointerField("unsigned int", "spk", backend.getArrayPrefix() + "glbSpk");
+    gen.addBatchedPointerField("unsigned int", "spkCnt", backend.getArrayPrefix() + "glbSpkCnt",
+                               [](const NeuronGroupInternal &ng, size_t){ return getNumSpikeCounts(ng); });
+    gen.addBatchedPointerField("unsigned int", "spk", backend.getArrayPrefix() + "glbSpk",
+                               [](const NeuronGroupInternal &ng, size_t){ return getNumSpikes(ng); });
 
     if(m.getArchetype().isSpikeEventRequired()) {
-        gen.addPointerField("unsigned int", "spkCntEvnt", backend.getArrayPrefix() + "glbSpkCntEvnt");
-        gen.addPointerField("unsigned int", "spkEvnt", backend.getArrayPrefix() + "glbSpkEvnt");
+        gen.addBatchedPointerField("unsigned int", "spkCntEvnt", backend.getArrayPrefix() + "glbSpkCntEvnt",
+                                   [](const NeuronGroupInternal &ng, size_t){ return ng.getNumDelaySlots(); });
+        gen.addBatchedPointerField("unsigned int", "spkEvnt", backend.getArrayPrefix() + "glbSpkEvnt",
+                                   [](const NeuronGroupInternal &ng, size_t){ return ng.getNumNeurons() * ng.getNumDelaySlots(); });
     }
 
     if(m.getArchetype().isDelayRequired()) {
@@ -172,20 +216,31 @@ void genMergedNeuronStruct(const BackendBase &backend, CodeStream &definitionsIn
     }
 
     if(m.getArchetype().isSpikeTimeRequired()) {
-        gen.addPointerField(timePrecision, "sT", backend.getArrayPrefix() + "sT");
+        gen.addBatchedPointerField(timePrecision, "sT", backend.getArrayPrefix() + "sT",
+                                   [](const NeuronGroupInternal &ng, size_t){ return ng.getNumNeurons() * ng.getNumDelaySlots(); });
     }
 
     if(backend.isPopulationRNGRequired() && m.getArchetype().isSimRNGRequired()) {
         gen.addPointerField("curandState", "rng", backend.getArrayPrefix() + "rng");
     }
 
+    // Spike recording buffers are only written by neuron update
+    if(!init && m.getArchetype().isSpikeRecordingEnabled()) {
+        gen.addBatchedPointerField("uint32_t", "recordSpk", backend.getArrayPrefix() + "recordSpk",
+                                   [](const NeuronGroupInternal &ng, size_t){ return (ng.getNumNeurons() + 31) / 32; });
+    }
+
     // Add pointers to variables
     const NeuronModels::Base *nm = m.getArchetype().getNeuronModel();
-    gen.addVars(nm->getVars(), backend.getArrayPrefix());
+    for(const auto &v : nm->getVars()) {
+        gen.addBatchedPointerField(v.type, v.name, backend.getArrayPrefix() + v.name,
+                                   [v](const NeuronGroupInternal &ng, size_t){ return getNeuronVarSize(ng, v.name); });
+    }
 
-    // Extra global parameters are not required for init
+    // Extra global parameters and dynamic parameters are not required for init
     if(!init) {
         gen.addEGPs(nm->getExtraGlobalParams());
+        gen.addDynamicParams(nm->getParamNames(), m.getArchetype().getDynamicParams());
     }
 
     // Build vector of vectors containin each child group's merged in syns, ordered to match those of the archetype group
@@ -203,11 +258,16 @@ void genMergedNeuronStruct(const BackendBase &backend, CodeStream &definitionsIn
         const SynapseGroupInternal *sg = m.getArchetype().getMergedInSyn()[i].first;
 
         // Add pointer to insyn
-        gen.addMergedInSynPointerField(precision, "inSynInSyn", i, backend.getArrayPrefix() + "inSyn", sortedMergedInSyns);
+        gen.addMergedInSynPointerField(precision, "inSynInSyn", i, backend.getArrayPrefix() + "inSyn", sortedMergedInSyns,
+                                       [](const NeuronGroupInternal &ng, size_t){ return ng.getNumNeurons(); });
 
         // Add pointer to dendritic delay buffer if required
         if (sg->isDendriticDelayRequired()) {
-            gen.addMergedInSynPointerField(precision, "denDelayInSyn", i, backend.getArrayPrefix() + "denDelay", sortedMergedInSyns);
+            gen.addMergedInSynPointerField(precision, "denDelayInSyn", i, backend.getArrayPrefix() + "denDelay", sortedMergedInSyns,
+                                           [&sortedMergedInSyns, i](const NeuronGroupInternal &ng, size_t groupIndex)
+                                           {
+                                               return sortedMergedInSyns[groupIndex][i].first->getMaxDendriticDelayTimesteps() * ng.getNumNeurons();
+                                           });
 
             gen.addField("volatile unsigned int*", "denDelayPtrInSyn" + std::to_string(i),
                          [&backend, &sortedMergedInSyns, i](const NeuronGroupInternal&, size_t groupIndex)
@@ -219,11 +279,14 @@ void genMergedNeuronStruct(const BackendBase &backend, CodeStream &definitionsIn
         // Add pointers to state variables
         if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) {
             for(const auto &v : sg->getPSModel()->getVars()) {
-                gen.addMergedInSynPointerField(v.type, v.name + "InSyn", i, backend.getArrayPrefix() + v.name, sortedMergedInSyns);
+                gen.addMergedInSynPointerField(v.type, v.name + "InSyn", i, backend.getArrayPrefix() + v.name, sortedMergedInSyns,
+                                               [](const NeuronGroupInternal &ng, size_t){ return ng.getNumNeurons(); });
             }
         }
 
         if(!init) {
+            gen.addMergedInSynDynamicParams(sg->getPSModel()->getParamNames(), sg->getPSDynamicParams(), "InSyn", i, sortedMergedInSyns);
+
             /*for(const auto &e : egps) {
                 gen.addField(e.type + " " + e.name + std::to_string(i),
                              [e](const typename T::GroupInternal &g){ return e.name + g.getName(); });
@@ -244,7 +307,8 @@ void genMergedNeuronStruct(const BackendBase &backend, CodeStream &definitionsIn
         const auto *cs = m.getArchetype().getCurrentSources()[i];
 
         for(const auto &v : cs->getCurrentSourceModel()->getVars()) {
-            gen.addCurrentSourcePointerField(v.type, v.name + "CS", i, backend.getArrayPrefix() + v.name, sortedCurrentSources);
+            gen.addCurrentSourcePointerField(v.type, v.name + "CS", i, backend.getArrayPrefix() + v.name, sortedCurrentSources,
+                                             [](const NeuronGroupInternal &ng, size_t){ return ng.getNumNeurons(); });
         }
 
         if(!init) {
@@ -257,6 +321,9 @@ void genMergedNeuronStruct(const BackendBase &backend, CodeStream &definitionsIn
                              },
                              Utils::isTypePointer(e.type) ? MergedNeuronStructGenerator::FieldType::PointerEGP : MergedNeuronStructGenerator::FieldType::ScalarEGP);
             }
+
+            gen.addCurrentSourceDynamicParams(cs->getCurrentSourceModel()->getParamNames(), cs->getDynamicParams(),
+                                              "CS", i, sortedCurrentSources);
         }
     }
 
@@ -275,7 +342,15 @@ void genMergedNeuronStruct(const BackendBase &backend, CodeStream &definitionsIn
         const auto *sg = inSynWithPostCode[i];
 
         for(const auto &v : sg->getWUModel()->getPostVars()) {
-            gen.addSynPointerField(v.type, v.name + "WUPost", i, backend.getArrayPrefix() + v.name, sortedInSynWithPostCode);
+            gen.addSynPointerField(v.type, v.name + "WUPost", i, backend.getArrayPrefix() + v.name, sortedInSynWithPostCode,
+                                   [&sortedInSynWithPostCode, i](const NeuronGroupInternal&, size_t groupIndex)
+                                   {
+                                       return getSynapsePostVarSize(*sortedInSynWithPostCode[groupIndex][i]);
+                                   });
+        }
+
+        if(!init) {
+            gen.addSynDynamicParams(sg->getWUModel()->getParamNames(), sg->getWUDynamicParams(), "WUPost", i, sortedInSynWithPostCode);
         }
     }
 
@@ -294,7 +369,15 @@ void genMergedNeuronStruct(const BackendBase &backend, CodeStream &definitionsIn
         const auto *sg = outSynWithPreCode[i];
 
         for(const auto &v : sg->getWUModel()->getPreVars()) {
-            gen.addSynPointerField(v.type, v.name + "WUPre", i, backend.getArrayPrefix() + v.name, sortedOutSynWithPreCode);
+            gen.addSynPointerField(v.type, v.name + "WUPre", i, backend.getArrayPrefix() + v.name, sortedOutSynWithPreCode,
+                                   [&sortedOutSynWithPreCode, i](const NeuronGroupInternal&, size_t groupIndex)
+                                   {
+                                       return getSynapsePreVarSize(*sortedOutSynWithPreCode[groupIndex][i]);
+                                   });
+        }
+
+        if(!init) {
+            gen.addSynDynamicParams(sg->getWUModel()->getParamNames(), sg->getWUDynamicParams(), "WUPre", i, sortedOutSynWithPreCode);
         }
     }
 
@@ -333,13 +416,14 @@ void genMergedNeuronStruct(const BackendBase &backend, CodeStream &definitionsIn
     
     // Generate structure definitions and instantiation
     gen.generate(definitionsInternal, definitionsInternalFunc, runnerVarAlloc, mergedEGPs,
-                 init ? "NeuronInit" : "NeuronUpdate");
+                 init ? "NeuronInit" : "NeuronUpdate", batchSize);
 }
 //-------------------------------------------------------------------------
 void genMergedSynapseStruct(const BackendBase &backend, CodeStream &definitionsInternal,
                             CodeStream &definitionsInternalFunc, CodeStream &runnerVarAlloc,
                             MergedEGPMap &mergedEGPs, const SynapseGroupMerged &m,
-                            const std::string &precision, const std::string &timePrecision, const std::string &name, MergedSynapseStruct role)
+                            const std::string &precision, const std::string &timePrecision, const std::string &name,
+                            MergedSynapseStruct role, unsigned int batchSize)
 {
     const bool updateRole = ((role == MergedSynapseStruct::PresynapticUpdate)
                              || (role == MergedSynapseStruct::PostsynapticUpdate)
@@ -363,7 +447,11 @@ void genMergedSynapseStruct(const BackendBase &backend, CodeStream &definitionsI
     // If this role is one where postsynaptic input can be provided
     if(role == MergedSynapseStruct::PresynapticUpdate || role == MergedSynapseStruct::SynapseDynamics) {
         if(m.getArchetype().isDendriticDelayRequired()) {
-            gen.addPSPointerField(precision, "denDelay", backend.getArrayPrefix() + "denDelay");
+            gen.addPSPointerField(precision, "denDelay", backend.getArrayPrefix() + "denDelay",
+                                  [](const SynapseGroupInternal &sg, size_t)
+                                  {
+                                      return sg.getMaxDendriticDelayTimesteps() * sg.getTrgNeuronGroup()->getNumNeurons();
+                                  });
             gen.addField("volatile unsigned int*", "denDelayPtr",
                          [&backend](const SynapseGroupInternal &sg, size_t)
                          { 
@@ -371,24 +459,34 @@ void genMergedSynapseStruct(const BackendBase &backend, CodeStream &definitionsI
                          });
         }
         else {
-            gen.addPSPointerField(precision, "inSyn", backend.getArrayPrefix() + "inSyn");
+            gen.addPSPointerField(precision, "inSyn", backend.getArrayPrefix() + "inSyn",
+                                  [](const SynapseGroupInternal &sg, size_t){ return sg.getTrgNeuronGroup()->getNumNeurons(); });
         }
     }
 
     if(role == MergedSynapseStruct::PresynapticUpdate) {
         if(m.getArchetype().isTrueSpikeRequired()) {
-            gen.addSrcPointerField("unsigned int", "srcSpkCnt", backend.getArrayPrefix() + "glbSpkCnt");
-            gen.addSrcPointerField("unsigned int", "srcSpk", backend.getArrayPrefix() + "glbSpk");
+            gen.addSrcPointerField("unsigned int", "srcSpkCnt", backend.getArrayPrefix() + "glbSpkCnt",
+                                   [](const SynapseGroupInternal &sg, size_t){ return getNumSpikeCounts(*sg.getSrcNeuronGroup()); });
+            gen.addSrcPointerField("unsigned int", "srcSpk", backend.getArrayPrefix() + "glbSpk",
+                                   [](const SynapseGroupInternal &sg, size_t){ return getNumSpikes(*sg.getSrcNeuronGroup()); });
         }
 
         if(m.getArchetype().isSpikeEventRequired()) {
-            gen.addSrcPointerField("unsigned int", "srcSpkCntEvnt", backend.getArrayPrefix() + "glbSpkCntEvnt");
-            gen.addSrcPointerField("unsigned int", "srcSpkEvnt", backend.getArrayPrefix() + "glbSpkEvnt");
+            gen.addSrcPointerField("unsigned int", "srcSpkCntEvnt", backend.getArrayPrefix() + "glbSpkCntEvnt",
+                                   [](const SynapseGroupInternal &sg, size_t){ return sg.getSrcNeuronGroup()->getNumDelaySlots(); });
+            gen.addSrcPointerField("unsigned int", "srcSpkEvnt", backend.getArrayPrefix() + "glbSpkEvnt",
+                                   [](const SynapseGroupInternal &sg, size_t)
+                                   {
+                                       return sg.getSrcNeuronGroup()->getNumNeurons() * sg.getSrcNeuronGroup()->getNumDelaySlots();
+                                   });
         }
     }
     else if(role == MergedSynapseStruct::PostsynapticUpdate) {
-        gen.addTrgPointerField("unsigned int", "trgSpkCnt", backend.getArrayPrefix() + "glbSpkCnt");
-        gen.addTrgPointerField("unsigned int", "trgSpk", backend.getArrayPrefix() + "glbSpk");
+        gen.addTrgPointerField("unsigned int", "trgSpkCnt", backend.getArrayPrefix() + "glbSpkCnt",
+                               [](const SynapseGroupInternal &sg, size_t){ return getNumSpikeCounts(*sg.getTrgNeuronGroup()); });
+        gen.addTrgPointerField("unsigned int", "trgSpk", backend.getArrayPrefix() + "glbSpk",
+                               [](const SynapseGroupInternal &sg, size_t){ return getNumSpikes(*sg.getTrgNeuronGroup()); });
     }
 
     // If this structure is used for updating rather than initializing
@@ -421,7 +519,8 @@ void genMergedSynapseStruct(const BackendBase &backend, CodeStream &definitionsI
         for(const auto &v : preVars) {
             // If variable is referenced in code string, add source pointer
             if(code.find("$(" + v.name + "_pre)") != std::string::npos) {
-                gen.addSrcPointerField(v.type, v.name + "Pre", backend.getArrayPrefix() + v.name);
+                gen.addSrcPointerField(v.type, v.name + "Pre", backend.getArrayPrefix() + v.name,
+                                       [v](const SynapseGroupInternal &sg, size_t){ return getNeuronVarSize(*sg.getSrcNeuronGroup(), v.name); });
             }
         }
 
@@ -430,7 +529,24 @@ void genMergedSynapseStruct(const BackendBase &backend, CodeStream &definitionsI
         for(const auto &v : postVars) {
             // If variable is referenced in code string, add target pointer
             if(code.find("$(" + v.name + "_post)") != std::string::npos) {
-                gen.addTrgPointerField(v.type, v.name + "Post", backend.getArrayPrefix() + v.name);
+                gen.addTrgPointerField(v.type, v.name + "Post", backend.getArrayPrefix() + v.name,
+                                       [v](const SynapseGroupInternal &sg, size_t){ return getNeuronVarSize(*sg.getTrgNeuronGroup(), v.name); });
+            }
+        }
+
+        // Add dynamic parameters of pre and postsynaptic neuron models if they are referenced in code string
+        // **NOTE** presynaptic parameters may also be referenced in event threshold condition
+        const std::string preCode = (role == MergedSynapseStruct::PresynapticUpdate) ? (code + wum->getEventThresholdConditionCode()) : code;
+        const auto preParamNames = m.getArchetype().getSrcNeuronGroup()->getNeuronModel()->getParamNames();
+        for(size_t i = 0; i < preParamNames.size(); i++) {
+            if(m.getArchetype().getSrcNeuronGroup()->isParamDynamic(i) && preCode.find("$(" + preParamNames[i] + "_pre)") != std::string::npos) {
+                gen.addSrcDynamicParamField(preParamNames[i]);
+            }
+        }
+        const auto postParamNames = m.getArchetype().getTrgNeuronGroup()->getNeuronModel()->getParamNames();
+        for(size_t i = 0; i < postParamNames.size(); i++) {
+            if(m.getArchetype().getTrgNeuronGroup()->isParamDynamic(i) && code.find("$(" + postParamNames[i] + "_post)") != std::string::npos) {
+                gen.addTrgDynamicParamField(postParamNames[i]);
             }
         }
 
@@ -452,18 +568,29 @@ void genMergedSynapseStruct(const BackendBase &backend, CodeStream &definitionsI
 
         // Add spike times if required
         if(wum->isPreSpikeTimeRequired()) {
-            gen.addSrcPointerField(timePrecision, "sTPre", backend.getArrayPrefix() + "sT");
+            gen.addSrcPointerField(timePrecision, "sTPre", backend.getArrayPrefix() + "sT",
+                                   [](const SynapseGroupInternal &sg, size_t)
+                                   {
+                                       return sg.getSrcNeuronGroup()->getNumNeurons() * sg.getSrcNeuronGroup()->getNumDelaySlots();
+                                   });
         }
         if(wum->isPostSpikeTimeRequired()) {
-            gen.addTrgPointerField(timePrecision, "sTPost", backend.getArrayPrefix() + "sT");
+            gen.addTrgPointerField(timePrecision, "sTPost", backend.getArrayPrefix() + "sT",
+                                   [](const SynapseGroupInternal &sg, size_t)
+                                   {
+                                       return sg.getTrgNeuronGroup()->getNumNeurons() * sg.getTrgNeuronGroup()->getNumDelaySlots();
+                                   });
         }
 
         // Add pre and postsynaptic variables to struct
-        gen.addVars(wum->getPreVars(), backend.getArrayPrefix());
-        gen.addVars(wum->getPostVars(), backend.getArrayPrefix());
+        gen.addBatchedVars(wum->getPreVars(), backend.getArrayPrefix(),
+                           [](const SynapseGroupInternal &sg, size_t){ return getSynapsePreVarSize(sg); });
+        gen.addBatchedVars(wum->getPostVars(), backend.getArrayPrefix(),
+                           [](const SynapseGroupInternal &sg, size_t){ return getSynapsePostVarSize(sg); });
 
-        // Add EGPs to struct
+        // Add EGPs and dynamic parameters to struct
         gen.addEGPs(wum->getExtraGlobalParams());
+        gen.addDynamicParams(wum->getParamNames(), m.getArchetype().getWUDynamicParams());
     }
 
     // Add pointers to connectivity data
@@ -476,7 +603,7 @@ void genMergedSynapseStruct(const BackendBase &backend, CodeStream &definitionsI
            && (role == MergedSynapseStruct::PostsynapticUpdate || role == MergedSynapseStruct::SparseInit))
         {
             gen.addPointerField("unsigned int", "colLength", backend.getArrayPrefix() + "colLength");
-            gen.addPointerField("unsigned int", "remap", backend.getArrayPrefix() + "remap");
+            gen.addPointerField(backend.getSynapseIndexType(m.getArchetype()), "remap", backend.getArrayPrefix() + "remap");
         }
 
         // Add additional structure for synapse dynamics access
@@ -485,6 +612,44 @@ void genMergedSynapseStruct(const BackendBase &backend, CodeStream &definitionsI
         {
             gen.addPointerField("unsigned int", "synRemap", backend.getArrayPrefix() + "synRemap");
         }
+
+        // Add additional structure for accessing rows in postsynaptic order
+        if(backend.isRowRemapRequired(m.getArchetype())
+           && (role == MergedSynapseStruct::PresynapticUpdate || role == MergedSynapseStruct::SynapseDynamics
+               || role == MergedSynapseStruct::SparseInit))
+        {
+            gen.addPointerField("unsigned int", "rowRemap", backend.getArrayPrefix() + "rowRemap");
+        }
+
+        // Add additional structure for accessing synapses stored in the sliced layout
+        if(backend.isSparseLayoutSliced(m.getArchetype())
+           && (role == MergedSynapseStruct::PresynapticUpdate || role == MergedSynapseStruct::SynapseDynamics
+               || role == MergedSynapseStruct::SparseInit))
+        {
+            gen.addPointerField("unsigned int", "slicedRowOrder", backend.getArrayPrefix() + "slicedRowOrder");
+            gen.addPointerField(backend.getSynapseIndexType(m.getArchetype()), "slicedRowStart", backend.getArrayPrefix() + "slicedRowStart");
+            gen.addPointerField("unsigned int", "slicedRowStride", backend.getArrayPrefix() + "slicedRowStride");
+        }
+
+        // Add additional structure for accessing the synapses of each row within each tile of the tiled layout
+        if(backend.getSparseLayoutTileSize(m.getArchetype()) != 0
+           && (role == MergedSynapseStruct::PresynapticUpdate || role == MergedSynapseStruct::SynapseDynamics
+               || role == MergedSynapseStruct::SparseInit))
+        {
+            gen.addPointerField(backend.getSynapseIndexType(m.getArchetype()), "tileRowPtr", backend.getArrayPrefix() + "tileRowPtr");
+        }
+    }
+    else if(m.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+        gen.addPointerField(backend.getSynapseIndexType(m.getArchetype()), "rowPtr", backend.getArrayPrefix() + "rowPtr");
+        gen.addPointerField(m.getArchetype().getSparseIndType(),"ind", backend.getArrayPrefix() + "ind");
+
+        // Add additional structure for postsynaptic access
+        if(backend.isPostsynapticRemapRequired() && !wum->getLearnPostCode().empty()
+           && (role == MergedSynapseStruct::PostsynapticUpdate || role == MergedSynapseStruct::SparseInit))
+        {
+            gen.addPointerField(backend.getSynapseIndexType(m.getArchetype()), "colPtr", backend.getArrayPrefix() + "colPtr");
+            gen.addPointerField(backend.getSynapseIndexType(m.getArchetype()), "remap", backend.getArrayPrefix() + "remap");
+        }
     }
     else if(m.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
         gen.addPointerField("uint32_t", "gp", backend.getArrayPrefix() + "gp");
@@ -495,11 +660,12 @@ void genMergedSynapseStruct(const BackendBase &backend, CodeStream &definitionsI
 
     // Add pointers to var pointers to struct
     if(m.getArchetype().getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-        gen.addVars(wum->getVars(), backend.getArrayPrefix());
+        gen.addBatchedVars(wum->getVars(), backend.getArrayPrefix(),
+                           [&backend](const SynapseGroupInternal &sg, size_t){ return getSynapseVarSize(backend, sg); });
     }
 
     // Generate structure definitions and instantiation
-    gen.generate(definitionsInternal, definitionsInternalFunc, runnerVarAlloc, mergedEGPs, name);
+    gen.generate(definitionsInternal, definitionsInternalFunc, runnerVarAlloc, mergedEGPs, name, batchSize);
 }
 //--------------------------------------------------------------------------
 bool canPushPullVar(VarLocation loc)
@@ -643,6 +809,381 @@ MemAlloc genVariable(const BackendBase &backend, CodeStream &definitionsVar, Cod
                             type, name, loc, count);
 }
 //-------------------------------------------------------------------------
+void genDynamicParams(const BackendBase &backend, CodeStream &definitionsFunc, CodeStream &definitionsInternal, CodeStream &runner,
+                      CodeStream &dynamicParam, const std::vector<std::string> &paramNames, const std::vector<double> &values,
+                      const std::vector<bool> &dynamic, const std::string &groupName)
+{
+    for(size_t i = 0; i < paramNames.size(); i++) {
+        if(dynamic[i]) {
+            // Generate host variable, initialised to parameter's initial value
+            // **NOTE** this is copied into merged structures alongside scalar extra global parameters
+            const std::string name = paramNames[i] + groupName;
+            definitionsInternal << "EXPORT_VAR scalar " << name << ";" << std::endl;
+            runner << backend.getStateStorageSpecifier() << "scalar " << name << " = " << Utils::writePreciseString(values[i]) << ";" << std::endl;
+
+            // Generate setter
+            definitionsFunc << "EXPORT_FUNC void set" << name << "(scalar value);" << std::endl;
+            dynamicParam << "void set" << name << "(scalar value)";
+            {
+                CodeStream::Scope a(dynamicParam);
+                dynamicParam << name << " = value;" << std::endl;
+            }
+        }
+    }
+}
+//-------------------------------------------------------------------------
+bool isSparseMatrixMappable(const BackendBase &backend, const SynapseGroupInternal &sg)
+{
+    // **NOTE** connectivity built by initialize() would overwrite anything mapped from a file
+    return (backend.isSparseMatrixMappingSupported()
+            && ((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (sg.getMatrixType() & SynapseMatrixConnectivity::CSR))
+            && sg.getConnectivityInitialiser().getSnippet()->getRowBuildCode().empty());
+}
+//-------------------------------------------------------------------------
+void genSparseMatrixFileSupport(CodeStream &os)
+{
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// memory-mapped sparse matrix files" << std::endl;
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "#include <stdexcept>" << std::endl;
+#ifdef _WIN32
+    os << "#ifndef NOMINMAX" << std::endl;
+    os << "#define NOMINMAX" << std::endl;
+    os << "#endif" << std::endl;
+    os << "#include <windows.h>" << std::endl;
+#else
+    os << "#include <fcntl.h>" << std::endl;
+    os << "#include <sys/mman.h>" << std::endl;
+    os << "#include <sys/stat.h>" << std::endl;
+    os << "#include <unistd.h>" << std::endl;
+#endif
+    os << std::endl;
+    os << "namespace";
+    {
+        CodeStream::Scope b(os);
+
+        // **NOTE** layout must match SparseMatrixFileWriter in userproject/include/sparseMatrixFile.h
+        os << "struct SparseMatrixFileHeader";
+        {
+            CodeStream::Scope b(os);
+            os << "char magic[8];" << std::endl;
+            os << "uint32_t version;" << std::endl;
+            os << "uint32_t numArrays;" << std::endl;
+            os << "uint32_t numPre;" << std::endl;
+            os << "uint32_t numPost;" << std::endl;
+            os << "uint64_t reserved;" << std::endl;
+        }
+        os << ";" << std::endl;
+        os << std::endl;
+        os << "struct SparseMatrixFileArray";
+        {
+            CodeStream::Scope b(os);
+            os << "char name[40];" << std::endl;
+            os << "uint32_t elementSize;" << std::endl;
+            os << "uint32_t reserved;" << std::endl;
+            os << "uint64_t count;" << std::endl;
+            os << "uint64_t offset;" << std::endl;
+        }
+        os << ";" << std::endl;
+        os << std::endl;
+        os << "struct MappedSparseMatrixFile";
+        {
+            CodeStream::Scope b(os);
+            os << "char *data;" << std::endl;
+            os << "size_t size;" << std::endl;
+        }
+        os << ";" << std::endl;
+        os << std::endl;
+
+        os << "void unmapSparseMatrixFile(MappedSparseMatrixFile &file)";
+        {
+            CodeStream::Scope b(os);
+#ifdef _WIN32
+            os << "UnmapViewOfFile(file.data);" << std::endl;
+#else
+            os << "munmap(file.data, file.size);" << std::endl;
+#endif
+            os << "file.data = nullptr;" << std::endl;
+            os << "file.size = 0;" << std::endl;
+        }
+        os << std::endl;
+
+        os << "MappedSparseMatrixFile mapSparseMatrixFile(const char *filename, unsigned int numPre, unsigned int numPost)";
+        {
+            CodeStream::Scope b(os);
+
+            // **NOTE** pages are mapped copy-on-write so they are shared with other processes
+            // mapping the same file until a simulation modifies them e.g. through plasticity
+#ifdef _WIN32
+            os << "HANDLE fileHandle = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);" << std::endl;
+            os << "if(fileHandle == INVALID_HANDLE_VALUE)";
+            {
+                CodeStream::Scope b(os);
+                os << "throw std::runtime_error(std::string(\"Cannot open sparse matrix file '\") + filename + \"'\");" << std::endl;
+            }
+            os << "LARGE_INTEGER fileSize;" << std::endl;
+            os << "if(!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(SparseMatrixFileHeader))";
+            {
+                CodeStream::Scope b(os);
+                os << "CloseHandle(fileHandle);" << std::endl;
+                os << "throw std::runtime_error(std::string(\"Sparse matrix file '\") + filename + \"' is too short\");" << std::endl;
+            }
+            os << "HANDLE mappingHandle = CreateFileMappingA(fileHandle, NULL, PAGE_WRITECOPY, 0, 0, NULL);" << std::endl;
+            os << "CloseHandle(fileHandle);" << std::endl;
+            os << "void *data = (mappingHandle == NULL) ? NULL : MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0);" << std::endl;
+            os << "if(mappingHandle != NULL)";
+            {
+                CodeStream::Scope b(os);
+                os << "CloseHandle(mappingHandle);" << std::endl;
+            }
+            os << "if(data == NULL)";
+            {
+                CodeStream::Scope b(os);
+                os << "throw std::runtime_error(std::string(\"Cannot map sparse matrix file '\") + filename + \"'\");" << std::endl;
+            }
+            os << "MappedSparseMatrixFile file{static_cast<char*>(data), (size_t)fileSize.QuadPart};" << std::endl;
+#else
+            os << "const int fd = open(filename, O_RDONLY);" << std::endl;
+            os << "if(fd == -1)";
+            {
+                CodeStream::Scope b(os);
+                os << "throw std::runtime_error(std::string(\"Cannot open sparse matrix file '\") + filename + \"'\");" << std::endl;
+            }
+            os << "struct stat fileStat;" << std::endl;
+            os << "if(fstat(fd, &fileStat) != 0 || fileStat.st_size < (off_t)sizeof(SparseMatrixFileHeader))";
+            {
+                CodeStream::Scope b(os);
+                os << "close(fd);" << std::endl;
+                os << "throw std::runtime_error(std::string(\"Sparse matrix file '\") + filename + \"' is too short\");" << std::endl;
+            }
+            os << "void *data = mmap(nullptr, fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);" << std::endl;
+            os << "close(fd);" << std::endl;
+            os << "if(data == MAP_FAILED)";
+            {
+                CodeStream::Scope b(os);
+                os << "throw std::runtime_error(std::string(\"Cannot map sparse matrix file '\") + filename + \"'\");" << std::endl;
+            }
+            os << "MappedSparseMatrixFile file{static_cast<char*>(data), (size_t)fileStat.st_size};" << std::endl;
+#endif
+            os << std::endl;
+            os << "// Check file was written for a synapse group of this shape" << std::endl;
+            os << "const SparseMatrixFileHeader *header = reinterpret_cast<const SparseMatrixFileHeader*>(file.data);" << std::endl;
+            os << "if(memcmp(header->magic, \"GeNNSPM\", 8) != 0 || header->version != 1 || header->numPre != numPre || header->numPost != numPost" << std::endl;
+            os << "   || header->numArrays > ((file.size - sizeof(SparseMatrixFileHeader)) / sizeof(SparseMatrixFileArray)))";
+            {
+                CodeStream::Scope b(os);
+                os << "unmapSparseMatrixFile(file);" << std::endl;
+                os << "throw std::runtime_error(std::string(\"Sparse matrix file '\") + filename + \"' does not match synapse group\");" << std::endl;
+            }
+            os << "return file;" << std::endl;
+        }
+        os << std::endl;
+
+        os << "template<typename T>" << std::endl;
+        os << "T *getSparseMatrixFileArray(const MappedSparseMatrixFile &file, const char *name, size_t count, bool required)";
+        {
+            CodeStream::Scope b(os);
+            os << "const SparseMatrixFileHeader *header = reinterpret_cast<const SparseMatrixFileHeader*>(file.data);" << std::endl;
+            os << "const SparseMatrixFileArray *arrays = reinterpret_cast<const SparseMatrixFileArray*>(header + 1);" << std::endl;
+            os << "for(uint32_t a = 0; a < header->numArrays; a++)";
+            {
+                CodeStream::Scope b(os);
+                os << "if(strncmp(arrays[a].name, name, sizeof(arrays[a].name)) == 0)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "// Check array matches the one it replaces and lies, correctly aligned, within file" << std::endl;
+                    os << "if(arrays[a].elementSize != sizeof(T) || arrays[a].count != count || (arrays[a].offset % alignof(T)) != 0" << std::endl;
+                    os << "   || arrays[a].offset > file.size || (count * sizeof(T)) > (file.size - arrays[a].offset))";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "throw std::runtime_error(std::string(\"Array '\") + name + \"' in sparse matrix file does not match synapse group\");" << std::endl;
+                    }
+                    os << "return reinterpret_cast<T*>(file.data + arrays[a].offset);" << std::endl;
+                }
+            }
+            os << "if(required)";
+            {
+                CodeStream::Scope b(os);
+                os << "throw std::runtime_error(std::string(\"Sparse matrix file does not contain '\") + name + \"' array\");" << std::endl;
+            }
+            os << "return nullptr;" << std::endl;
+        }
+        os << std::endl;
+
+        os << "template<typename T>" << std::endl;
+        os << "void releaseMappedArray(const MappedSparseMatrixFile &file, T *&array)";
+        {
+            CodeStream::Scope b(os);
+            os << "const uintptr_t address = reinterpret_cast<uintptr_t>(array);" << std::endl;
+            os << "if(address >= reinterpret_cast<uintptr_t>(file.data) && address < (reinterpret_cast<uintptr_t>(file.data) + file.size))";
+            {
+                CodeStream::Scope b(os);
+                os << "array = nullptr;" << std::endl;
+            }
+        }
+    }
+    os << std::endl;
+}
+//-------------------------------------------------------------------------
+void genSparseMatrixMap(const BackendBase &backend, CodeStream &definitionsFunc, CodeStream &runnerMapVarDecl,
+                        CodeStream &runnerMapFunc, CodeStream &runnerUnmap, const SynapseGroupInternal &sg, unsigned int batchSize)
+{
+    const std::string &name = sg.getName();
+    const std::string mappedFile = "mappedSparseMatrix" + name;
+    const unsigned int numPre = sg.getSrcNeuronGroup()->getNumNeurons();
+
+    // Arrays which can be attached to file - connectivity is required, uninitialised variables are optional
+    // **NOTE** variables with initialisers would be overwritten by initializeSparse()
+    std::vector<std::tuple<std::string, std::string, size_t, bool, VarLocation>> arrays;
+    if(sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+        arrays.emplace_back("unsigned int", "rowLength", numPre, true, sg.getSparseConnectivityLocation());
+        arrays.emplace_back(sg.getSparseIndType(), "ind", numPre * backend.getSynapticMatrixRowStride(sg), true, sg.getSparseConnectivityLocation());
+    }
+    else {
+        arrays.emplace_back(backend.getSynapseIndexType(sg), "rowPtr", numPre + 1, true, sg.getSparseConnectivityLocation());
+        arrays.emplace_back(sg.getSparseIndType(), "ind", sg.getMaxSynapses(), true, sg.getSparseConnectivityLocation());
+    }
+    if(sg.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+        const auto vars = sg.getWUModel()->getVars();
+        for(size_t i = 0; i < vars.size(); i++) {
+            if(sg.getWUVarInitialisers()[i].getSnippet()->getCode().empty()) {
+                arrays.emplace_back(vars[i].type, vars[i].name, getSynapseVarSize(backend, sg) * batchSize, false, sg.getWUVarLocation(i));
+            }
+        }
+    }
+
+    // Declare structure to hold mapping
+    runnerMapVarDecl << backend.getStateStorageSpecifier() << "MappedSparseMatrixFile " << mappedFile << " = {nullptr, 0};" << std::endl;
+
+    definitionsFunc << "EXPORT_FUNC void map" << name << "Connectivity(const char *filename);" << std::endl;
+    runnerMapFunc << "void map" << name << "Connectivity(const char *filename)";
+    {
+        CodeStream::Scope b(runnerMapFunc);
+        runnerMapFunc << "if(" << mappedFile << ".data != nullptr)";
+        {
+            CodeStream::Scope b(runnerMapFunc);
+            runnerMapFunc << "throw std::runtime_error(\"Synapse group '" << name << "' is already mapped to a file\");" << std::endl;
+        }
+        runnerMapFunc << "MappedSparseMatrixFile file = mapSparseMatrixFile(filename, " << numPre << ", " << sg.getTrgNeuronGroup()->getNumNeurons() << ");" << std::endl;
+
+        // Find all arrays in file before replacing any so failure leaves group untouched
+        for(const auto &a : arrays) {
+            runnerMapFunc << std::get<0>(a) << " *mapped" << std::get<1>(a) << ";" << std::endl;
+        }
+        runnerMapFunc << "try";
+        {
+            CodeStream::Scope b(runnerMapFunc);
+            for(const auto &a : arrays) {
+                runnerMapFunc << "mapped" << std::get<1>(a) << " = getSparseMatrixFileArray<" << std::get<0>(a) << ">(file, \"" << std::get<1>(a) << "\", ";
+                runnerMapFunc << std::get<2>(a) << ", " << (std::get<3>(a) ? "true" : "false") << ");" << std::endl;
+            }
+        }
+        runnerMapFunc << "catch(...)";
+        {
+            CodeStream::Scope b(runnerMapFunc);
+            runnerMapFunc << "unmapSparseMatrixFile(file);" << std::endl;
+            runnerMapFunc << "throw;" << std::endl;
+        }
+
+        // Free host arrays and point at file instead
+        for(const auto &a : arrays) {
+            const std::string arrayName = std::get<1>(a) + name;
+            if(std::get<3>(a)) {
+                backend.genVariableFree(runnerMapFunc, arrayName, std::get<4>(a));
+                runnerMapFunc << arrayName << " = mapped" << std::get<1>(a) << ";" << std::endl;
+            }
+            else {
+                runnerMapFunc << "if(mapped" << std::get<1>(a) << " != nullptr)";
+                {
+                    CodeStream::Scope b(runnerMapFunc);
+                    backend.genVariableFree(runnerMapFunc, arrayName, std::get<4>(a));
+                    runnerMapFunc << arrayName << " = mapped" << std::get<1>(a) << ";" << std::endl;
+                }
+            }
+        }
+        runnerMapFunc << mappedFile << " = file;" << std::endl;
+
+        // Rebuild merged structures so they point at mapped arrays
+        runnerMapFunc << "pushMergedGroupsToDevice();" << std::endl;
+    }
+    runnerMapFunc << std::endl;
+
+    // Before freeMem frees arrays, clear pointers to any which are mapped and unmap file
+    runnerUnmap << "if(" << mappedFile << ".data != nullptr)";
+    {
+        CodeStream::Scope b(runnerUnmap);
+        for(const auto &a : arrays) {
+            runnerUnmap << "releaseMappedArray(" << mappedFile << ", " << std::get<1>(a) << name << ");" << std::endl;
+        }
+        runnerUnmap << "unmapSparseMatrixFile(" << mappedFile << ");" << std::endl;
+    }
+}
+//-------------------------------------------------------------------------
+void genRecordingBufferFree(const BackendBase &backend, CodeStream &os, const ModelSpecInternal &model)
+{
+    os << "if(numRecordingTimesteps > 0)";
+    {
+        CodeStream::Scope b(os);
+        for(const auto &n : model.getNeuronGroups()) {
+            if(n.second.isSpikeRecordingEnabled()) {
+                backend.genVariableFree(os, "recordSpk" + n.first, VarLocation::HOST_DEVICE);
+                os << "recordSpk" << n.first << " = nullptr;" << std::endl;
+            }
+        }
+        os << "numRecordingTimesteps = 0;" << std::endl;
+    }
+}
+//-------------------------------------------------------------------------
+void genRecordingBufferFunctions(const BackendBase &backend, CodeStream &os, const ModelSpecInternal &model)
+{
+    const unsigned int batchSize = model.getBatchSize();
+
+    // Function to (re)allocate recording buffers for a number of timesteps
+    // **NOTE** words for each timestep are laid out by batch and then neuron, with bit (id % 32) of word (id / 32) set if neuron id spiked
+    os << "void allocateRecordingBuffers(unsigned int timesteps)";
+    {
+        CodeStream::Scope b(os);
+        os << "if(timesteps == 0)";
+        {
+            CodeStream::Scope b(os);
+            os << "throw std::runtime_error(\"Recording buffers must be allocated for at least one timestep\");" << std::endl;
+        }
+
+        // Free any existing recording buffers
+        genRecordingBufferFree(backend, os, model);
+
+        for(const auto &n : model.getNeuronGroups()) {
+            if(n.second.isSpikeRecordingEnabled()) {
+                CodeStream::Scope b(os);
+                os << "const size_t count = (size_t)timesteps * " << ((n.second.getNumNeurons() + 31) / 32) * batchSize << ";" << std::endl;
+                backend.genExtraGlobalParamAllocation(os, "uint32_t*", "recordSpk" + n.first, VarLocation::HOST_DEVICE);
+            }
+        }
+
+        os << "numRecordingTimesteps = timesteps;" << std::endl;
+
+        // Rebuild merged structures so they point at new recording buffers
+        os << "pushMergedGroupsToDevice();" << std::endl;
+    }
+    os << std::endl;
+
+    // Function to copy recording buffers from device
+    os << "void pullRecordingBuffersFromDevice()";
+    {
+        CodeStream::Scope b(os);
+        if(!backend.isAutomaticCopyEnabled()) {
+            for(const auto &n : model.getNeuronGroups()) {
+                if(n.second.isSpikeRecordingEnabled()) {
+                    CodeStream::Scope b(os);
+                    os << "const size_t count = (size_t)numRecordingTimesteps * " << ((n.second.getNumNeurons() + 31) / 32) * batchSize << ";" << std::endl;
+                    backend.genExtraGlobalParamPull(os, "uint32_t*", "recordSpk" + n.first, VarLocation::HOST_DEVICE);
+                }
+            }
+        }
+    }
+    os << std::endl;
+}
+//-------------------------------------------------------------------------
 void genExtraGlobalParam(const BackendBase &backend, CodeStream &definitionsVar, CodeStream &definitionsFunc,
                          CodeStream &definitionsInternal, CodeStream &runner, CodeStream &extraGlobalParam,
                          MergedEGPMap &mergedEGPs, const std::string &type, const std::string &name, VarLocation loc)
@@ -720,6 +1261,10 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     definitions << "#pragma once" << std::endl;
 
 #ifdef _WIN32
+    // **NOTE** MSVC does not allow thread-local variables to be imported or exported from DLLs
+    if(!backend.getStateStorageSpecifier().empty()) {
+        throw std::runtime_error("Re-entrant models are not supported on Windows");
+    }
     definitions << "#ifdef BUILDING_GENERATED_CODE" << std::endl;
     definitions << "#define EXPORT_VAR __declspec(dllexport) extern" << std::endl;
     definitions << "#define EXPORT_FUNC __declspec(dllexport)" << std::endl;
@@ -728,7 +1273,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     definitions << "#define EXPORT_FUNC __declspec(dllimport)" << std::endl;
     definitions << "#endif" << std::endl;
 #else
-    definitions << "#define EXPORT_VAR extern" << std::endl;
+    definitions << "#define EXPORT_VAR extern " << backend.getStateStorageSpecifier() << std::endl;
     definitions << "#define EXPORT_FUNC" << std::endl;
 #endif
     backend.genDefinitionsPreamble(definitions, modelMerged);
@@ -774,6 +1319,9 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     std::stringstream runnerPullFuncStream;
     std::stringstream runnerGetterFuncStream;
     std::stringstream runnerStepTimeFinaliseStream;
+    std::stringstream runnerMapVarDeclStream;
+    std::stringstream runnerMapFuncStream;
+    std::stringstream runnerUnmapStream;
     std::stringstream definitionsVarStream;
     std::stringstream definitionsFuncStream;
     std::stringstream definitionsInternalVarStream;
@@ -787,6 +1335,9 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     CodeStream runnerPullFunc(runnerPullFuncStream);
     CodeStream runnerGetterFunc(runnerGetterFuncStream);
     CodeStream runnerStepTimeFinalise(runnerStepTimeFinaliseStream);
+    CodeStream runnerMapVarDecl(runnerMapVarDeclStream);
+    CodeStream runnerMapFunc(runnerMapFuncStream);
+    CodeStream runnerUnmap(runnerUnmapStream);
     CodeStream definitionsVar(definitionsVarStream);
     CodeStream definitionsFunc(definitionsFuncStream);
     CodeStream definitionsInternalVar(definitionsInternalVarStream);
@@ -807,8 +1358,21 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     // Define and declare time variables
     definitionsVar << "EXPORT_VAR unsigned long long iT;" << std::endl;
     definitionsVar << "EXPORT_VAR " << model.getTimePrecision() << " t;" << std::endl;
-    runnerVarDecl << "unsigned long long iT;" << std::endl;
-    runnerVarDecl << model.getTimePrecision() << " t;" << std::endl;
+    runnerVarDecl << backend.getStateStorageSpecifier() << "unsigned long long iT;" << std::endl;
+    runnerVarDecl << backend.getStateStorageSpecifier() << model.getTimePrecision() << " t;" << std::endl;
+
+    // If model state has a storage specifier, define flag to track whether it has been allocated in this storage
+    // **NOTE** this means that, in re-entrant models, use from a thread which didn't call allocateMem() can be detected
+    const bool trackInstanceAllocation = !backend.getStateStorageSpecifier().empty();
+    if(trackInstanceAllocation) {
+        runnerVarDecl << backend.getStateStorageSpecifier() << "bool instanceAllocated = false;" << std::endl;
+    }
+
+    // If recording is in use, define and declare number of timesteps recording buffers are allocated for
+    if(model.isRecordingInUse()) {
+        definitionsVar << "EXPORT_VAR unsigned int numRecordingTimesteps;" << std::endl;
+        runnerVarDecl << backend.getStateStorageSpecifier() << "unsigned int numRecordingTimesteps = 0;" << std::endl;
+    }
 
     // If backend requires a global RNG to simulate (or initialize) this model
     if(backend.isGlobalRNGRequired(modelMerged)) {
@@ -881,14 +1445,14 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     // Generate merged neuron initialisation groups
     for(const auto &m : modelMerged.getMergedNeuronInitGroups()) {
         genMergedNeuronStruct(backend, definitionsInternal, definitionsInternalFunc, runnerMergedStructAlloc,
-                              mergedEGPs, m, model.getPrecision(), model.getTimePrecision(), true);
+                              mergedEGPs, m, model.getPrecision(), model.getTimePrecision(), model.getBatchSize(), true);
     }
 
     // Loop through merged dense synapse init groups
     for(const auto &m : modelMerged.getMergedSynapseDenseInitGroups()) {
          genMergedSynapseStruct(backend, definitionsInternal, definitionsInternalFunc, runnerMergedStructAlloc,
                                 mergedEGPs, m, model.getPrecision(), model.getTimePrecision(),
-                                "SynapseDenseInit", MergedSynapseStruct::DenseInit);
+                                "SynapseDenseInit", MergedSynapseStruct::DenseInit, model.getBatchSize());
     }
 
     // Loop through merged synapse connectivity initialisation groups
@@ -906,6 +1470,12 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
             gen.addPointerField("unsigned int", "rowLength", backend.getArrayPrefix() + "rowLength");
             gen.addPointerField(m.getArchetype().getSparseIndType(), "ind", backend.getArrayPrefix() + "ind");
         }
+        else if(m.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+            gen.addField(backend.getSynapseIndexType(m.getArchetype()), "maxSynapses",
+                         [](const SynapseGroupInternal &sg, size_t){ return std::to_string(sg.getMaxSynapses()); });
+            gen.addPointerField(backend.getSynapseIndexType(m.getArchetype()), "rowPtr", backend.getArrayPrefix() + "rowPtr");
+            gen.addPointerField(m.getArchetype().getSparseIndType(), "ind", backend.getArrayPrefix() + "ind");
+        }
         else if(m.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
             gen.addPointerField("uint32_t", "gp", backend.getArrayPrefix() + "gp");
         }
@@ -921,34 +1491,34 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     for(const auto &m : modelMerged.getMergedSynapseSparseInitGroups()) {
          genMergedSynapseStruct(backend, definitionsInternal, definitionsInternalFunc, runnerMergedStructAlloc,
                                 mergedEGPs, m, model.getPrecision(), model.getTimePrecision(),
-                                "SynapseSparseInit", MergedSynapseStruct::SparseInit);
+                                "SynapseSparseInit", MergedSynapseStruct::SparseInit, model.getBatchSize());
     }
 
     // Loop through merged neuron update groups
     for(const auto &m : modelMerged.getMergedNeuronUpdateGroups()) {
         genMergedNeuronStruct(backend, definitionsInternal, definitionsInternalFunc, runnerMergedStructAlloc,
-                              mergedEGPs, m, model.getPrecision(), model.getTimePrecision(), false);
+                              mergedEGPs, m, model.getPrecision(), model.getTimePrecision(), model.getBatchSize(), false);
     }
 
     // Loop through merged presynaptic update groups
     for(const auto &m : modelMerged.getMergedPresynapticUpdateGroups()) {
         genMergedSynapseStruct(backend, definitionsInternal, definitionsInternalFunc, runnerMergedStructAlloc,
                                mergedEGPs, m, model.getPrecision(), model.getTimePrecision(),
-                               "PresynapticUpdate", MergedSynapseStruct::PresynapticUpdate);
+                               "PresynapticUpdate", MergedSynapseStruct::PresynapticUpdate, model.getBatchSize());
     }
 
     // Loop through merged postsynaptic update groups
     for(const auto &m : modelMerged.getMergedPostsynapticUpdateGroups()) {
         genMergedSynapseStruct(backend, definitionsInternal, definitionsInternalFunc, runnerMergedStructAlloc,
                                mergedEGPs, m, model.getPrecision(), model.getTimePrecision(),
-                               "PostsynapticUpdate", MergedSynapseStruct::PostsynapticUpdate);
+                               "PostsynapticUpdate", MergedSynapseStruct::PostsynapticUpdate, model.getBatchSize());
     }
 
     // Loop through synapse dynamics groups
     for(const auto &m : modelMerged.getMergedSynapseDynamicsGroups()) {
         genMergedSynapseStruct(backend, definitionsInternal, definitionsInternalFunc, runnerMergedStructAlloc,
                                mergedEGPs, m, model.getPrecision(), model.getTimePrecision(),
-                               "SynapseDynamics", MergedSynapseStruct::SynapseDynamics);
+                               "SynapseDynamics", MergedSynapseStruct::SynapseDynamics, model.getBatchSize());
     }
 
     // Loop through neuron groups whose spike queues need resetting
@@ -966,15 +1536,18 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                          });
         }
 
-        gen.addPointerField("unsigned int", "spkCnt", backend.getArrayPrefix() + "glbSpkCnt");
+        gen.addBatchedPointerField("unsigned int", "spkCnt", backend.getArrayPrefix() + "glbSpkCnt",
+                                   [](const NeuronGroupInternal &ng, size_t){ return getNumSpikeCounts(ng); });
 
         if(m.getArchetype().isSpikeEventRequired()) {
-            gen.addPointerField("unsigned int", "spkCntEvnt", backend.getArrayPrefix() + "glbSpkCntEvnt");
+            gen.addBatchedPointerField("unsigned int", "spkCntEvnt", backend.getArrayPrefix() + "glbSpkCntEvnt",
+                                       [](const NeuronGroupInternal &ng, size_t){ return ng.getNumDelaySlots(); });
         }
 
 
         // Generate structure definitions and instantiation
-        gen.generate(definitionsInternal, definitionsInternalFunc, runnerMergedStructAlloc, mergedEGPs, "NeuronSpikeQueueUpdate");
+        gen.generate(definitionsInternal, definitionsInternalFunc, runnerMergedStructAlloc, mergedEGPs, "NeuronSpikeQueueUpdate",
+                     model.getBatchSize());
     }
 
     // Loop through synapse groups whose dendritic delay pointers need updating
@@ -995,6 +1568,8 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     allVarStreams << "// ------------------------------------------------------------------------" << std::endl;
     allVarStreams << "// local neuron groups" << std::endl;
     allVarStreams << "// ------------------------------------------------------------------------" << std::endl;
+    // **NOTE** state, spikes and postsynaptic input are duplicated for each batch instance
+    const size_t batchSize = model.getBatchSize();
     std::vector<std::string> currentSpikePullFunctions;
     std::vector<std::string> currentSpikeEventPullFunctions;
     for(const auto &n : model.getNeuronGroups()) {
@@ -1002,8 +1577,8 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         genSpikeMacros(definitionsVar, n.second, true);
 
         // True spike variables
-        const size_t numSpikeCounts = n.second.isTrueSpikeRequired() ? n.second.getNumDelaySlots() : 1;
-        const size_t numSpikes = n.second.isTrueSpikeRequired() ? n.second.getNumNeurons() * n.second.getNumDelaySlots() : n.second.getNumNeurons();
+        const size_t numSpikeCounts = getNumSpikeCounts(n.second) * batchSize;
+        const size_t numSpikes = getNumSpikes(n.second) * batchSize;
         mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                 "unsigned int", "glbSpkCnt" + n.first, n.second.getSpikeLocation(), numSpikeCounts);
         mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
@@ -1032,18 +1607,27 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         // Current true spike getter functions
         genSpikeGetters(definitionsFunc, runnerGetterFunc, n.second, true);
 
+        // If spike recording is enabled, declare recording buffer
+        // **NOTE** this is allocated by allocateRecordingBuffers once the number of timesteps is known
+        if(n.second.isSpikeRecordingEnabled()) {
+            backend.genExtraGlobalParamDefinition(definitionsVar, "uint32_t*", "recordSpk" + n.first, VarLocation::HOST_DEVICE);
+            backend.genExtraGlobalParamImplementation(runnerVarDecl, "uint32_t*", "recordSpk" + n.first, VarLocation::HOST_DEVICE);
+        }
+
         // If neuron ngroup eeds to emit spike-like events
         if (n.second.isSpikeEventRequired()) {
             // Write convenience macros to access spike-like events
             genSpikeMacros(definitionsVar, n.second, false);
 
             // Spike-like event variables
+            const size_t numSpikeEventCounts = n.second.getNumDelaySlots() * batchSize;
+            const size_t numSpikeEvents = n.second.getNumNeurons() * n.second.getNumDelaySlots() * batchSize;
             mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                     "unsigned int", "glbSpkCntEvnt" + n.first, n.second.getSpikeEventLocation(),
-                                    n.second.getNumDelaySlots());
+                                    numSpikeEventCounts);
             mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                     "unsigned int", "glbSpkEvnt" + n.first, n.second.getSpikeEventLocation(),
-                                    n.second.getNumNeurons() * n.second.getNumDelaySlots());
+                                    numSpikeEvents);
 
             // Spike-like event push and pull functions
             genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getSpikeEventLocation(),
@@ -1051,9 +1635,9 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 [&]()
                 {
                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,
-                                                "unsigned int", "glbSpkCntEvnt" + n.first, n.second.getSpikeLocation(), true, n.second.getNumDelaySlots());
+                                                "unsigned int", "glbSpkCntEvnt" + n.first, n.second.getSpikeLocation(), true, numSpikeEventCounts);
                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,
-                                                "unsigned int", "glbSpkEvnt" + n.first, n.second.getSpikeLocation(), true, n.second.getNumNeurons() * n.second.getNumDelaySlots());
+                                                "unsigned int", "glbSpkEvnt" + n.first, n.second.getSpikeLocation(), true, numSpikeEvents);
                 });
 
             // Current spike-like event push and pull functions
@@ -1076,9 +1660,9 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
 
         // If neuron group needs to record its spike times
         if (n.second.isSpikeTimeRequired()) {
+            const size_t numSpikeTimes = n.second.getNumNeurons() * n.second.getNumDelaySlots() * batchSize;
             mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                    model.getTimePrecision(), "sT" + n.first, n.second.getSpikeTimeLocation(),
-                                    n.second.getNumNeurons() * n.second.getNumDelaySlots());
+                                    model.getTimePrecision(), "sT" + n.first, n.second.getSpikeTimeLocation(), numSpikeTimes);
 
             // Generate push and pull functions
             genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getSpikeTimeLocation(),
@@ -1086,7 +1670,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 [&]()
                 {
                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, model.getTimePrecision(),
-                                                "sT" + n.first, n.second.getSpikeTimeLocation(), true, n.second.getNumNeurons() * n.second.getNumDelaySlots());
+                                                "sT" + n.first, n.second.getSpikeTimeLocation(), true, numSpikeTimes);
                 });
         }
 
@@ -1100,7 +1684,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         const auto vars = neuronModel->getVars();
         std::vector<std::string> neuronStatePushPullFunctions;
         for(size_t i = 0; i < vars.size(); i++) {
-            const size_t count = n.second.isVarQueueRequired(i) ? n.second.getNumNeurons() * n.second.getNumDelaySlots() : n.second.getNumNeurons();
+            const size_t count = getNeuronVarSize(n.second, vars[i].name) * batchSize;
             const bool autoInitialized = !n.second.getVarInitialisers()[i].getSnippet()->getCode().empty();
             mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                runnerPushFunc, runnerPullFunc, vars[i].type, vars[i].name + n.first,
@@ -1141,6 +1725,9 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                                 mergedEGPs, extraGlobalParams[i].type, extraGlobalParams[i].name + n.first, n.second.getExtraGlobalParamLocation(i));
         }
 
+        genDynamicParams(backend, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerExtraGlobalParamFunc,
+                         neuronModel->getParamNames(), n.second.getParams(), n.second.getDynamicParams(), n.first);
+
         if(!n.second.getCurrentSources().empty()) {
             allVarStreams << "// current source variables" << std::endl;
         }
@@ -1153,7 +1740,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 const bool autoInitialized = !cs->getVarInitialisers()[i].getSnippet()->getCode().empty();
                 mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                    runnerPushFunc, runnerPullFunc, csVars[i].type, csVars[i].name + cs->getName(),
-                                   cs->getVarLocation(i), autoInitialized, n.second.getNumNeurons(), currentSourceStatePushPullFunctions);
+                                   cs->getVarLocation(i), autoInitialized, n.second.getNumNeurons() * batchSize, currentSourceStatePushPullFunctions);
             }
 
             // Add helper function to push and pull entire current source state
@@ -1166,6 +1753,9 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 genExtraGlobalParam(backend, definitionsVar, definitionsFunc, definitionsInternalFunc, runnerVarDecl, runnerExtraGlobalParamFunc,
                                     mergedEGPs, csExtraGlobalParams[i].type, csExtraGlobalParams[i].name + cs->getName(), cs->getExtraGlobalParamLocation(i));
             }
+
+            genDynamicParams(backend, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerExtraGlobalParamFunc,
+                             csModel->getParamNames(), cs->getParams(), cs->getDynamicParams(), cs->getName());
         }
     }
     allVarStreams << std::endl;
@@ -1181,12 +1771,12 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
 
             mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                     model.getPrecision(), "inSyn" + sg->getPSModelTargetName(), sg->getInSynLocation(),
-                                    sg->getTrgNeuronGroup()->getNumNeurons());
+                                    sg->getTrgNeuronGroup()->getNumNeurons() * batchSize);
 
             if (sg->isDendriticDelayRequired()) {
                 mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                         model.getPrecision(), "denDelay" + sg->getPSModelTargetName(), sg->getDendriticDelayLocation(),
-                                        sg->getMaxDendriticDelayTimesteps() * sg->getTrgNeuronGroup()->getNumNeurons());
+                                        sg->getMaxDendriticDelayTimesteps() * sg->getTrgNeuronGroup()->getNumNeurons() * batchSize);
                 backend.genScalar(definitionsVar, definitionsInternalVar, runnerVarDecl, "unsigned int", "denDelayPtr" + sg->getPSModelTargetName(), VarLocation::HOST_DEVICE);
             }
 
@@ -1194,7 +1784,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 for(const auto &v : sg->getPSModel()->getVars()) {
                     mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                             v.type, v.name + sg->getPSModelTargetName(), sg->getPSVarLocation(v.name),
-                                            sg->getTrgNeuronGroup()->getNumNeurons());
+                                            sg->getTrgNeuronGroup()->getNumNeurons() * batchSize);
                 }
             }
         }
@@ -1221,7 +1811,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
 
             // Maximum row length constant
             definitionsVar << "EXPORT_VAR const unsigned int maxRowLength" << s.second.getName() << ";" << std::endl;
-            runnerVarDecl << "const unsigned int maxRowLength" << s.second.getName() << " = " << backend.getSynapticMatrixRowStride(s.second) << ";" << std::endl;
+            runnerVarDecl << backend.getStateStorageSpecifier() << "const unsigned int maxRowLength" << s.second.getName() << " = " << backend.getSynapticMatrixRowStride(s.second) << ";" << std::endl;
 
             // Row lengths
             mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
@@ -1239,6 +1829,34 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                                         "unsigned int", "synRemap" + s.second.getName(), VarLocation::DEVICE, size + 1);
             }
 
+            if(backend.isRowRemapRequired(s.second)) {
+                // Allocate rowRemap
+                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        "unsigned int", "rowRemap" + s.second.getName(), VarLocation::DEVICE, size);
+            }
+
+            if(backend.isSparseLayoutSliced(s.second)) {
+                const unsigned int numSrcNeurons = s.second.getSrcNeuronGroup()->getNumNeurons();
+
+                // Allocate order rows are stored in and the start and stride of each row's synapses
+                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        "unsigned int", "slicedRowOrder" + s.second.getName(), VarLocation::DEVICE, numSrcNeurons);
+                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        backend.getSynapseIndexType(s.second), "slicedRowStart" + s.second.getName(), VarLocation::DEVICE, numSrcNeurons);
+                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        "unsigned int", "slicedRowStride" + s.second.getName(), VarLocation::DEVICE, numSrcNeurons);
+            }
+
+            const unsigned int tileSize = backend.getSparseLayoutTileSize(s.second);
+            if(tileSize != 0) {
+                const size_t numSrcNeurons = s.second.getSrcNeuronGroup()->getNumNeurons();
+                const size_t numTiles = ceilDivide(s.second.getTrgNeuronGroup()->getNumNeurons(), tileSize);
+
+                // Allocate pointers to the start of each row within each tile
+                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        backend.getSynapseIndexType(s.second), "tileRowPtr" + s.second.getName(), VarLocation::DEVICE, (numTiles * numSrcNeurons) + 1);
+            }
+
             // **TODO** remap is not always required
             if(backend.isPostsynapticRemapRequired() && !s.second.getWUModel()->getLearnPostCode().empty()) {
                 const size_t postSize = (size_t)s.second.getTrgNeuronGroup()->getNumNeurons() * (size_t)s.second.getMaxSourceConnections();
@@ -1249,7 +1867,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
 
                 // Allocate remap
                 mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                        "unsigned int", "remap" + s.second.getName(), VarLocation::DEVICE, postSize);
+                                        backend.getSynapseIndexType(s.second), "remap" + s.second.getName(), VarLocation::DEVICE, postSize);
             }
 
             // Generate push and pull functions for sparse connectivity
@@ -1266,6 +1884,48 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                                                 "unsigned int", "ind" + s.second.getName(), s.second.getSparseConnectivityLocation(), autoInitialized, size);
                 });
         }
+        else if(s.second.getMatrixType() & SynapseMatrixConnectivity::CSR) {
+            const VarLocation varLoc = s.second.getSparseConnectivityLocation();
+            const size_t size = s.second.getMaxSynapses();
+            const std::string indexType = backend.getSynapseIndexType(s.second);
+
+            // Maximum number of synapses constant
+            definitionsVar << "EXPORT_VAR const " << indexType << " maxSynapses" << s.second.getName() << ";" << std::endl;
+            runnerVarDecl << backend.getStateStorageSpecifier() << "const " << indexType << " maxSynapses" << s.second.getName() << " = " << size << ";" << std::endl;
+
+            // Row pointers
+            mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                    indexType, "rowPtr" + s.second.getName(), varLoc, s.second.getSrcNeuronGroup()->getNumNeurons() + 1);
+
+            // Target indices
+            mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                    s.second.getSparseIndType(), "ind" + s.second.getName(), varLoc, size);
+
+            // **TODO** remap is not always required
+            if(backend.isPostsynapticRemapRequired() && !s.second.getWUModel()->getLearnPostCode().empty()) {
+                // Allocate column pointers
+                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        indexType, "colPtr" + s.second.getName(), VarLocation::DEVICE, s.second.getTrgNeuronGroup()->getNumNeurons() + 1);
+
+                // Allocate remap
+                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        indexType, "remap" + s.second.getName(), VarLocation::DEVICE, size);
+            }
+
+            // Generate push and pull functions for CSR connectivity
+            genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, s.second.getSparseConnectivityLocation(),
+                                backend.isAutomaticCopyEnabled(), s.second.getName() + "Connectivity", connectivityPushPullFunctions,
+                [&]()
+                {
+                    // Row pointers
+                    backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,
+                                                indexType, "rowPtr" + s.second.getName(), s.second.getSparseConnectivityLocation(), autoInitialized, s.second.getSrcNeuronGroup()->getNumNeurons() + 1);
+
+                    // Target indices
+                    backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,
+                                                s.second.getSparseIndType(), "ind" + s.second.getName(), s.second.getSparseConnectivityLocation(), autoInitialized, size);
+                });
+        }
     }
     allVarStreams << std::endl;
 
@@ -1279,7 +1939,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         // If weight update variables should be individual
         std::vector<std::string> synapseGroupStatePushPullFunctions;
         if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-            const size_t size = s.second.getSrcNeuronGroup()->getNumNeurons() * backend.getSynapticMatrixRowStride(s.second);
+            const size_t size = getSynapseVarSize(backend, s.second) * batchSize;
 
             const auto wuVars = wu->getVars();
             for(size_t i = 0; i < wuVars.size(); i++) {
@@ -1291,9 +1951,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         }
 
         // Presynaptic W.U.M. variables
-        const size_t preSize = (s.second.getDelaySteps() == NO_DELAY)
-                ? s.second.getSrcNeuronGroup()->getNumNeurons()
-                : s.second.getSrcNeuronGroup()->getNumNeurons() * s.second.getSrcNeuronGroup()->getNumDelaySlots();
+        const size_t preSize = getSynapsePreVarSize(s.second) * batchSize;
         const auto wuPreVars = wu->getPreVars();
         for(size_t i = 0; i < wuPreVars.size(); i++) {
             const bool autoInitialized = !s.second.getWUPreVarInitialisers()[i].getSnippet()->getCode().empty();
@@ -1303,9 +1961,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         }
 
         // Postsynaptic W.U.M. variables
-        const size_t postSize = (s.second.getBackPropDelaySteps() == NO_DELAY)
-                ? s.second.getTrgNeuronGroup()->getNumNeurons()
-                : s.second.getTrgNeuronGroup()->getNumNeurons() * s.second.getTrgNeuronGroup()->getNumDelaySlots();
+        const size_t postSize = getSynapsePostVarSize(s.second) * batchSize;
         const auto wuPostVars = wu->getPostVars();
         for(size_t i = 0; i < wuPostVars.size(); i++) {
             const bool autoInitialized = !s.second.getWUPostVarInitialisers()[i].getSnippet()->getCode().empty();
@@ -1323,7 +1979,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 [&]()
                 {
                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, model.getPrecision(), "inSyn" + s.second.getName(), s.second.getInSynLocation(),
-                                                true, s.second.getTrgNeuronGroup()->getNumNeurons());
+                                                true, s.second.getTrgNeuronGroup()->getNumNeurons() * batchSize);
                 });
 
             // If this synapse group has individual postsynaptic model variables
@@ -1336,7 +1992,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                         [&]()
                         {
                             backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, psmVars[i].type, psmVars[i].name + s.second.getName(), s.second.getPSVarLocation(i),
-                                                        autoInitialized, s.second.getTrgNeuronGroup()->getNumNeurons());
+                                                        autoInitialized, s.second.getTrgNeuronGroup()->getNumNeurons() * batchSize);
                         });
                 }
             }
@@ -1365,6 +2021,16 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                                 mergedEGPs, sparseConnExtraGlobalParams[i].type, sparseConnExtraGlobalParams[i].name + s.second.getName(),
                                 s.second.getSparseConnectivityExtraGlobalParamLocation(i));
         }
+
+        genDynamicParams(backend, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerExtraGlobalParamFunc,
+                         psm->getParamNames(), s.second.getPSParams(), s.second.getPSDynamicParams(), s.second.getName());
+        genDynamicParams(backend, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerExtraGlobalParamFunc,
+                         wu->getParamNames(), s.second.getWUParams(), s.second.getWUDynamicParams(), s.second.getName());
+
+        // If connectivity is provided by the user, generate function to attach it to a memory-mapped file
+        if(isSparseMatrixMappable(backend, s.second)) {
+            genSparseMatrixMap(backend, definitionsFunc, runnerMapVarDecl, runnerMapFunc, runnerUnmap, s.second, batchSize);
+        }
     }
     allVarStreams << std::endl;
 
@@ -1373,6 +2039,13 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
  
 
     // Write variable declarations to runner
+    // If any synapse groups can be mapped to files, write support code and structures to hold mappings
+    if(!runnerMapFuncStream.str().empty()) {
+        genSparseMatrixFileSupport(runner);
+        runner << runnerMapVarDeclStream.str();
+        runner << std::endl;
+    }
+
     runner << runnerVarDeclStream.str();
 
     // Write extra global parameter functions to runner
@@ -1475,12 +2148,45 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         runner << std::endl;
     }
 
+    // ---------------------------------------------------------------------
+    // Function for building merged structures from the current array pointers and copying them to device
+    // **NOTE** this is called again whenever arrays are replaced e.g. by memory-mapped files
+    runner << "static void pushMergedGroupsToDevice()";
+    {
+        CodeStream::Scope b(runner);
+
+        // Write merged struct allocations to runner
+        runner << runnerMergedStructAllocStream.str();
+    }
+    runner << std::endl;
+
     // ---------------------------------------------------------------------
     // Function for setting the CUDA device and the host's global variables.
     // Also estimates memory usage on device ...
+    // Function to check model state has been allocated by calling thread
+    if(trackInstanceAllocation) {
+        runner << "void checkInstanceAllocated(const char *function)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "if(!instanceAllocated)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "throw std::runtime_error(std::string(function) + \": model state must be allocated by calling allocateMem() from the same thread\");" << std::endl;
+            }
+        }
+        runner << std::endl;
+    }
+
     runner << "void allocateMem()";
     {
         CodeStream::Scope b(runner);
+        if(trackInstanceAllocation) {
+            runner << "if(instanceAllocated)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "throw std::runtime_error(\"allocateMem: model state has already been allocated by this thread\");" << std::endl;
+            }
+        }
 
         // Generate preamble -this is the first bit of generated code called by user simulations
         // so global initialisation is often performed here
@@ -1489,8 +2195,12 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         // Write variable allocations to runner
         runner << runnerVarAllocStream.str();
 
-        // Write merged struct allocations to runner
-        runner << runnerMergedStructAllocStream.str();
+        // Build merged structures
+        runner << "pushMergedGroupsToDevice();" << std::endl;
+
+        if(trackInstanceAllocation) {
+            runner << "instanceAllocated = true;" << std::endl;
+        }
     }
     runner << std::endl;
 
@@ -1499,12 +2209,37 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     runner << "void freeMem()";
     {
         CodeStream::Scope b(runner);
+        if(trackInstanceAllocation) {
+            runner << "checkInstanceAllocated(\"freeMem\");" << std::endl;
+        }
+
+        // Unmap any memory-mapped files so the arrays they replaced aren't freed
+        runner << runnerUnmapStream.str();
 
         // Write variable frees to runner
         runner << runnerVarFreeStream.str();
+
+        // Free recording buffers
+        if(model.isRecordingInUse()) {
+            genRecordingBufferFree(backend, runner, model);
+        }
+
+        if(trackInstanceAllocation) {
+            runner << "instanceAllocated = false;" << std::endl;
+        }
     }
     runner << std::endl;
 
+    // ------------------------------------------------------------------------
+    // Functions to allocate recording buffers and copy them from device
+    if(model.isRecordingInUse()) {
+        genRecordingBufferFunctions(backend, runner, model);
+    }
+
+    // ------------------------------------------------------------------------
+    // Functions to attach synapse groups to memory-mapped files
+    runner << runnerMapFuncStream.str();
+
     // ------------------------------------------------------------------------
     // Function to return amount of free device memory in bytes
     runner << "size_t getFreeDeviceMemBytes()";
@@ -1521,6 +2256,9 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     runner << "void stepTime()";
     {
         CodeStream::Scope b(runner);
+        if(trackInstanceAllocation) {
+            runner << "checkInstanceAllocated(\"stepTime\");" << std::endl;
+        }
 
         // Update synaptic state
         runner << "updateSynapses(t);" << std::endl;
@@ -1533,8 +2271,18 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
             }
         }
 
-        // Update neuronal state
-        runner << "updateNeurons(t);" << std::endl;
+        // Update neuronal state, passing the timestep within the recording buffers to record into
+        if(model.isRecordingInUse()) {
+            runner << "if(numRecordingTimesteps == 0)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "throw std::runtime_error(\"Recording buffers must be allocated with allocateRecordingBuffers before simulating\");" << std::endl;
+            }
+            runner << "updateNeurons(t, (unsigned int)(iT % numRecordingTimesteps));" << std::endl;
+        }
+        else {
+            runner << "updateNeurons(t);" << std::endl;
+        }
 
         // Generate code to advance host side dendritic delay buffers
         for(const auto &n : model.getNeuronGroups()) {
@@ -1575,12 +2323,25 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     definitions << "EXPORT_FUNC void freeMem();" << std::endl;
     definitions << "EXPORT_FUNC size_t getFreeDeviceMemBytes();" << std::endl;
     definitions << "EXPORT_FUNC void stepTime();" << std::endl;
+    if(model.isRecordingInUse()) {
+        definitions << "EXPORT_FUNC void allocateRecordingBuffers(unsigned int timesteps);" << std::endl;
+        definitions << "EXPORT_FUNC void pullRecordingBuffersFromDevice();" << std::endl;
+    }
     definitions << std::endl;
     definitions << "// Functions generated by backend" << std::endl;
-    definitions << "EXPORT_FUNC void updateNeurons(" << model.getTimePrecision() << " t);" << std::endl;
+    if(model.isRecordingInUse()) {
+        definitions << "EXPORT_FUNC void updateNeurons(" << model.getTimePrecision() << " t, unsigned int recordingTimestep);" << std::endl;
+    }
+    else {
+        definitions << "EXPORT_FUNC void updateNeurons(" << model.getTimePrecision() << " t);" << std::endl;
+    }
     definitions << "EXPORT_FUNC void updateSynapses(" << model.getTimePrecision() << " t);" << std::endl;
     definitions << "EXPORT_FUNC void initialize();" << std::endl;
     definitions << "EXPORT_FUNC void initializeSparse();" << std::endl;
+    if(trackInstanceAllocation) {
+        definitionsInternal << "// Throws if model state hasn't been allocated by calling thread" << std::endl;
+        definitionsInternal << "void checkInstanceAllocated(const char *function);" << std::endl;
+    }
 
 #ifdef MPI_ENABLE
     definitions << "// MPI functions" << std::endl;
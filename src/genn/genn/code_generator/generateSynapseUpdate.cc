@@ -7,6 +7,7 @@
 #include "code_generator/codeStream.h"
 #include "code_generator/substitutions.h"
 #include "code_generator/backendBase.h"
+#include "code_generator/expressionParser.h"
 #include "code_generator/groupMerged.h"
 #include "code_generator/modelSpecMerged.h"
 #include "code_generator/teeStream.h"
@@ -25,7 +26,7 @@ void applySynapseSubstitutions(CodeGenerator::CodeStream &os, std::string code,
     CodeGenerator::Substitutions synapseSubs(&baseSubs);
 
     // Substitute parameter and derived parameter names
-    synapseSubs.addParamValueSubstitution(sg.getWUModel()->getParamNames(), sg.getWUParams());
+    synapseSubs.addParamValueSubstitution(sg.getWUModel()->getParamNames(), sg.getWUParams(), sg.getWUDynamicParams());
     synapseSubs.addVarValueSubstitution(wu->getDerivedParams(), sg.getWUDerivedParams());
     synapseSubs.addVarNameSubstitution(wu->getExtraGlobalParams(), "", "group.");
 
@@ -85,6 +86,9 @@ void applySynapseSubstitutions(CodeGenerator::CodeStream &os, std::string code,
     synapseSubs.apply(code);
     //synapseSubs.applyCheckUnreplaced(code, errorContext + " : " + sg.getName());
     code = CodeGenerator::ensureFtype(code, model.getPrecision());
+    if(backend.isConstantFoldingEnabled()) {
+        code = CodeGenerator::ExpressionParser::simplify(code);
+    }
     os << code;
 }
 }   // Anonymous namespace
@@ -93,7 +97,7 @@ void applySynapseSubstitutions(CodeGenerator::CodeStream &os, std::string code,
 // CodeGenerator
 //--------------------------------------------------------------------------
 void CodeGenerator::generateSynapseUpdate(CodeStream &os, const MergedEGPMap &mergedEGPs, const ModelSpecMerged &modelMerged, const BackendBase &backend,
-                                          bool standaloneModules)
+                                          BackendBase::ModuleHandler moduleHandler, bool standaloneModules)
 {
     if(standaloneModules) {
         os << "#include \"runner.cc\"" << std::endl;
@@ -107,9 +111,9 @@ void CodeGenerator::generateSynapseUpdate(CodeStream &os, const MergedEGPMap &me
     // Generate functions to push merged synapse group structures
     const ModelSpecInternal &model = modelMerged.getModel();
     genMergedGroupPush(os, modelMerged.getMergedSynapseDendriticDelayUpdateGroups(), mergedEGPs, "SynapseDendriticDelayUpdate", backend);
-    genMergedGroupPush(os, modelMerged.getMergedPresynapticUpdateGroups(), mergedEGPs, "PresynapticUpdate", backend);
-    genMergedGroupPush(os, modelMerged.getMergedPostsynapticUpdateGroups(), mergedEGPs, "PostsynapticUpdate", backend);
-    genMergedGroupPush(os, modelMerged.getMergedSynapseDynamicsGroups(), mergedEGPs, "SynapseDynamics", backend);
+    genMergedGroupPush(os, modelMerged.getMergedPresynapticUpdateGroups(), mergedEGPs, "PresynapticUpdate", backend, modelMerged.getModel().getBatchSize());
+    genMergedGroupPush(os, modelMerged.getMergedPostsynapticUpdateGroups(), mergedEGPs, "PostsynapticUpdate", backend, modelMerged.getModel().getBatchSize());
+    genMergedGroupPush(os, modelMerged.getMergedSynapseDynamicsGroups(), mergedEGPs, "SynapseDynamics", backend, modelMerged.getModel().getBatchSize());
 
     // Synaptic update kernels
     backend.genSynapseUpdate(os, modelMerged,
@@ -119,7 +123,7 @@ void CodeGenerator::generateSynapseUpdate(CodeStream &os, const MergedEGPMap &me
             Substitutions synapseSubs(&baseSubs);
 
             // Make weight update model substitutions
-            synapseSubs.addParamValueSubstitution(sg.getArchetype().getWUModel()->getParamNames(), sg.getArchetype().getWUParams());
+            synapseSubs.addParamValueSubstitution(sg.getArchetype().getWUModel()->getParamNames(), sg.getArchetype().getWUParams(), sg.getArchetype().getWUDynamicParams());
             synapseSubs.addVarValueSubstitution(sg.getArchetype().getWUModel()->getDerivedParams(), sg.getArchetype().getWUDerivedParams());
             synapseSubs.addVarNameSubstitution(sg.getArchetype().getWUModel()->getExtraGlobalParams(), "", "group.");
 
@@ -208,5 +212,6 @@ void CodeGenerator::generateSynapseUpdate(CodeStream &os, const MergedEGPMap &me
             genScalarEGPPush(os, mergedEGPs, "PresynapticUpdate", backend);
             genScalarEGPPush(os, mergedEGPs, "PostsynapticUpdate", backend);
             genScalarEGPPush(os, mergedEGPs, "SynapseDynamics", backend);
-        });
+        },
+        moduleHandler);
 }
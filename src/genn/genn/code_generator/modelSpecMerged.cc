@@ -1,5 +1,8 @@
 #include "code_generator/modelSpecMerged.h"
 
+// Standard C++ includes
+#include <unordered_map>
+
 // PLOG includes
 #include <plog/Log.h>
 
@@ -14,21 +17,41 @@
 //----------------------------------------------------------------------------
 namespace
 {
-template<typename Group, typename MergedGroup, typename M>
+template<typename Group, typename MergedGroup, typename D, typename M>
 void createMergedGroups(std::vector<std::reference_wrapper<const Group>> &unmergedGroups,
-                        std::vector<MergedGroup> &mergedGroups, M canMerge)
+                        std::vector<MergedGroup> &mergedGroups, D getHashDigest, M canMerge)
 {
+    // Sort groups into buckets based on their hash digests
+    // **NOTE** groups which can be merged always have the same digest so
+    // this avoids comparing every group with every other group
+    std::vector<size_t> unmergedDigests;
+    unmergedDigests.reserve(unmergedGroups.size());
+    std::unordered_map<size_t, std::vector<std::reference_wrapper<const Group>>> buckets;
+    for(const auto &g : unmergedGroups) {
+        unmergedDigests.push_back(getHashDigest(g.get()));
+        buckets[unmergedDigests.back()].push_back(g);
+    }
+
     // Loop through un-merged  groups
     while(!unmergedGroups.empty()) {
-        // Remove last group from vector
+        // Remove last group and it's digest from vectors
         const Group &group = unmergedGroups.back().get();
+        auto &bucket = buckets.at(unmergedDigests.back());
         unmergedGroups.pop_back();
+        unmergedDigests.pop_back();
+
+        // If group has already been merged, it will have been removed from bucket so skip
+        // **NOTE** remaining groups in bucket all come earlier so, otherwise, group will be last
+        if(bucket.empty() || (&bucket.back().get() != &group)) {
+            continue;
+        }
+        bucket.pop_back();
 
         // Start vector of groups that can be merged
         std::vector<std::reference_wrapper<const Group>> mergeTargets{group};
 
-        // Loop through other remaining unmerged groups
-        for(auto otherGroup = unmergedGroups.begin(); otherGroup != unmergedGroups.end();) {
+        // Loop through other remaining unmerged groups with the same digest
+        for(auto otherGroup = bucket.begin(); otherGroup != bucket.end();) {
             // If this 'other' group can be merged with original
             if(canMerge(group, otherGroup->get())) {
                 LOGD << "\tMerging group '" << otherGroup->get().getName() << "' with '" << group.getName() << "'";
@@ -36,8 +59,8 @@ void createMergedGroups(std::vector<std::reference_wrapper<const Group>> &unmerg
                 // Add to list of merge targets
                 mergeTargets.push_back(otherGroup->get());
 
-                // Remove from unmerged list
-                otherGroup = unmergedGroups.erase(otherGroup);
+                // Remove from bucket
+                otherGroup = bucket.erase(otherGroup);
             }
             // Otherwise, advance to next group
             else {
@@ -52,9 +75,9 @@ void createMergedGroups(std::vector<std::reference_wrapper<const Group>> &unmerg
     }
 }
 //----------------------------------------------------------------------------
-template<typename Group, typename MergedGroup, typename F, typename M>
+template<typename Group, typename MergedGroup, typename F, typename D, typename M>
 void createMergedGroups(const std::map<std::string, Group> &groups, std::vector<MergedGroup> &mergedGroups,
-                        F filter, M canMerge)
+                        F filter, D getHashDigest, M canMerge)
 {
     // Build temporary vector of references to groups that pass filter
     std::vector<std::reference_wrapper<const Group>> unmergedGroups;
@@ -65,7 +88,7 @@ void createMergedGroups(const std::map<std::string, Group> &groups, std::vector<
     }
 
     // Merge filtered vector
-    createMergedGroups(unmergedGroups, mergedGroups, canMerge);
+    createMergedGroups(unmergedGroups, mergedGroups, getHashDigest, canMerge);
 }
 }   // Anonymous namespace
 
@@ -77,29 +100,63 @@ CodeGenerator::ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model,
     m_PresynapticUpdateSupportCode("PresynapticUpdateSupportCode"), m_PostsynapticUpdateSupportCode("PostsynapticUpdateSupportCode"),
     m_SynapseDynamicsSupportCode("SynapseDynamicsSupportCode")
 {
+    // Helpers to add whether 64-bit synapse indices are required to synapse group hash digests
+    auto wuDigest =
+        [&backend](const SynapseGroupInternal &sg)
+        {
+            size_t hash = sg.getWUHashDigest();
+            Utils::updateHash(backend.areSixtyFourBitSynapseIndicesRequired(sg), hash);
+            return hash;
+        };
+    auto wuInitDigest =
+        [&backend](const SynapseGroupInternal &sg)
+        {
+            size_t hash = sg.getWUInitHashDigest();
+            Utils::updateHash(backend.areSixtyFourBitSynapseIndicesRequired(sg), hash);
+            return hash;
+        };
+
     LOGD << "Merging neuron update groups:";
     createMergedGroups(model.getNeuronGroups(), m_MergedNeuronUpdateGroups,
                        [](const NeuronGroupInternal &){ return true; },
+                       [](const NeuronGroupInternal &ng){ return ng.getHashDigest(); },
                        [](const NeuronGroupInternal &a, const NeuronGroupInternal &b){ return a.canBeMerged(b); });
 
+    // **NOTE** synapse groups can only be merged if their synapses are indexed using the same type
     LOGD << "Merging presynaptic update groups:";
     createMergedGroups(model.getSynapseGroups(), m_MergedPresynapticUpdateGroups,
                        [](const SynapseGroupInternal &sg){ return (sg.isSpikeEventRequired() || sg.isTrueSpikeRequired()); },
-                       [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canWUBeMerged(b); });
+                       wuDigest,
+                       [&backend](const SynapseGroupInternal &a, const SynapseGroupInternal &b)
+                       {
+                           return (a.canWUBeMerged(b)
+                                   && (backend.areSixtyFourBitSynapseIndicesRequired(a) == backend.areSixtyFourBitSynapseIndicesRequired(b)));
+                       });
 
     LOGD << "Merging postsynaptic update groups:";
     createMergedGroups(model.getSynapseGroups(), m_MergedPostsynapticUpdateGroups,
                        [](const SynapseGroupInternal &sg){ return !sg.getWUModel()->getLearnPostCode().empty(); },
-                       [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canWUBeMerged(b); });
+                       wuDigest,
+                       [&backend](const SynapseGroupInternal &a, const SynapseGroupInternal &b)
+                       {
+                           return (a.canWUBeMerged(b)
+                                   && (backend.areSixtyFourBitSynapseIndicesRequired(a) == backend.areSixtyFourBitSynapseIndicesRequired(b)));
+                       });
 
     LOGD << "Merging synapse dynamics update groups:";
     createMergedGroups(model.getSynapseGroups(), m_MergedSynapseDynamicsGroups,
                        [](const SynapseGroupInternal &sg){ return !sg.getWUModel()->getSynapseDynamicsCode().empty(); },
-                       [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canWUBeMerged(b); });
+                       wuDigest,
+                       [&backend](const SynapseGroupInternal &a, const SynapseGroupInternal &b)
+                       {
+                           return (a.canWUBeMerged(b)
+                                   && (backend.areSixtyFourBitSynapseIndicesRequired(a) == backend.areSixtyFourBitSynapseIndicesRequired(b)));
+                       });
 
     LOGD << "Merging neuron initialization groups:";
     createMergedGroups(model.getNeuronGroups(), m_MergedNeuronInitGroups,
                        [](const NeuronGroupInternal &){ return true; },
+                       [](const NeuronGroupInternal &ng){ return ng.getInitHashDigest(); },
                        [](const NeuronGroupInternal &a, const NeuronGroupInternal &b){ return a.canInitBeMerged(b); });
 
     LOGD << "Merging synapse dense initialization groups:";
@@ -108,27 +165,61 @@ CodeGenerator::ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model,
                        {
                            return ((sg.getMatrixType() & SynapseMatrixConnectivity::DENSE) && sg.isWUVarInitRequired());
                        },
-                       [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canWUInitBeMerged(b); });
+                       wuInitDigest,
+                       [&backend](const SynapseGroupInternal &a, const SynapseGroupInternal &b)
+                       {
+                           return (a.canWUInitBeMerged(b)
+                                   && (backend.areSixtyFourBitSynapseIndicesRequired(a) == backend.areSixtyFourBitSynapseIndicesRequired(b)));
+                       });
 
     LOGD << "Merging synapse connectivity initialisation groups:";
     createMergedGroups(model.getSynapseGroups(), m_MergedSynapseConnectivityInitGroups,
                        [](const SynapseGroupInternal &sg){ return sg.isSparseConnectivityInitRequired(); },
-                       [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canConnectivityInitBeMerged(b); });
+                       [&backend](const SynapseGroupInternal &sg)
+                       {
+                           size_t hash = sg.getConnectivityInitHashDigest();
+                           Utils::updateHash(backend.areSixtyFourBitSynapseIndicesRequired(sg), hash);
+                           return hash;
+                       },
+                       [&backend](const SynapseGroupInternal &a, const SynapseGroupInternal &b)
+                       {
+                           return (a.canConnectivityInitBeMerged(b)
+                                   && (backend.areSixtyFourBitSynapseIndicesRequired(a) == backend.areSixtyFourBitSynapseIndicesRequired(b)));
+                       });
 
     LOGD << "Merging synapse sparse initialization groups:";
     createMergedGroups(model.getSynapseGroups(), m_MergedSynapseSparseInitGroups,
                        [&backend](const SynapseGroupInternal &sg)
                        {
-                           return ((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) && 
+                           return (((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (sg.getMatrixType() & SynapseMatrixConnectivity::CSR)) &&
                                    (sg.isWUVarInitRequired()
                                     || (backend.isSynRemapRequired() && !sg.getWUModel()->getSynapseDynamicsCode().empty())
-                                    || (backend.isPostsynapticRemapRequired() && !sg.getWUModel()->getLearnPostCode().empty())));
+                                    || (backend.isPostsynapticRemapRequired() && !sg.getWUModel()->getLearnPostCode().empty())
+                                    || backend.isRowRemapRequired(sg)
+                                    || backend.isSparseLayoutSliced(sg)
+                                    || backend.getSparseLayoutTileSize(sg) != 0));
                        },
-                       [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canWUInitBeMerged(b); });
+                       wuInitDigest,
+                       [&backend](const SynapseGroupInternal &a, const SynapseGroupInternal &b)
+                       {
+                           return (a.canWUInitBeMerged(b)
+                                   && (backend.areSixtyFourBitSynapseIndicesRequired(a) == backend.areSixtyFourBitSynapseIndicesRequired(b))
+                                   && (backend.isRowRemapRequired(a) == backend.isRowRemapRequired(b))
+                                   && (backend.isSparseLayoutSliced(a) == backend.isSparseLayoutSliced(b))
+                                   && (backend.getSparseLayoutTileSize(a) == backend.getSparseLayoutTileSize(b)));
+                       });
 
     LOGD << "Merging neuron groups which require their spike queues updating:";
     createMergedGroups(model.getNeuronGroups(), m_MergedNeuronSpikeQueueUpdateGroups,
                        [](const NeuronGroupInternal &){ return true; },
+                       [](const NeuronGroupInternal &ng)
+                       {
+                           size_t hash = 0;
+                           Utils::updateHash(ng.getNumDelaySlots(), hash);
+                           Utils::updateHash(ng.isSpikeEventRequired(), hash);
+                           Utils::updateHash(ng.isTrueSpikeRequired(), hash);
+                           return hash;
+                       },
                        [](const NeuronGroupInternal &a, const NeuronGroupInternal &b)
                        {
                            return ((a.getNumDelaySlots() == b.getNumDelaySlots())
@@ -147,6 +238,12 @@ CodeGenerator::ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model,
     }
     LOGD << "Merging synapse groups which require their dendritic delay updating:";
     createMergedGroups(synapseGroupsWithDendriticDelay, m_MergedSynapseDendriticDelayUpdateGroups,
+                       [](const SynapseGroupInternal &sg)
+                       {
+                           size_t hash = 0;
+                           Utils::updateHash(sg.getMaxDendriticDelayTimesteps(), hash);
+                           return hash;
+                       },
                        [](const SynapseGroupInternal &a, const SynapseGroupInternal &b)
                        {
                            return (a.getMaxDendriticDelayTimesteps() == b.getMaxDendriticDelayTimesteps());
@@ -24,6 +24,17 @@ void CurrentSource::setExtraGlobalParamLocation(const std::string &paramName, Va
     m_ExtraGlobalParamLocation[extraGlobalParamIndex] = loc;
 }
 //----------------------------------------------------------------------------
+void CurrentSource::setParamDynamic(const std::string &paramName, bool dynamic)
+{
+    // **NOTE** derived parameters are calculated from the values of parameters at model build time
+    const size_t paramIndex = getCurrentSourceModel()->getParamIndex(paramName);
+    if(dynamic && Utils::isParamUsedByDerivedParams(getCurrentSourceModel(), paramName)) {
+        throw std::runtime_error("setParamDynamic: Parameter '" + paramName + "' is used to calculate derived parameters so cannot be dynamic");
+    }
+
+    m_DynamicParams[paramIndex] = dynamic;
+}
+//----------------------------------------------------------------------------
 VarLocation CurrentSource::getVarLocation(const std::string &varName) const
 {
     return m_VarLocation[getCurrentSourceModel()->getVarIndex(varName)];
@@ -75,7 +86,8 @@ bool CurrentSource::isInitRNGRequired() const
 bool CurrentSource::canBeMerged(const CurrentSource &other) const
 {
     return (getCurrentSourceModel()->canBeMerged(other.getCurrentSourceModel())
-            && (getParams() == other.getParams())
+            && (getDynamicParams() == other.getDynamicParams())
+            && Utils::areNonDynamicParamsEqual(getParams(), other.getParams(), getDynamicParams())
             && (getDerivedParams() == other.getDerivedParams()));
 }
 //----------------------------------------------------------------------------
@@ -96,3 +108,22 @@ bool CurrentSource::canInitBeMerged(const CurrentSource &other) const
         return false;
     }
 }
+//----------------------------------------------------------------------------
+size_t CurrentSource::getHashDigest() const
+{
+    size_t hash = 0;
+    getCurrentSourceModel()->updateHash(hash);
+    Utils::updateHashNonDynamicParams(getParams(), getDynamicParams(), hash);
+    Utils::updateHash(getDerivedParams(), hash);
+    return hash;
+}
+//----------------------------------------------------------------------------
+size_t CurrentSource::getInitHashDigest() const
+{
+    size_t hash = 0;
+    Utils::updateHash(getVarInitialisers().size(), hash);
+    for(const auto &v : getVarInitialisers()) {
+        v.updateHash(hash);
+    }
+    return hash;
+}
@@ -13,3 +13,9 @@ bool CurrentSourceModels::Base::canBeMerged(const Base *other) const
     return (Models::Base::canBeMerged(other)
             && (getInjectionCode() == other->getInjectionCode()));
 }
+//----------------------------------------------------------------------------
+void CurrentSourceModels::Base::updateHash(size_t &hash) const
+{
+    Models::Base::updateHash(hash);
+    Utils::updateHash(getInjectionCode(), hash);
+}
@@ -2,6 +2,7 @@
 
 // Standard C++ includes
 #include <algorithm>
+#include <stdexcept>
 
 // GeNN includes
 #include "models.h"
@@ -68,6 +69,60 @@ bool isRNGRequired(const std::vector<Models::VarInit> &varInitialisers)
                        });
 }
 //--------------------------------------------------------------------------
+bool areNonDynamicParamsEqual(const std::vector<double> &params, const std::vector<double> &otherParams,
+                              const std::vector<bool> &dynamicParams)
+{
+    assert(params.size() == otherParams.size());
+    assert(params.size() == dynamicParams.size());
+
+    for(size_t i = 0; i < params.size(); i++) {
+        if(!dynamicParams[i] && (params[i] != otherParams[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+//--------------------------------------------------------------------------
+void updateHashNonDynamicParams(const std::vector<double> &params, const std::vector<bool> &dynamicParams,
+                                size_t &hash)
+{
+    assert(params.size() == dynamicParams.size());
+
+    updateHash(dynamicParams, hash);
+    for(size_t i = 0; i < params.size(); i++) {
+        if(!dynamicParams[i]) {
+            updateHash(params[i], hash);
+        }
+    }
+}
+//--------------------------------------------------------------------------
+bool isParamUsedByDerivedParams(const Snippet::Base *snippet, const std::string &paramName)
+{
+    const auto paramNames = snippet->getParamNames();
+    bool used = false;
+    for(const auto &d : snippet->getDerivedParams()) {
+        // Check that all the parameters the derived parameter lists exist so a typo can't hide a dependency
+        for(const auto &p : d.paramNames) {
+            if(std::find(paramNames.cbegin(), paramNames.cend(), p) == paramNames.cend()) {
+                throw std::runtime_error("Derived parameter '" + d.name + "' uses unknown parameter '" + p + "'");
+            }
+        }
+
+        // **NOTE** derived parameters which don't list the parameters they use may use any of them
+        if(d.paramNames.empty() || std::find(d.paramNames.cbegin(), d.paramNames.cend(), paramName) != d.paramNames.cend()) {
+            used = true;
+        }
+    }
+    return used;
+}
+//--------------------------------------------------------------------------
+std::string getHexDigest(size_t hash)
+{
+    std::ostringstream digest;
+    digest << std::hex << std::setfill('0') << std::setw(sizeof(size_t) * 2) << hash;
+    return digest.str();
+}
+//--------------------------------------------------------------------------
 bool isTypePointer(const std::string &type)
 {
     return (type.back() == '*');
@@ -18,3 +18,24 @@ bool InitSparseConnectivitySnippet::Base::canBeMerged(const Base *other) const
             && (getRowBuildStateVars() == other->getRowBuildStateVars())
             && (getExtraGlobalParams() == other->getExtraGlobalParams()));
 }
+//----------------------------------------------------------------------------
+void InitSparseConnectivitySnippet::Base::updateHash(size_t &hash) const
+{
+    Snippet::Base::updateHash(hash);
+    Utils::updateHash(getRowBuildCode(), hash);
+
+    const auto rowBuildStateVars = getRowBuildStateVars();
+    Utils::updateHash(rowBuildStateVars.size(), hash);
+    for(const auto &v : rowBuildStateVars) {
+        Utils::updateHash(v.name, hash);
+        Utils::updateHash(v.type, hash);
+        Utils::updateHash(v.value, hash);
+    }
+
+    const auto egps = getExtraGlobalParams();
+    Utils::updateHash(egps.size(), hash);
+    for(const auto &e : egps) {
+        Utils::updateHash(e.name, hash);
+        Utils::updateHash(e.type, hash);
+    }
+}
@@ -18,3 +18,9 @@ bool InitVarSnippet::Base::canBeMerged(const Base *other) const
     return (Snippet::Base::canBeMerged(other)
             && (getCode() == other->getCode()));
 }
+//----------------------------------------------------------------------------
+void InitVarSnippet::Base::updateHash(size_t &hash) const
+{
+    Snippet::Base::updateHash(hash);
+    Utils::updateHash(getCode(), hash);
+}
@@ -34,7 +34,7 @@
 // ------------------------------------------------------------------------
 // class ModelSpec for specifying a neuronal network model
 ModelSpec::ModelSpec()
-:   m_TimePrecision(TimePrecision::DEFAULT), m_DT(0.5), m_TimingEnabled(false), m_Seed(0),
+:   m_TimePrecision(TimePrecision::DEFAULT), m_DT(0.5), m_TimingEnabled(false), m_Seed(0), m_BatchSize(1),
     m_DefaultVarLocation(VarLocation::HOST_DEVICE), m_DefaultExtraGlobalParamLocation(VarLocation::HOST_DEVICE),
     m_DefaultSparseConnectivityLocation(VarLocation::HOST_DEVICE), m_DefaultNarrowSparseIndEnabled(false),
     m_ShouldMergePostsynapticModels(false)
@@ -122,6 +122,14 @@ void ModelSpec::setPrecision(FloatType floattype /**<  */)
     }
 }
 
+void ModelSpec::setBatchSize(unsigned int batchSize)
+{
+    if(batchSize == 0) {
+        throw std::runtime_error("Batch size must be at least one");
+    }
+    m_BatchSize = batchSize;
+}
+
 
 void ModelSpec::finalize()
 {
@@ -193,6 +201,14 @@ void ModelSpec::finalize()
                 thresholdSubs.addVarValueSubstitution(wu->getDerivedParams(), sg->getWUDerivedParams());
                 
                 std::string eCode = wu->getEventThresholdConditionCode();
+
+                // **NOTE** event threshold conditions are evaluated within the neuron update so can't use dynamic parameters
+                const auto wuParamNames = wu->getParamNames();
+                for(size_t i = 0; i < wuParamNames.size(); i++) {
+                    if(sg->isWUParamDynamic(i) && eCode.find("$(" + wuParamNames[i] + ")") != std::string::npos) {
+                        throw std::runtime_error("Synapse group '" + sg->getName() + "' cannot use dynamic parameter '" + wuParamNames[i] + "' in event threshold condition code");
+                    }
+                }
                 thresholdSubs.apply(eCode);
 
                 // Add code and name of support code namespace to set	
@@ -241,6 +257,12 @@ bool ModelSpec::zeroCopyInUse() const
 
     return false;
 }
+// ---------------------------------------------------------------------------
+bool ModelSpec::isRecordingInUse() const
+{
+    return std::any_of(m_LocalNeuronGroups.cbegin(), m_LocalNeuronGroups.cend(),
+                       [](const NeuronGroupValueType &n) { return n.second.isSpikeRecordingEnabled(); });
+}
 
 NeuronGroupInternal *ModelSpec::findNeuronGroupInternal(const std::string &name)
 {
@@ -44,6 +44,19 @@ bool checkCompatibleUnordered(const std::vector<T> &ours, std::vector<T> &others
         return false;
     }
 }
+//----------------------------------------------------------------------------
+template<typename C, typename D>
+void updateHashUnordered(const C &groups, size_t &hash, D getHashDigest)
+{
+    // **NOTE** checkCompatibleUnordered allows groups to be reshuffled so
+    // digests are combined by summing them, which is independent of order
+    size_t sum = 0;
+    for(const auto &g : groups) {
+        sum += getHashDigest(g);
+    }
+    Utils::updateHash(groups.size(), hash);
+    Utils::updateHash(sum, hash);
+}
 }   // Anonymous namespace
 
 // ------------------------------------------------------------------------
@@ -63,6 +76,17 @@ void NeuronGroup::setExtraGlobalParamLocation(const std::string &paramName, VarL
     m_ExtraGlobalParamLocation[extraGlobalParamIndex] = loc;
 }
 //----------------------------------------------------------------------------
+void NeuronGroup::setParamDynamic(const std::string &paramName, bool dynamic)
+{
+    // **NOTE** derived parameters are calculated from the values of parameters at model build time
+    const size_t paramIndex = getNeuronModel()->getParamIndex(paramName);
+    if(dynamic && Utils::isParamUsedByDerivedParams(getNeuronModel(), paramName)) {
+        throw std::runtime_error("setParamDynamic: Parameter '" + paramName + "' is used to calculate derived parameters so cannot be dynamic");
+    }
+
+    m_DynamicParams[paramIndex] = dynamic;
+}
+//----------------------------------------------------------------------------
 VarLocation NeuronGroup::getVarLocation(const std::string &varName) const
 {
     return m_VarLocation[getNeuronModel()->getVarIndex(varName)];
@@ -140,7 +164,8 @@ bool NeuronGroup::isSimRNGRequired() const
     // Returns true if any parts of the neuron code require an RNG
     if(Utils::isRNGRequired(getNeuronModel()->getSimCode())
         || Utils::isRNGRequired(getNeuronModel()->getThresholdConditionCode())
-        || Utils::isRNGRequired(getNeuronModel()->getResetCode()))
+        || Utils::isRNGRequired(getNeuronModel()->getResetCode())
+        || Utils::isRNGRequired(getNeuronModel()->getPopulationSpikeCode()))
     {
         return true;
     }
@@ -321,13 +346,15 @@ bool NeuronGroup::isVarQueueRequired(const std::string &var) const
 bool NeuronGroup::canBeMerged(const NeuronGroup &other) const
 {
     if(getNeuronModel()->canBeMerged(other.getNeuronModel())
-       && (getParams() == other.getParams())
+       && (getDynamicParams() == other.getDynamicParams())
+       && Utils::areNonDynamicParamsEqual(getParams(), other.getParams(), getDynamicParams())
        && (getDerivedParams() == other.getDerivedParams())
        && (isSpikeTimeRequired() == other.isSpikeTimeRequired())
        && (getSpikeEventCondition() == other.getSpikeEventCondition())
        && (isSpikeEventRequired() == other.isSpikeEventRequired())
        && (getNumDelaySlots() == other.getNumDelaySlots())
-       && (m_VarQueueRequired == other.m_VarQueueRequired))
+       && (m_VarQueueRequired == other.m_VarQueueRequired)
+       && (isSpikeRecordingEnabled() == other.isSpikeRecordingEnabled()))
     {
 
         // Check if, by reshuffling, all current sources are compatible
@@ -448,6 +475,70 @@ bool NeuronGroup::canInitBeMerged(const NeuronGroup &other) const
     return false;
 }
 //----------------------------------------------------------------------------
+size_t NeuronGroup::getHashDigest() const
+{
+    size_t hash = 0;
+    getNeuronModel()->updateHash(hash);
+    Utils::updateHashNonDynamicParams(getParams(), getDynamicParams(), hash);
+    Utils::updateHash(getDerivedParams(), hash);
+    Utils::updateHash(isSpikeTimeRequired(), hash);
+    Utils::updateHash(isSpikeEventRequired(), hash);
+    Utils::updateHash(getNumDelaySlots(), hash);
+    Utils::updateHash(m_VarQueueRequired, hash);
+    Utils::updateHash(isSpikeRecordingEnabled(), hash);
+
+    // Update hash with spike event conditions
+    updateHashUnordered(getSpikeEventCondition(), hash,
+                        [](const SpikeEventThreshold &s)
+                        {
+                            size_t conditionHash = 0;
+                            Utils::updateHash(s.eventThresholdCode, conditionHash);
+                            Utils::updateHash(s.supportCode, conditionHash);
+                            return conditionHash;
+                        });
+
+    // Update hash with current sources and incoming and outgoing synapse groups
+    updateHashUnordered(getCurrentSources(), hash,
+                        [](const CurrentSourceInternal *cs){ return cs->getHashDigest(); });
+    updateHashUnordered(getInSynWithPostCode(), hash,
+                        [](const SynapseGroupInternal *sg){ return sg->getWUPostHashDigest(); });
+    updateHashUnordered(getOutSynWithPreCode(), hash,
+                        [](const SynapseGroupInternal *sg){ return sg->getWUPreHashDigest(); });
+    updateHashUnordered(getMergedInSyn(), hash,
+                        [](const std::pair<SynapseGroupInternal*, std::vector<SynapseGroupInternal*>> &m)
+                        {
+                            return m.first->getPSHashDigest();
+                        });
+    return hash;
+}
+//----------------------------------------------------------------------------
+size_t NeuronGroup::getInitHashDigest() const
+{
+    size_t hash = 0;
+    Utils::updateHash(isSpikeTimeRequired(), hash);
+    Utils::updateHash(isSpikeEventRequired(), hash);
+    Utils::updateHash(getNumDelaySlots(), hash);
+    Utils::updateHash(m_VarQueueRequired, hash);
+    Models::Base::updateHashVars(getNeuronModel()->getVars(), hash);
+    for(const auto &v : getVarInitialisers()) {
+        v.updateHash(hash);
+    }
+
+    // Update hash with initialisation of current sources and incoming and outgoing synapse groups
+    updateHashUnordered(getCurrentSources(), hash,
+                        [](const CurrentSourceInternal *cs){ return cs->getInitHashDigest(); });
+    updateHashUnordered(getInSynWithPostCode(), hash,
+                        [](const SynapseGroupInternal *sg){ return sg->getWUPostInitHashDigest(); });
+    updateHashUnordered(getOutSynWithPreCode(), hash,
+                        [](const SynapseGroupInternal *sg){ return sg->getWUPreInitHashDigest(); });
+    updateHashUnordered(getMergedInSyn(), hash,
+                        [](const std::pair<SynapseGroupInternal*, std::vector<SynapseGroupInternal*>> &m)
+                        {
+                            return m.first->getPSInitHashDigest();
+                        });
+    return hash;
+}
+//----------------------------------------------------------------------------
 void NeuronGroup::updateVarQueues(const std::string &code, const std::string &suffix)
 {
     // Loop through variables
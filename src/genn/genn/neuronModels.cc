@@ -9,6 +9,7 @@ IMPLEMENT_MODEL(NeuronModels::SpikeSource);
 IMPLEMENT_MODEL(NeuronModels::SpikeSourceArray);
 IMPLEMENT_MODEL(NeuronModels::Poisson);
 IMPLEMENT_MODEL(NeuronModels::PoissonNew);
+IMPLEMENT_MODEL(NeuronModels::PoissonPopulation);
 IMPLEMENT_MODEL(NeuronModels::TraubMiles);
 IMPLEMENT_MODEL(NeuronModels::TraubMilesFast);
 IMPLEMENT_MODEL(NeuronModels::TraubMilesAlt);
@@ -25,5 +26,25 @@ bool NeuronModels::Base::canBeMerged(const Base *other) const
             && (getResetCode() == other->getResetCode())
             && (getSupportCode() == other->getSupportCode())
             && (isAutoRefractoryRequired() == other->isAutoRefractoryRequired())
+            && (getPopulationSpikeCode() == other->getPopulationSpikeCode())
             && (getAdditionalInputVars() == other->getAdditionalInputVars()));
 }
+//----------------------------------------------------------------------------
+void NeuronModels::Base::updateHash(size_t &hash) const
+{
+    Models::Base::updateHash(hash);
+    Utils::updateHash(getSimCode(), hash);
+    Utils::updateHash(getThresholdConditionCode(), hash);
+    Utils::updateHash(getResetCode(), hash);
+    Utils::updateHash(getSupportCode(), hash);
+    Utils::updateHash(isAutoRefractoryRequired(), hash);
+    Utils::updateHash(getPopulationSpikeCode(), hash);
+
+    const auto additionalInputVars = getAdditionalInputVars();
+    Utils::updateHash(additionalInputVars.size(), hash);
+    for(const auto &v : additionalInputVars) {
+        Utils::updateHash(v.name, hash);
+        Utils::updateHash(v.type, hash);
+        Utils::updateHash(v.value, hash);
+    }
+}
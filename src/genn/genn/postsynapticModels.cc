@@ -16,3 +16,11 @@ bool PostsynapticModels::Base::canBeMerged(const Base *other) const
             && (getApplyInputCode() == other->getApplyInputCode())
             && (getSupportCode() == other->getSupportCode()));
 }
+//----------------------------------------------------------------------------
+void PostsynapticModels::Base::updateHash(size_t &hash) const
+{
+    Models::Base::updateHash(hash);
+    Utils::updateHash(getDecayCode(), hash);
+    Utils::updateHash(getApplyInputCode(), hash);
+    Utils::updateHash(getSupportCode(), hash);
+}
@@ -78,6 +78,42 @@ void SynapseGroup::setPSExtraGlobalParamLocation(const std::string &paramName, V
     m_PSExtraGlobalParamLocation[extraGlobalParamIndex] = loc;
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::setWUParamDynamic(const std::string &paramName, bool dynamic)
+{
+    // **NOTE** dynamic parameters are named after their synapse group so they can't share names with dynamic postsynaptic model parameters
+    const auto psParamNames = getPSModel()->getParamNames();
+    const auto psParam = std::find(psParamNames.cbegin(), psParamNames.cend(), paramName);
+    if(dynamic && psParam != psParamNames.cend() && m_PSDynamicParams[std::distance(psParamNames.cbegin(), psParam)]) {
+        throw std::runtime_error("setWUParamDynamic: Postsynaptic model parameter '" + paramName + "' with the same name is already dynamic");
+    }
+
+    // **NOTE** derived parameters are calculated from the values of parameters at model build time
+    const size_t paramIndex = getWUModel()->getParamIndex(paramName);
+    if(dynamic && Utils::isParamUsedByDerivedParams(getWUModel(), paramName)) {
+        throw std::runtime_error("setWUParamDynamic: Parameter '" + paramName + "' is used to calculate derived parameters so cannot be dynamic");
+    }
+
+    m_WUDynamicParams[paramIndex] = dynamic;
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::setPSParamDynamic(const std::string &paramName, bool dynamic)
+{
+    // **NOTE** dynamic parameters are named after their synapse group so they can't share names with dynamic weight update model parameters
+    const auto wuParamNames = getWUModel()->getParamNames();
+    const auto wuParam = std::find(wuParamNames.cbegin(), wuParamNames.cend(), paramName);
+    if(dynamic && wuParam != wuParamNames.cend() && m_WUDynamicParams[std::distance(wuParamNames.cbegin(), wuParam)]) {
+        throw std::runtime_error("setPSParamDynamic: Weight update model parameter '" + paramName + "' with the same name is already dynamic");
+    }
+
+    // **NOTE** derived parameters are calculated from the values of parameters at model build time
+    const size_t paramIndex = getPSModel()->getParamIndex(paramName);
+    if(dynamic && Utils::isParamUsedByDerivedParams(getPSModel(), paramName)) {
+        throw std::runtime_error("setPSParamDynamic: Parameter '" + paramName + "' is used to calculate derived parameters so cannot be dynamic");
+    }
+
+    m_PSDynamicParams[paramIndex] = dynamic;
+}
+//----------------------------------------------------------------------------
 void SynapseGroup::setSparseConnectivityExtraGlobalParamLocation(const std::string &paramName, VarLocation loc)
 {
     const size_t extraGlobalParamIndex = m_ConnectivityInitialiser.getSnippet()->getExtraGlobalParamIndex(paramName);
@@ -89,7 +125,7 @@ void SynapseGroup::setSparseConnectivityExtraGlobalParamLocation(const std::stri
 //----------------------------------------------------------------------------
 void SynapseGroup::setMaxConnections(unsigned int maxConnections)
 {
-    if (getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+    if ((getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (getMatrixType() & SynapseMatrixConnectivity::CSR)) {
         if(m_ConnectivityInitialiser.getSnippet()->getCalcMaxRowLengthFunc()) {
             throw std::runtime_error("setMaxConnections: Synapse group already has max connections defined by connectivity initialisation snippet.");
         }
@@ -103,7 +139,7 @@ void SynapseGroup::setMaxConnections(unsigned int maxConnections)
 //----------------------------------------------------------------------------
 void SynapseGroup::setMaxSourceConnections(unsigned int maxConnections)
 {
-    if (getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+    if ((getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (getMatrixType() & SynapseMatrixConnectivity::CSR)) {
         if(m_ConnectivityInitialiser.getSnippet()->getCalcMaxColLengthFunc()) {
             throw std::runtime_error("setMaxSourceConnections: Synapse group already has max source connections defined by connectivity initialisation snippet.");
         }
@@ -115,6 +151,16 @@ void SynapseGroup::setMaxSourceConnections(unsigned int maxConnections)
     }
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::setMaxSynapses(size_t maxSynapses)
+{
+    if (getMatrixType() & SynapseMatrixConnectivity::CSR) {
+        m_MaxSynapses = maxSynapses;
+    }
+    else {
+        throw std::runtime_error("setMaxSynapses: This function can only be used on synapse groups with CSR connectivity.");
+    }
+}
+//----------------------------------------------------------------------------
 void SynapseGroup::setMaxDendriticDelayTimesteps(unsigned int maxDendriticDelayTimesteps)
 {
     // **TODO** constraints on this
@@ -150,7 +196,7 @@ void SynapseGroup::setBackPropDelaySteps(unsigned int timesteps)
 //----------------------------------------------------------------------------
 void SynapseGroup::setNarrowSparseIndEnabled(bool enabled)
 {
-    if (getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+    if ((getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (getMatrixType() & SynapseMatrixConnectivity::CSR)) {
         m_NarrowSparseIndEnabled = enabled;
     }
     else {
@@ -158,6 +204,17 @@ void SynapseGroup::setNarrowSparseIndEnabled(bool enabled)
     }
 }
 //----------------------------------------------------------------------------
+size_t SynapseGroup::getMaxSynapses() const
+{
+    // If maximum number of synapses hasn't been set explicitly, allow every row to be full
+    if(m_MaxSynapses == 0) {
+        return (size_t)getSrcNeuronGroup()->getNumNeurons() * (size_t)getMaxConnections();
+    }
+    else {
+        return m_MaxSynapses;
+    }
+}
+//----------------------------------------------------------------------------
 bool SynapseGroup::isTrueSpikeRequired() const
 {
     return !getWUModel()->getSimCode().empty();
@@ -280,8 +337,9 @@ bool SynapseGroup::isWUInitRNGRequired() const
         return true;
     }
 
-    // Return true if matrix has sparse or bitmask connectivity and an RNG is required to initialise connectivity
-    return (((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::BITMASK))
+    // Return true if matrix has sparse, CSR or bitmask connectivity and an RNG is required to initialise connectivity
+    return (((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::CSR)
+             || (m_MatrixType & SynapseMatrixConnectivity::BITMASK))
             && Utils::isRNGRequired(m_ConnectivityInitialiser.getSnippet()->getRowBuildCode()));
 }
 //----------------------------------------------------------------------------
@@ -300,8 +358,9 @@ bool SynapseGroup::isWUVarInitRequired() const
 //----------------------------------------------------------------------------
 bool SynapseGroup::isSparseConnectivityInitRequired() const
 {
-    // Return true if the matrix type is sparse or bitmask and there is code to initialise sparse connectivity
-    return (((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::BITMASK))
+    // Return true if the matrix type is sparse, CSR or bitmask and there is code to initialise sparse connectivity
+    return (((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::CSR)
+             || (m_MatrixType & SynapseMatrixConnectivity::BITMASK))
             && !getConnectivityInitialiser().getSnippet()->getRowBuildCode().empty());
 }
 //----------------------------------------------------------------------------
@@ -313,7 +372,7 @@ SynapseGroup::SynapseGroup(const std::string name, SynapseMatrixType matrixType,
                            VarLocation defaultVarLocation, VarLocation defaultExtraGlobalParamLocation,
                            VarLocation defaultSparseConnectivityLocation, bool defaultNarrowSparseIndEnabled)
     :   m_Name(name), m_SpanType(SpanType::POSTSYNAPTIC), m_NumThreadsPerSpike(1), m_DelaySteps(delaySteps), m_BackPropDelaySteps(0),
-        m_MaxDendriticDelayTimesteps(1), m_MatrixType(matrixType),  m_SrcNeuronGroup(srcNeuronGroup), m_TrgNeuronGroup(trgNeuronGroup),
+        m_MaxSynapses(0), m_MaxDendriticDelayTimesteps(1), m_MatrixType(matrixType),  m_SrcNeuronGroup(srcNeuronGroup), m_TrgNeuronGroup(trgNeuronGroup),
         m_EventThresholdReTestRequired(false), m_NarrowSparseIndEnabled(defaultNarrowSparseIndEnabled),
         m_InSynLocation(defaultVarLocation),  m_DendriticDelayLocation(defaultVarLocation),
         m_WUModel(wu), m_WUParams(wuParams), m_WUVarInitialisers(wuVarInitialisers), m_WUPreVarInitialisers(wuPreVarInitialisers), m_WUPostVarInitialisers(wuPostVarInitialisers),
@@ -321,6 +380,7 @@ SynapseGroup::SynapseGroup(const std::string name, SynapseMatrixType matrixType,
         m_WUVarLocation(wuVarInitialisers.size(), defaultVarLocation), m_WUPreVarLocation(wuPreVarInitialisers.size(), defaultVarLocation),
         m_WUPostVarLocation(wuPostVarInitialisers.size(), defaultVarLocation), m_WUExtraGlobalParamLocation(wu->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation),
         m_PSVarLocation(psVarInitialisers.size(), defaultVarLocation), m_PSExtraGlobalParamLocation(ps->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation),
+        m_WUDynamicParams(wuParams.size(), false), m_PSDynamicParams(psParams.size(), false),
         m_ConnectivityInitialiser(connectivityInitialiser), m_SparseConnectivityLocation(defaultSparseConnectivityLocation),
         m_ConnectivityExtraGlobalParamLocation(connectivityInitialiser.getSnippet()->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation), m_PSModelTargetName(name)
 {
@@ -344,9 +404,9 @@ SynapseGroup::SynapseGroup(const std::string name, SynapseMatrixType matrixType,
     }
 
     // If connectivitity initialisation snippet provides a function to calculate row length, call it
-    // **NOTE** only do this for sparse connectivity as this should not be set for bitmasks
+    // **NOTE** only do this for sparse and CSR connectivity as this should not be set for bitmasks
     auto calcMaxRowLengthFunc = m_ConnectivityInitialiser.getSnippet()->getCalcMaxRowLengthFunc();
-    if(calcMaxRowLengthFunc && (m_MatrixType & SynapseMatrixConnectivity::SPARSE)) {
+    if(calcMaxRowLengthFunc && ((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::CSR))) {
         m_MaxConnections = calcMaxRowLengthFunc(srcNeuronGroup->getNumNeurons(), trgNeuronGroup->getNumNeurons(),
                                                 m_ConnectivityInitialiser.getParams());
     }
@@ -356,9 +416,9 @@ SynapseGroup::SynapseGroup(const std::string name, SynapseMatrixType matrixType,
     }
 
     // If connectivitity initialisation snippet provides a function to calculate row length, call it
-    // **NOTE** only do this for sparse connectivity as this should not be set for bitmasks
+    // **NOTE** only do this for sparse and CSR connectivity as this should not be set for bitmasks
     auto calcMaxColLengthFunc = m_ConnectivityInitialiser.getSnippet()->getCalcMaxColLengthFunc();
-    if(calcMaxColLengthFunc && (m_MatrixType & SynapseMatrixConnectivity::SPARSE)) {
+    if(calcMaxColLengthFunc && ((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::CSR))) {
         m_MaxSourceConnections = calcMaxColLengthFunc(srcNeuronGroup->getNumNeurons(), trgNeuronGroup->getNumNeurons(),
                                                       m_ConnectivityInitialiser.getParams());
     }
@@ -437,8 +497,11 @@ std::string SynapseGroup::getSparseIndType() const
 bool SynapseGroup::canWUBeMerged(const SynapseGroup &other) const
 {
     if(getWUModel()->canBeMerged(other.getWUModel())
-       && (getWUParams() == other.getWUParams())
+       && (getWUDynamicParams() == other.getWUDynamicParams())
+       && Utils::areNonDynamicParamsEqual(getWUParams(), other.getWUParams(), getWUDynamicParams())
        && (getWUDerivedParams() == other.getWUDerivedParams())
+       && (getSrcNeuronGroup()->getDynamicParams() == other.getSrcNeuronGroup()->getDynamicParams())
+       && (getTrgNeuronGroup()->getDynamicParams() == other.getTrgNeuronGroup()->getDynamicParams())
        && (getDelaySteps() == other.getDelaySteps())
        && (getBackPropDelaySteps() == other.getBackPropDelaySteps())
        && (getMaxDendriticDelayTimesteps() == other.getMaxDendriticDelayTimesteps())
@@ -482,7 +545,8 @@ bool SynapseGroup::canWUPreBeMerged(const SynapseGroup &other) const
     const bool delayed = (getDelaySteps() != 0);
     const bool otherDelayed = (other.getDelaySteps() != 0);
     return (getWUModel()->canBeMerged(other.getWUModel())
-            && (getWUParams() == other.getWUParams())
+            && (getWUDynamicParams() == other.getWUDynamicParams())
+            && Utils::areNonDynamicParamsEqual(getWUParams(), other.getWUParams(), getWUDynamicParams())
             && (getWUDerivedParams() == other.getWUDerivedParams())
             && (delayed == otherDelayed));
 }
@@ -492,7 +556,8 @@ bool SynapseGroup::canWUPostBeMerged(const SynapseGroup &other) const
     const bool delayed = (getDelaySteps() != 0);
     const bool otherDelayed = (other.getDelaySteps() != 0);
     return (getWUModel()->canBeMerged(other.getWUModel())
-            && (getWUParams() == other.getWUParams())
+            && (getWUDynamicParams() == other.getWUDynamicParams())
+            && Utils::areNonDynamicParamsEqual(getWUParams(), other.getWUParams(), getWUDynamicParams())
             && (getWUDerivedParams() == other.getWUDerivedParams())
             && (delayed == otherDelayed));
 }
@@ -502,7 +567,8 @@ bool SynapseGroup::canPSBeMerged(const SynapseGroup &other) const
     const bool individualPSM = (getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM);
     const bool otherIndividualPSM = (other.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM);
     if(getPSModel()->canBeMerged(other.getPSModel())
-       && (getPSParams() == other.getPSParams())
+       && (getPSDynamicParams() == other.getPSDynamicParams())
+       && Utils::areNonDynamicParamsEqual(getPSParams(), other.getPSParams(), getPSDynamicParams())
        && (getPSDerivedParams() == other.getPSDerivedParams())
        && (getMaxDendriticDelayTimesteps() == other.getMaxDendriticDelayTimesteps())
        && (individualPSM == otherIndividualPSM))
@@ -526,8 +592,10 @@ bool SynapseGroup::canPSBeLinearlyCombined(const SynapseGroup &other) const
     // they DON'T have individual postsynaptic model variables or they have no variable at all
     // **NOTE * *many models with variables would work fine, but nothing stops
     // initialisers being used to configure PS models to behave totally different
+    // **NOTE** dynamic parameters can be changed independently at runtime so groups with them can never be combined
     return (canPSBeMerged(other)
-            && (!(getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) || getPSVarInitialisers().empty()));
+            && (!(getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) || getPSVarInitialisers().empty())
+            && std::none_of(getPSDynamicParams().cbegin(), getPSDynamicParams().cend(), [](bool d){ return d; }));
 }
 //----------------------------------------------------------------------------
 bool SynapseGroup::canWUInitBeMerged(const SynapseGroup &other) const
@@ -603,3 +671,127 @@ bool SynapseGroup::canConnectivityInitBeMerged(const SynapseGroup &other) const
             && (getSynapseMatrixConnectivity(getMatrixType()) == getSynapseMatrixConnectivity(other.getMatrixType()))
             && (getSparseIndType() == other.getSparseIndType()));
 }
+//----------------------------------------------------------------------------
+size_t SynapseGroup::getWUHashDigest() const
+{
+    size_t hash = 0;
+    getWUModel()->updateHash(hash);
+    Utils::updateHashNonDynamicParams(getWUParams(), getWUDynamicParams(), hash);
+    Utils::updateHash(getWUDerivedParams(), hash);
+    Utils::updateHash(getSrcNeuronGroup()->getDynamicParams(), hash);
+    Utils::updateHash(getTrgNeuronGroup()->getDynamicParams(), hash);
+    Utils::updateHash(getDelaySteps(), hash);
+    Utils::updateHash(getBackPropDelaySteps(), hash);
+    Utils::updateHash(getMaxDendriticDelayTimesteps(), hash);
+    Utils::updateHash(getSparseIndType(), hash);
+    Utils::updateHash(getNumThreadsPerSpike(), hash);
+    Utils::updateHash(isEventThresholdReTestRequired(), hash);
+    Utils::updateHash(getSpanType(), hash);
+    Utils::updateHash(isPSModelMerged(), hash);
+    Utils::updateHash(getSrcNeuronGroup()->getNumDelaySlots(), hash);
+    Utils::updateHash(getTrgNeuronGroup()->getNumDelaySlots(), hash);
+    Utils::updateHash(getMatrixType(), hash);
+
+    // If connectivity is procedural, update hash with connectivity initialiser
+    if(getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL) {
+        getConnectivityInitialiser().updateHash(hash);
+    }
+
+    // If matrix weights are global, update hash with constantified init values
+    if(getMatrixType() & SynapseMatrixWeight::GLOBAL) {
+        Utils::updateHash(getWUConstInitVals(), hash);
+    }
+    // Otherwise, if they are procedural, update hash with variable initialisers
+    else if(getMatrixType() & SynapseMatrixWeight::PROCEDURAL) {
+        for(const auto &v : getWUVarInitialisers()) {
+            v.updateHash(hash);
+        }
+    }
+    return hash;
+}
+//----------------------------------------------------------------------------
+size_t SynapseGroup::getWUPreHashDigest() const
+{
+    size_t hash = 0;
+    getWUModel()->updateHash(hash);
+    Utils::updateHashNonDynamicParams(getWUParams(), getWUDynamicParams(), hash);
+    Utils::updateHash(getWUDerivedParams(), hash);
+    Utils::updateHash((getDelaySteps() != 0), hash);
+    return hash;
+}
+//----------------------------------------------------------------------------
+size_t SynapseGroup::getWUPostHashDigest() const
+{
+    // **NOTE** canWUPostBeMerged currently checks the same properties as canWUPreBeMerged
+    return getWUPreHashDigest();
+}
+//----------------------------------------------------------------------------
+size_t SynapseGroup::getPSHashDigest() const
+{
+    const bool individualPSM = (getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM);
+
+    size_t hash = 0;
+    getPSModel()->updateHash(hash);
+    Utils::updateHashNonDynamicParams(getPSParams(), getPSDynamicParams(), hash);
+    Utils::updateHash(getPSDerivedParams(), hash);
+    Utils::updateHash(getMaxDendriticDelayTimesteps(), hash);
+    Utils::updateHash(individualPSM, hash);
+
+    // If postsynaptic model variables aren't individual, update hash with constantified init values
+    if(!individualPSM) {
+        Utils::updateHash(getPSConstInitVals(), hash);
+    }
+    return hash;
+}
+//----------------------------------------------------------------------------
+size_t SynapseGroup::getWUInitHashDigest() const
+{
+    size_t hash = 0;
+    Utils::updateHash(getMatrixType(), hash);
+    Utils::updateHash(getSparseIndType(), hash);
+    Models::Base::updateHashVars(getWUModel()->getVars(), hash);
+    for(const auto &v : getWUVarInitialisers()) {
+        v.updateHash(hash);
+    }
+    return hash;
+}
+//----------------------------------------------------------------------------
+size_t SynapseGroup::getWUPreInitHashDigest() const
+{
+    size_t hash = 0;
+    Models::Base::updateHashVars(getWUModel()->getPreVars(), hash);
+    for(const auto &v : getWUPreVarInitialisers()) {
+        v.updateHash(hash);
+    }
+    return hash;
+}
+//----------------------------------------------------------------------------
+size_t SynapseGroup::getWUPostInitHashDigest() const
+{
+    size_t hash = 0;
+    Models::Base::updateHashVars(getWUModel()->getPostVars(), hash);
+    for(const auto &v : getWUPostVarInitialisers()) {
+        v.updateHash(hash);
+    }
+    return hash;
+}
+//----------------------------------------------------------------------------
+size_t SynapseGroup::getPSInitHashDigest() const
+{
+    size_t hash = 0;
+    Models::Base::updateHashVars(getPSModel()->getVars(), hash);
+    Utils::updateHash(getMaxDendriticDelayTimesteps(), hash);
+    for(const auto &v : getPSVarInitialisers()) {
+        v.updateHash(hash);
+    }
+    return hash;
+}
+//----------------------------------------------------------------------------
+size_t SynapseGroup::getConnectivityInitHashDigest() const
+{
+    size_t hash = 0;
+    getConnectivityInitialiser().updateHash(hash);
+    Utils::updateHash(getSynapseMatrixConnectivity(getMatrixType()), hash);
+    Utils::updateHash(getSparseIndType(), hash);
+    return hash;
+}
@@ -26,3 +26,23 @@ bool WeightUpdateModels::Base::canBeMerged(const Base *other) const
             && (isPreSpikeTimeRequired() == other->isPreSpikeTimeRequired())
             && (isPostSpikeTimeRequired() == other->isPostSpikeTimeRequired()));
 }
+//----------------------------------------------------------------------------
+void WeightUpdateModels::Base::updateHash(size_t &hash) const
+{
+    Models::Base::updateHash(hash);
+    Utils::updateHash(getSimCode(), hash);
+    Utils::updateHash(getEventCode(), hash);
+    Utils::updateHash(getLearnPostCode(), hash);
+    Utils::updateHash(getSynapseDynamicsCode(), hash);
+    Utils::updateHash(getEventThresholdConditionCode(), hash);
+    Utils::updateHash(getSimSupportCode(), hash);
+    Utils::updateHash(getLearnPostSupportCode(), hash);
+    Utils::updateHash(getSynapseDynamicsSuppportCode(), hash);
+    Utils::updateHash(getPreSpikeCode(), hash);
+    Utils::updateHash(getPostSpikeCode(), hash);
+    Utils::updateHash(isPreSpikeTimeRequired(), hash);
+    Utils::updateHash(isPostSpikeTimeRequired(), hash);
+
+    updateHashVars(getPreVars(), hash);
+    updateHashVars(getPostVars(), hash);
+}
@@ -0,0 +1,64 @@
+//--------------------------------------------------------------------------
+/*! \file benchmark/substitutions/benchmark.cc
+
+\brief Micro-benchmark of the substitutions applied to every code string during code generation.
+Measures the time taken to substitute the variables, parameters and functions into
+three lines of Hodgkin-Huxley style neuron code and then apply ensureFtype.
+The timings reflect the optimisation level libGeNN was built with and, by default, it is built
+without optimisation so, to measure the performance seen in practice, rebuild it with e.g.
+CXXFLAGS=-O2 before building this benchmark.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <chrono>
+#include <iostream>
+#include <string>
+
+// Standard C includes
+#include <cstdlib>
+
+// GeNN code generator includes
+#include "code_generator/codeGenUtils.h"
+#include "code_generator/substitutions.h"
+
+using namespace CodeGenerator;
+
+int main(int argc, char *argv[])
+{
+    // Number of times to process code string can be passed on command line
+    const int numRepeats = (argc > 1) ? std::atoi(argv[1]) : 20000;
+
+    const std::string code =
+        "$(V) += (1.0/$(C)) * ($(Isyn) - $(gNa)*$(m)*$(m)*$(m)*$(h)*($(V)-$(ENa)) - $(gK)*$(n)*$(n)*$(n)*$(n)*($(V)-$(EK)));\n"
+        "scalar a = exp(-($(V)+52.0)/4.0) * 0.32 * sin($(t)) + pow($(V), 2.0) + sqrt($(h)) + fabs($(n));\n"
+        "if($(V) > $(Vthresh)) { $(addToInSyn, $(g) * exp(-$(tau))); $(V) = $(Vreset); }\n";
+
+    // Build two-level substitution stack, as used when generating neuron and synapse code
+    Substitutions parentSubs;
+    parentSubs.addVarSubstitution("t", "t");
+    parentSubs.addVarSubstitution("id_post", "ipost");
+    parentSubs.addFuncSubstitution("addToInSyn", 1, "group.inSyn[$(id_post)] += $(0)");
+
+    Substitutions subs(&parentSubs);
+    for(const char *v : {"V", "m", "h", "n", "Isyn", "g"}) {
+        subs.addVarSubstitution(v, std::string("l") + v);
+    }
+    subs.addParamValueSubstitution({"C", "gNa", "ENa", "gK", "EK", "Vthresh", "Vreset", "tau"}, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0});
+
+    // Process code string repeatedly
+    // **NOTE** total size of generated code is accumulated so the work can't be optimised away
+    size_t totalSize = 0;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for(int i = 0; i < numRepeats; i++) {
+        std::string c = code;
+        subs.applyCheckUnreplaced(c, "benchmark");
+        c = ensureFtype(c, "float");
+        totalSize += c.size();
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    const double duration = std::chrono::duration<double>(end - start).count();
+    std::cout << "Processed " << numRepeats << " code strings (" << totalSize << " characters) in " << duration << "s" << std::endl;
+    std::cout << (duration * 1.0E6 / numRepeats) << "us per code string" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,64 @@
+//--------------------------------------------------------------------------
+/*! \file batch/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Pre
+//----------------------------------------------------------------------------
+class Pre : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Pre, 0, 1);
+
+    SET_THRESHOLD_CONDITION_CODE("$(id) == (unsigned int)$(s)");
+
+    SET_VARS({{"s", "scalar"}});
+
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(Pre);
+
+//----------------------------------------------------------------------------
+// Post
+//----------------------------------------------------------------------------
+class Post : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Post, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Post);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("batch");
+    model.setBatchSize(4);
+
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(1.0);
+
+    model.addNeuronPopulation<Pre>("Pre", 10, {}, Pre::VarValues(0.0));
+    model.addNeuronPopulation<Post>("Post", 10, {}, Post::VarValues(0.0));
+
+    // **NOTE** delay means presynaptic spikes are read from a spike queue
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, 2, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+
+    model.setPrecision(GENN_FLOAT);
+}
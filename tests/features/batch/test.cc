@@ -0,0 +1,67 @@
+//--------------------------------------------------------------------------
+/*! \file batch/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "batch_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, Batch)
+{
+    // Check connectivity is only built once and weights are initialised in every batch instance
+    for(unsigned int i = 0; i < 10; i++) {
+        ASSERT_EQ(rowLengthSyn[i], 1);
+        ASSERT_EQ(indSyn[i], i);
+    }
+    for(unsigned int i = 0; i < (4 * 10); i++) {
+        ASSERT_FLOAT_EQ(gSyn[i], 1.0f);
+    }
+
+    // In each batch instance, make a different presynaptic neuron spike and give synapses a different weight
+    for(unsigned int b = 0; b < 4; b++) {
+        for(unsigned int i = 0; i < 10; i++) {
+            sPre[(b * 10) + i] = (scalar)b;
+            gSyn[(b * 10) + i] = (scalar)(b + 1);
+        }
+    }
+    pushPreStateToDevice();
+    pushSynStateToDevice();
+
+    // Spikes emitted in the first timestep arrive after two timesteps of axonal delay
+    for(unsigned int s = 0; s < 4; s++) {
+        StepGeNN();
+    }
+
+    // Check each batch instance has a single spike from the correct presynaptic neuron
+    // **NOTE** spike count for each batch instance is stored in 3 delay slots
+    ASSERT_EQ(spikeCount_Pre, 1);
+    for(unsigned int b = 0; b < 4; b++) {
+        ASSERT_EQ(glbSpkCntPre[(b * 3) + spkQuePtrPre], 1);
+        ASSERT_EQ(glbSpkPre[(b * 3 * 10) + (spkQuePtrPre * 10)], b);
+    }
+
+    // Check each batch instance's postsynaptic population only receives input from its own spike and weights
+    for(unsigned int b = 0; b < 4; b++) {
+        for(unsigned int j = 0; j < 10; j++) {
+            ASSERT_FLOAT_EQ(xPost[(b * 10) + j], (j == b) ? (scalar)(b + 1) : 0.0f);
+        }
+    }
+}
@@ -0,0 +1,43 @@
+//--------------------------------------------------------------------------
+/*! \file connectivity_cache/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+void modelDefinition(ModelSpec &model)
+{
+    // **NOTE** random connectivity can only be cached if it's built using counter-based RNGs with a fixed seed
+    GENN_PREFERENCES.enableCounterBasedRNG = true;
+    GENN_PREFERENCES.connectivityCacheDirectory = "connectivity_cache_CODE/connectivity_cache";
+
+    model.setDT(0.1);
+    model.setName("connectivity_cache");
+    model.setSeed(1234);
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 100, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Post", 100, {}, {});
+
+    InitSparseConnectivitySnippet::FixedProbability::ParamValues fixedProbParams(0.1);
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Ragged", SynapseMatrixType::SPARSE_GLOBALG, NO_DELAY, "Pre", "Post",
+        {}, WeightUpdateModels::StaticPulse::VarValues(1.0),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProbParams));
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "CSR", SynapseMatrixType::CSR_GLOBALG, NO_DELAY, "Pre", "Post",
+        {}, WeightUpdateModels::StaticPulse::VarValues(1.0),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Bitmask", SynapseMatrixType::BITMASK_GLOBALG, NO_DELAY, "Pre", "Post",
+        {}, WeightUpdateModels::StaticPulse::VarValues(1.0),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+
+    model.setPrecision(GENN_FLOAT);
+}
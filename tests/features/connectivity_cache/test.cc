@@ -0,0 +1,81 @@
+//--------------------------------------------------------------------------
+/*! \file connectivity_cache/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <numeric>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "connectivity_cache_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, ConnectivityCache)
+{
+    pullRaggedConnectivityFromDevice();
+    pullCSRConnectivityFromDevice();
+    pullgpBitmaskFromDevice();
+
+    // Check one-to-one connectivity, whether it was built or read from cache
+    for(unsigned int i = 0; i < 100; i++) {
+        ASSERT_EQ(rowPtrCSR[i], i);
+        ASSERT_EQ(indCSR[i], i);
+
+        const unsigned int gid = (i * 100) + i;
+        ASSERT_TRUE(B(gpBitmask[gid / 32], gid % 32));
+    }
+    ASSERT_EQ(rowPtrCSR[100], 100);
+    unsigned int numBits = 0;
+    for(unsigned int gid = 0; gid < (100 * 100); gid++) {
+        numBits += B(gpBitmask[gid / 32], gid % 32) ? 1 : 0;
+    }
+    ASSERT_EQ(numBits, 100);
+
+    // Copy random connectivity
+    const std::vector<unsigned int> rowLength(&rowLengthRagged[0], &rowLengthRagged[100]);
+    const std::vector<unsigned int> ind(&indRagged[0], &indRagged[100 * maxRowLengthRagged]);
+    EXPECT_GT(std::accumulate(rowLength.cbegin(), rowLength.cend(), 0u), 0u);
+
+    // Clear connectivity and re-initialise, at which point connectivity must have been cached
+    std::fill_n(rowLengthRagged, 100, 0);
+    std::fill_n(rowPtrCSR, 101, 0);
+    std::fill_n(gpBitmask, ((100 * 100) + 31) / 32, 0);
+    initialize();
+    initializeSparse();
+    pullRaggedConnectivityFromDevice();
+    pullCSRConnectivityFromDevice();
+    pullgpBitmaskFromDevice();
+
+    // Check identical random connectivity is read back
+    for(unsigned int i = 0; i < 100; i++) {
+        ASSERT_EQ(rowLengthRagged[i], rowLength[i]);
+        for(unsigned int s = 0; s < rowLength[i]; s++) {
+            ASSERT_EQ(indRagged[(i * maxRowLengthRagged) + s], ind[(i * maxRowLengthRagged) + s]);
+        }
+    }
+
+    // Check one-to-one connectivity is read back
+    for(unsigned int i = 0; i < 100; i++) {
+        ASSERT_EQ(rowPtrCSR[i + 1], i + 1);
+        ASSERT_EQ(indCSR[i], i);
+
+        const unsigned int gid = (i * 100) + i;
+        ASSERT_TRUE(B(gpBitmask[gid / 32], gid % 32));
+    }
+}
@@ -0,0 +1,27 @@
+//--------------------------------------------------------------------------
+/*! \file decode_matrix_conn_gen_csr_overflow/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Standard C++ includes
+#include <stdexcept>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "decode_matrix_conn_gen_csr_overflow_CODE/definitions.h"
+
+TEST(DecodeMatrixConnGenCSROverflow, InitializeThrows)
+{
+    allocateMem();
+
+    // Building connectivity with more synapses than were allocated should fail rather than overflowing ind
+    EXPECT_THROW(initialize(), std::runtime_error);
+
+    freeMem();
+}
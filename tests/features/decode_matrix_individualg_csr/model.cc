@@ -0,0 +1,49 @@
+//--------------------------------------------------------------------------
+/*! \file decode_matrix_individualg_csr/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("decode_matrix_individualg_csr");
+
+    // Static synapse parameters
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(1.0);    // 0 - Wij (nA)
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 10, {}, {});
+    model.addNeuronPopulation<Neuron>("Post", 4, {}, Neuron::VarValues(0.0));
+
+
+    auto *syn = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::CSR_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {});
+
+    // **NOTE** only 17 of the 40 possible synapses exist
+    syn->setMaxSynapses(17);
+
+    model.setPrecision(GENN_FLOAT);
+}
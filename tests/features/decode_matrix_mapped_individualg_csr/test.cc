@@ -0,0 +1,87 @@
+//--------------------------------------------------------------------------
+/*! \file decode_matrix_mapped_individualg_csr/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Standard C++ includes
+#include <stdexcept>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "decode_matrix_mapped_individualg_csr_CODE/definitions.h"
+
+// User project includes
+#include "../../../userproject/include/sparseMatrixFile.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test_decoder_matrix.h"
+
+#define FILENAME "decode_matrix_mapped_individualg_csr_CODE/Syn.bin"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestDecoderMatrix
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Build connectivity and weights in the layout GeNN uses
+        std::vector<unsigned int> rowPtr(11);
+        std::vector<unsigned int> ind(maxSynapsesSyn);
+        std::vector<scalar> g(maxSynapsesSyn, 1.0f);
+
+        // Loop through presynaptic neurons
+        rowPtr[0] = 0;
+        for(unsigned int i = 0; i < 10; i++)
+        {
+            // Row initially starts and ends where previous row ended
+            rowPtr[i + 1] = rowPtr[i];
+            for(unsigned int j = 0; j < 4; j++)
+            {
+                // Get value this post synaptic neuron represents
+                const unsigned int j_value = (1 << j);
+
+                // If this postsynaptic neuron should be connected, add index
+                if(((i + 1) & j_value) != 0)
+                {
+                    ind[rowPtr[i + 1]++] = j;
+                }
+            }
+        }
+
+        // Check that a file with incorrectly sized arrays is rejected
+        SparseMatrixFileWriter badWriter(10, 4);
+        badWriter.addArray("rowPtr", rowPtr.data(), 10);
+        badWriter.addArray("ind", ind.data(), ind.size());
+        badWriter.write(FILENAME);
+        EXPECT_THROW(mapSynConnectivity(FILENAME), std::runtime_error);
+
+        // Write file
+        SparseMatrixFileWriter writer(10, 4);
+        writer.addArray("rowPtr", rowPtr.data(), rowPtr.size());
+        writer.addArray("ind", ind.data(), ind.size());
+        writer.addArray("g", g.data(), g.size());
+        writer.write(FILENAME);
+
+        // Attach connectivity and weights to file
+        mapSynConnectivity(FILENAME);
+    }
+};
+
+TEST_F(SimTest, DecodeMatrixMappedIndividualgCSR)
+{
+    // Check total error is less than some tolerance
+    EXPECT_TRUE(Simulate());
+}
@@ -0,0 +1,81 @@
+//--------------------------------------------------------------------------
+/*! \file decode_matrix_mapped_individualg_ragged/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Standard C++ includes
+#include <stdexcept>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "decode_matrix_mapped_individualg_ragged_CODE/definitions.h"
+
+// User project includes
+#include "../../../userproject/include/sparseMatrixFile.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test_decoder_matrix.h"
+
+#define FILENAME "decode_matrix_mapped_individualg_ragged_CODE/Syn.bin"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestDecoderMatrix
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Build connectivity and weights in the layout GeNN uses
+        std::vector<unsigned int> rowLength(10, 0);
+        std::vector<unsigned int> ind(10 * maxRowLengthSyn);
+        std::vector<scalar> g(10 * maxRowLengthSyn, 1.0f);
+
+        // Loop through presynaptic neurons
+        for(unsigned int i = 0; i < 10; i++)
+        {
+            for(unsigned int j = 0; j < 4; j++)
+            {
+                // Get value this post synaptic neuron represents
+                const unsigned int j_value = (1 << j);
+
+                // If this postsynaptic neuron should be connected, add index
+                if(((i + 1) & j_value) != 0)
+                {
+                    const unsigned int idx = (i * maxRowLengthSyn) + rowLength[i]++;
+                    ind[idx] = j;
+                }
+            }
+        }
+
+        // Write file
+        SparseMatrixFileWriter writer(10, 4);
+        writer.addArray("rowLength", rowLength.data(), rowLength.size());
+        writer.addArray("ind", ind.data(), ind.size());
+        writer.addArray("g", g.data(), g.size());
+        writer.write(FILENAME);
+
+        // Attach connectivity and weights to file
+        mapSynConnectivity(FILENAME);
+    }
+};
+
+TEST_F(SimTest, DecodeMatrixMappedIndividualgRagged)
+{
+    // Check connectivity can't be mapped twice
+    EXPECT_THROW(mapSynConnectivity(FILENAME), std::runtime_error);
+
+    // Check total error is less than some tolerance
+    EXPECT_TRUE(Simulate());
+}
@@ -0,0 +1,91 @@
+//--------------------------------------------------------------------------
+/*! \file deterministic_synaptic_input/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// PreNeuron
+//----------------------------------------------------------------------------
+class PreNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PreNeuron, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(PreNeuron);
+
+//----------------------------------------------------------------------------
+// PostNeuron
+//----------------------------------------------------------------------------
+class PostNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PostNeuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(PostNeuron);
+
+//---------------------------------------------------------------------------
+// Continuous
+//---------------------------------------------------------------------------
+class Continuous : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(Continuous, 0, 1);
+
+    SET_VARS({{"g", "scalar"}});
+
+    SET_SYNAPSE_DYNAMICS_CODE("$(addToInSyn, $(g));\n");
+};
+IMPLEMENT_MODEL(Continuous);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("deterministic_synaptic_input");
+
+    GENN_PREFERENCES.enableDeterministicSynapticInput = true;
+
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(uninitialisedVar());
+    Continuous::VarValues continuousSynapseInit(uninitialisedVar());
+
+    // **NOTE** postsynaptic population sizes aren't multiples of the number of threads so blocks are uneven
+    model.addNeuronPopulation<PreNeuron>("Pre", 1000, {}, {});
+    model.addNeuronPopulation<PostNeuron>("PostDense", 37, {}, PostNeuron::VarValues(0.0));
+    model.addNeuronPopulation<PostNeuron>("PostSparse", 37, {}, PostNeuron::VarValues(0.0));
+    model.addNeuronPopulation<PostNeuron>("PostCont", 37, {}, PostNeuron::VarValues(0.0));
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "DenseSyn", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "PostDense",
+        {}, staticSynapseInit,
+        {}, {});
+
+    auto *sparseSyn = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SparseSyn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "PostSparse",
+        {}, staticSynapseInit,
+        {}, {});
+    sparseSyn->setMaxConnections(20);
+
+    auto *contSyn = model.addSynapsePopulation<Continuous, PostsynapticModels::DeltaCurr>(
+        "ContSyn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "PostCont",
+        {}, continuousSynapseInit,
+        {}, {});
+    contSyn->setMaxConnections(20);
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,96 @@
+//--------------------------------------------------------------------------
+/*! \file deterministic_synaptic_input/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "deterministic_synaptic_input_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+protected:
+    //--------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //--------------------------------------------------------------------------
+    virtual void Init()
+    {
+        for(unsigned int i = 0; i < 1000; i++) {
+            // Give each dense synapse a weight of very different magnitude so the result of summing them depends on order
+            for(unsigned int j = 0; j < 37; j++) {
+                gDenseSyn[(i * 37) + j] = getWeight(i, j);
+            }
+
+            // Connect each row of sparse synapses to postsynaptic neurons in scrambled order
+            rowLengthSparseSyn[i] = 20;
+            rowLengthContSyn[i] = 20;
+            for(unsigned int s = 0; s < 20; s++) {
+                const unsigned int idx = (i * 20) + s;
+                indSparseSyn[idx] = ((i * 13) + (s * 17)) % 37;
+                indContSyn[idx] = ((i * 7) + (s * 29)) % 37;
+                gSparseSyn[idx] = getWeight(i, indSparseSyn[idx]);
+                gContSyn[idx] = getWeight(i + 1000, indContSyn[idx]);
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Static methods
+    //--------------------------------------------------------------------------
+    static float getWeight(unsigned int i, unsigned int j)
+    {
+        return 1.0f / (float)(1 + (((i * 7919u) + (j * 104729u)) % 997u));
+    }
+
+    // Sum input to each postsynaptic neuron in the same order as the single-threaded CPU backend
+    static std::vector<float> getSparseReference(const unsigned int *rowLength, const unsigned int *ind, const float *g)
+    {
+        std::vector<float> reference(37, 0.0f);
+        for(unsigned int i = 0; i < 1000; i++) {
+            for(unsigned int s = 0; s < rowLength[i]; s++) {
+                reference[ind[(i * 20) + s]] += g[(i * 20) + s];
+            }
+        }
+        return reference;
+    }
+};
+
+TEST_F(SimTest, DeterministicSynapticInput)
+{
+    // Build reference input to each population
+    std::vector<float> denseReference(37, 0.0f);
+    for(unsigned int i = 0; i < 1000; i++) {
+        for(unsigned int j = 0; j < 37; j++) {
+            denseReference[j] += gDenseSyn[(i * 37) + j];
+        }
+    }
+    const auto sparseReference = getSparseReference(rowLengthSparseSyn, indSparseSyn, gSparseSyn);
+    const auto contReference = getSparseReference(rowLengthContSyn, indContSyn, gContSyn);
+
+    // Every presynaptic neuron spikes every timestep so, from the second timestep
+    // onward, input should exactly match the reference every timestep
+    StepGeNN();
+    for(unsigned int t = 0; t < 4; t++) {
+        StepGeNN();
+
+        for(unsigned int j = 0; j < 37; j++) {
+            ASSERT_EQ(xPostDense[j], denseReference[j]);
+            ASSERT_EQ(xPostSparse[j], sparseReference[j]);
+            ASSERT_EQ(xPostCont[j], contReference[j]);
+        }
+    }
+}
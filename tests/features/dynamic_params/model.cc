@@ -0,0 +1,102 @@
+//--------------------------------------------------------------------------
+/*! \file dynamic_params/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 1, 1);
+
+    SET_SIM_CODE("$(x)= $(k) + $(Isyn);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+
+    SET_PARAM_NAMES({"k"});
+    SET_VARS({{"x", "scalar"}});
+
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// CurrentSrc
+//----------------------------------------------------------------------------
+class CurrentSrc : public CurrentSourceModels::Base
+{
+public:
+    DECLARE_MODEL(CurrentSrc, 1, 0);
+
+    SET_INJECTION_CODE("$(injectCurrent, $(amp));\n");
+
+    SET_PARAM_NAMES({"amp"});
+};
+
+IMPLEMENT_MODEL(CurrentSrc);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(WeightUpdateModel, 1, 0, 0, 0);
+
+    SET_SIM_CODE("$(addToInSyn, $(w) * $(k_pre));\n");
+
+    SET_PARAM_NAMES({"w"});
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+//----------------------------------------------------------------------------
+// PostsynapticModel
+//----------------------------------------------------------------------------
+class PostsynapticModel : public PostsynapticModels::Base
+{
+public:
+    DECLARE_MODEL(PostsynapticModel, 1, 0);
+
+    SET_APPLY_INPUT_CODE(
+        "$(Isyn) += $(scale) * $(inSyn);\n"
+        "$(inSyn) = 0;\n");
+
+    SET_PARAM_NAMES({"scale"});
+};
+
+IMPLEMENT_MODEL(PostsynapticModel);
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("dynamic_params");
+
+    // **NOTE** Pre and Pre2 only differ in the value of their dynamic parameter so should be merged
+    auto *pre = model.addNeuronPopulation<Neuron>("Pre", 10, Neuron::ParamValues(1.0), Neuron::VarValues(0.0));
+    auto *pre2 = model.addNeuronPopulation<Neuron>("Pre2", 10, Neuron::ParamValues(5.0), Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("Post", 10, Neuron::ParamValues(0.0), Neuron::VarValues(0.0));
+    pre->setParamDynamic("k");
+    pre2->setParamDynamic("k");
+
+    auto *cs = model.addCurrentSource<CurrentSrc>("CS", "Post", CurrentSrc::ParamValues(2.0), {});
+    cs->setParamDynamic("amp");
+
+    auto *syn = model.addSynapsePopulation<WeightUpdateModel, PostsynapticModel>(
+        "Syn", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "Pre", "Post",
+        WeightUpdateModel::ParamValues(0.5), {},
+        PostsynapticModel::ParamValues(1.0), {});
+    syn->setWUParamDynamic("w");
+    syn->setPSParamDynamic("scale");
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,55 @@
+//--------------------------------------------------------------------------
+/*! \file dynamic_params/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "dynamic_params_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, DynamicParams)
+{
+    // Presynaptic spikes emitted in the first timestep arrive in the second
+    StepGeNN();
+    StepGeNN();
+
+    // Check initial parameter values are used
+    for(unsigned int i = 0; i < 10; i++) {
+        ASSERT_FLOAT_EQ(xPre[i], 1.0f);
+        ASSERT_FLOAT_EQ(xPre2[i], 5.0f);
+        ASSERT_FLOAT_EQ(xPost[i], 2.0f + (1.0f * 10.0f * 0.5f * 1.0f));
+    }
+
+    // Change all dynamic parameters
+    setkPre(2.0f);
+    setampCS(3.0f);
+    setwSyn(0.25f);
+    setscaleSyn(2.0f);
+
+    StepGeNN();
+    StepGeNN();
+
+    // Check new values are used and that merged group is unaffected
+    for(unsigned int i = 0; i < 10; i++) {
+        ASSERT_FLOAT_EQ(xPre[i], 2.0f);
+        ASSERT_FLOAT_EQ(xPre2[i], 5.0f);
+        ASSERT_FLOAT_EQ(xPost[i], 3.0f + (2.0f * 10.0f * 0.25f * 2.0f));
+    }
+}
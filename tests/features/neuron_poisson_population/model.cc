@@ -0,0 +1,48 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_poisson_population/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Post
+//----------------------------------------------------------------------------
+class Post : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Post, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Post);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("neuron_poisson_population");
+    model.setSeed(1234);
+
+    NeuronModels::PoissonPopulation::ParamValues poissonParams(
+        20.0);  // 0 - rate (Hz)
+
+    model.addNeuronPopulation<NeuronModels::PoissonPopulation>("Pop", 1000, poissonParams, {});
+    model.addNeuronPopulation<Post>("Post", 1, {}, Post::VarValues(0.0));
+
+    // Connect every Poisson neuron to single postsynaptic neuron so it receives the spike count
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(1.0);
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "Pop", "Post",
+        {}, staticSynapseInit,
+        {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+}
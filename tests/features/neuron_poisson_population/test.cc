@@ -0,0 +1,52 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_poisson_population/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "neuron_poisson_population_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, NeuronPoissonPopulation)
+{
+    unsigned int numSpikes = 0;
+    unsigned int prevSpikeCount = 0;
+    for(unsigned int s = 0; s < 1000; s++) {
+        StepGeNN();
+
+        // Check spikes emitted in the previous timestep were delivered to the postsynaptic neuron
+        ASSERT_FLOAT_EQ(xPost[0], (scalar)prevSpikeCount);
+
+        // Check spikes are valid neuron IDs in ascending order
+        for(unsigned int i = 0; i < spikeCount_Pop; i++) {
+            ASSERT_LT(spike_Pop[i], 1000);
+            if(i > 0) {
+                ASSERT_GT(spike_Pop[i], spike_Pop[i - 1]);
+            }
+        }
+
+        prevSpikeCount = spikeCount_Pop;
+        numSpikes += spikeCount_Pop;
+    }
+
+    // 1000 neurons firing at 20Hz for 1s should emit around 20000 spikes
+    EXPECT_GT(numSpikes, 19000);
+    EXPECT_LT(numSpikes, 21000);
+}
@@ -0,0 +1,48 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_vectorised_update/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "neuron_vectorised_update_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, NeuronVectorisedUpdate)
+{
+    for(unsigned int s = 0; s < 10; s++) {
+        const scalar time = t;
+        StepGeNN();
+
+        // Check every neuron has been updated
+        for(unsigned int i = 0; i < 200; i++) {
+            ASSERT_FLOAT_EQ(xPop[i], time);
+        }
+
+        // Check every third neuron spiked and spikes were compacted in order
+        unsigned int j = 0;
+        for(unsigned int i = 0; i < 200; i++) {
+            if(((s + i) % 3) == 0) {
+                ASSERT_LT(j, spikeCount_Pop);
+                ASSERT_EQ(spike_Pop[j++], i);
+            }
+        }
+        ASSERT_EQ(j, spikeCount_Pop);
+    }
+}
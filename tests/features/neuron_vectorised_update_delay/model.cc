@@ -0,0 +1,79 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_vectorised_update_delay/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(t);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("((unsigned int)round($(t) / DT) + $(id)) % 3 == 0");
+
+    SET_VARS({{"x", "scalar"}});
+
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// PostNeuron
+//----------------------------------------------------------------------------
+class PostNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PostNeuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(PostNeuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 0);
+
+    SET_SIM_CODE("$(addToInSyn, $(x_pre));\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    GENN_PREFERENCES.enableVectorisedNeuronUpdate = true;
+
+    model.setDT(0.1);
+    model.setName("neuron_vectorised_update_delay");
+
+    // **NOTE** population size is not a multiple of the block size so final block is partial
+    model.addNeuronPopulation<Neuron>("Pop", 200, {}, Neuron::VarValues(0.0));
+    model.addNeuronPopulation<PostNeuron>("Post", 200, {}, PostNeuron::VarValues(0.0));
+
+    // **NOTE** axonal delay means spikes and presynaptic variables are written to delay queues
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_GLOBALG, 3, "Pop", "Post",
+        {}, {},
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+
+    model.setPrecision(GENN_FLOAT);
+}
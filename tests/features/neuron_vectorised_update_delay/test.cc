@@ -0,0 +1,63 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_vectorised_update_delay/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "neuron_vectorised_update_delay_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, NeuronVectorisedUpdateDelay)
+{
+    // Spikes emitted in one timestep are delivered by the synapse update of the next timestep plus the axonal delay
+    const unsigned int delaySteps = 3 + 1;
+
+    std::vector<scalar> times;
+    for(unsigned int s = 0; s < 20; s++) {
+        times.push_back(t);
+        StepGeNN();
+
+        // Check every neuron has been updated and its state written to the current delay slot
+        for(unsigned int i = 0; i < 200; i++) {
+            ASSERT_FLOAT_EQ(xPop[(spkQuePtrPop * 200) + i], times[s]);
+        }
+
+        // Check every third neuron spiked and spikes were compacted in order into the current delay slot
+        unsigned int j = 0;
+        for(unsigned int i = 0; i < 200; i++) {
+            if(((s + i) % 3) == 0) {
+                ASSERT_LT(j, spikeCount_Pop);
+                ASSERT_EQ(spike_Pop[j++], i);
+            }
+        }
+        ASSERT_EQ(j, spikeCount_Pop);
+
+        // Check postsynaptic neurons received delayed spikes along with the presynaptic state when they were emitted
+        for(unsigned int i = 0; i < 200; i++) {
+            if(s >= delaySteps && ((s - delaySteps + i) % 3) == 0) {
+                ASSERT_FLOAT_EQ(xPost[i], times[s - delaySteps]);
+            }
+            else {
+                ASSERT_FLOAT_EQ(xPost[i], 0.0f);
+            }
+        }
+    }
+}
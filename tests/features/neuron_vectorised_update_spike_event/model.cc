@@ -0,0 +1,82 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_vectorised_update_spike_event/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 2);
+
+    SET_SIM_CODE(
+        "$(x)= $(t);\n"
+        "$(y)= (((unsigned int)round($(t) / DT) + $(id)) % 2 == 0) ? 1.0 : 0.0;\n");
+
+    SET_THRESHOLD_CONDITION_CODE("((unsigned int)round($(t) / DT) + $(id)) % 3 == 0");
+
+    SET_VARS({{"x", "scalar"}, {"y", "scalar"}});
+
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// PostNeuron
+//----------------------------------------------------------------------------
+class PostNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PostNeuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(PostNeuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 0);
+
+    SET_EVENT_THRESHOLD_CONDITION_CODE("$(y_pre) > 0.5");
+    SET_EVENT_CODE("$(addToInSyn, $(y_pre));\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    GENN_PREFERENCES.enableVectorisedNeuronUpdate = true;
+
+    model.setDT(0.1);
+    model.setName("neuron_vectorised_update_spike_event");
+
+    // **NOTE** population size is not a multiple of the block size so final block is partial
+    model.addNeuronPopulation<Neuron>("Pop", 200, {}, Neuron::VarValues(0.0, 0.0));
+    model.addNeuronPopulation<PostNeuron>("Post", 200, {}, PostNeuron::VarValues(0.0));
+
+    // **NOTE** event threshold condition means spike-like events are detected in the neuron update
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_GLOBALG, NO_DELAY, "Pop", "Post",
+        {}, {},
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,68 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_vectorised_update_spike_event/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "neuron_vectorised_update_spike_event_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, NeuronVectorisedUpdateSpikeEvent)
+{
+    for(unsigned int s = 0; s < 10; s++) {
+        const scalar time = t;
+        StepGeNN();
+
+        // Check every neuron has been updated
+        for(unsigned int i = 0; i < 200; i++) {
+            ASSERT_FLOAT_EQ(xPop[i], time);
+        }
+
+        // Check every third neuron spiked and spikes were compacted in order
+        unsigned int j = 0;
+        for(unsigned int i = 0; i < 200; i++) {
+            if(((s + i) % 3) == 0) {
+                ASSERT_LT(j, spikeCount_Pop);
+                ASSERT_EQ(spike_Pop[j++], i);
+            }
+        }
+        ASSERT_EQ(j, spikeCount_Pop);
+
+        // Check every second neuron emitted a spike-like event and these were compacted in order
+        unsigned int k = 0;
+        for(unsigned int i = 0; i < 200; i++) {
+            if(((s + i) % 2) == 0) {
+                ASSERT_LT(k, spikeEventCount_Pop);
+                ASSERT_EQ(spikeEvent_Pop[k++], i);
+            }
+        }
+        ASSERT_EQ(k, spikeEventCount_Pop);
+
+        // Check postsynaptic neurons received the spike-like events emitted in the previous timestep
+        for(unsigned int i = 0; i < 200; i++) {
+            if(s > 0 && ((s - 1 + i) % 2) == 0) {
+                ASSERT_FLOAT_EQ(xPost[i], 1.0f);
+            }
+            else {
+                ASSERT_FLOAT_EQ(xPost[i], 0.0f);
+            }
+        }
+    }
+}
@@ -0,0 +1,63 @@
+//--------------------------------------------------------------------------
+/*! \file reentrant_model/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Pre
+//----------------------------------------------------------------------------
+class Pre : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Pre, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(Pre);
+
+//----------------------------------------------------------------------------
+// Post
+//----------------------------------------------------------------------------
+class Post : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Post, 0, 1);
+
+    SET_SIM_CODE("$(x) += $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Post);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    // Give every thread its own instance of the model
+    GENN_PREFERENCES.enableReentrantModel = true;
+
+    model.setDT(0.1);
+    model.setName("reentrant_model");
+
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(1.0);
+
+    model.addNeuronPopulation<Pre>("Pre", 10, {}, {});
+    model.addNeuronPopulation<Post>("Post", 10, {}, Post::VarValues(0.0));
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+
+    model.setPrecision(GENN_FLOAT);
+}
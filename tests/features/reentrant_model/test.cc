@@ -0,0 +1,118 @@
+//--------------------------------------------------------------------------
+/*! \file reentrant_model/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <array>
+#include <stdexcept>
+#include <thread>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "reentrant_model_CODE/definitions.h"
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+constexpr unsigned int numInstances = 4;
+
+//----------------------------------------------------------------------------
+// InstanceResult
+//----------------------------------------------------------------------------
+struct InstanceResult
+{
+    float t;
+    unsigned long long iT;
+    std::array<scalar, 10> x;
+};
+
+void simulateInstance(unsigned int instance, InstanceResult &result)
+{
+    // Create this thread's instance of the model
+    allocateMem();
+    initialize();
+    initializeSparse();
+
+    // Give synapses in each instance a different weight
+    for(unsigned int i = 0; i < 10; i++) {
+        gSyn[i] = (scalar)(instance + 1);
+    }
+    pushSynStateToDevice();
+
+    // Simulate a different number of timesteps in each instance
+    for(unsigned int s = 0; s <= instance; s++) {
+        stepTime();
+    }
+    pullPostStateFromDevice();
+
+    // Copy out results before instance is destroyed
+    result.t = t;
+    result.iT = iT;
+    std::copy_n(xPost, 10, result.x.begin());
+    freeMem();
+}
+}   // Anonymous namespace
+
+TEST(ReentrantModel, IndependentInstances)
+{
+    // Simulate each instance of the model on its own thread
+    std::array<InstanceResult, numInstances> results;
+    std::array<std::thread, numInstances> threads;
+    for(unsigned int i = 0; i < numInstances; i++) {
+        threads[i] = std::thread(simulateInstance, i, std::ref(results[i]));
+    }
+    for(auto &t : threads) {
+        t.join();
+    }
+
+    // Check neither time nor state leaked between instances
+    for(unsigned int i = 0; i < numInstances; i++) {
+        ASSERT_EQ(results[i].iT, i + 1);
+        ASSERT_FLOAT_EQ(results[i].t, 0.1f * (float)(i + 1));
+
+        // Pre fires every timestep and spikes arrive at Post in the same timestep
+        // so, in the first timestep, Post receives no input
+        for(unsigned int j = 0; j < 10; j++) {
+            ASSERT_FLOAT_EQ(results[i].x[j], (scalar)(i * (i + 1)));
+        }
+    }
+}
+
+TEST(ReentrantModel, UnallocatedThread)
+{
+    // Allocate an instance of the model on this thread
+    allocateMem();
+    initialize();
+
+    // Check that using the model from a thread which hasn't allocated its own instance throws
+    bool stepThrew = false;
+    bool initThrew = false;
+    bool freeThrew = false;
+    std::thread thread(
+        [&stepThrew, &initThrew, &freeThrew]()
+        {
+            try { stepTime(); } catch(const std::runtime_error&) { stepThrew = true; }
+            try { initialize(); } catch(const std::runtime_error&) { initThrew = true; }
+            try { freeMem(); } catch(const std::runtime_error&) { freeThrew = true; }
+        });
+    thread.join();
+    ASSERT_TRUE(stepThrew);
+    ASSERT_TRUE(initThrew);
+    ASSERT_TRUE(freeThrew);
+
+    // Check allocating twice on the same thread throws but this thread's instance is still usable
+    ASSERT_THROW(allocateMem(), std::runtime_error);
+    stepTime();
+    ASSERT_EQ(iT, 1);
+    freeMem();
+
+    // Check instance can't be used once freed
+    ASSERT_THROW(stepTime(), std::runtime_error);
+}
@@ -0,0 +1,79 @@
+//--------------------------------------------------------------------------
+/*! \file sparse_init_counter_based/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 1);
+
+    SET_VARS({{"w", "scalar"}});
+
+    // **NOTE** postsynaptic learning code is only required so column-major remapping gets built
+    SET_LEARN_POST_CODE("$(w) = $(w);");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+//----------------------------------------------------------------------------
+// FixedProbability
+//----------------------------------------------------------------------------
+//! Same as InitSparseConnectivitySnippet::FixedProbability but without a maximum
+//! column length calculation so the stride of the column-major remapping can be fixed
+class FixedProbability : public InitSparseConnectivitySnippet::Base
+{
+public:
+    DECLARE_SNIPPET(FixedProbability, 1);
+
+    SET_ROW_BUILD_CODE(
+        "const scalar u = $(gennrand_uniform);\n"
+        "prevJ += (1 + (int)(log(u) * $(probLogRecip)));\n"
+        "if(prevJ < $(num_post)) {\n"
+        "   $(addSynapse, prevJ + $(id_post_begin));\n"
+        "}\n"
+        "else {\n"
+        "   $(endRow);\n"
+        "}\n");
+    SET_ROW_BUILD_STATE_VARS({{"prevJ", "int", -1}});
+
+    SET_PARAM_NAMES({"prob"});
+    SET_DERIVED_PARAMS({{"probLogRecip", [](const std::vector<double> &pars, double){ return 1.0 / log(1.0 - pars[0]); }}});
+
+    SET_CALC_MAX_ROW_LENGTH_FUNC([](unsigned int, unsigned int numPost, const std::vector<double> &){ return numPost; });
+};
+IMPLEMENT_SNIPPET(FixedProbability);
+
+void modelDefinition(ModelSpec &model)
+{
+    GENN_PREFERENCES.enableCounterBasedRNG = true;
+
+    model.setDT(0.1);
+    model.setName("sparse_init_counter_based");
+    model.setSeed(1234);
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 1000, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Post", 500, {}, {});
+
+    InitVarSnippet::Uniform::ParamValues uniformParams(0.0, 1.0);
+    FixedProbability::ParamValues fixedProbParams(0.1);
+    auto *syn = model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, WeightUpdateModel::VarValues(initVar<InitVarSnippet::Uniform>(uniformParams)),
+        {}, {},
+        initConnectivity<FixedProbability>(fixedProbParams));
+
+    // **NOTE** stride of column-major remapping isn't exported so fix it for the test
+    syn->setMaxSourceConnections(1000);
+
+    model.setPrecision(GENN_FLOAT);
+}
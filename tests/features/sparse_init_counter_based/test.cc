@@ -0,0 +1,89 @@
+//--------------------------------------------------------------------------
+/*! \file sparse_init_counter_based/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "sparse_init_counter_based_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+#include "../../utils/stats.h"
+
+// Column-major remapping is internal to the runner
+extern unsigned int *colLengthSyn;
+extern unsigned int *remapSyn;
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, SparseInitCounterBased)
+{
+    pullSynStateFromDevice();
+    pullSynConnectivityFromDevice();
+
+    // Check number of synapses is close to that expected from connection probability
+    const unsigned int numSynapses = std::accumulate(&rowLengthSyn[0], &rowLengthSyn[1000], 0u);
+    EXPECT_NEAR(numSynapses / (1000.0 * 500.0), 0.1, 0.005);
+
+    // Check that each row's postsynaptic indices are sorted and in range and gather weights
+    std::vector<double> weights;
+    for(unsigned int i = 0; i < 1000; i++) {
+        const unsigned int *rowBegin = &indSyn[i * maxRowLengthSyn];
+        const unsigned int *rowEnd = rowBegin + rowLengthSyn[i];
+        EXPECT_TRUE(std::is_sorted(rowBegin, rowEnd));
+        EXPECT_TRUE(std::all_of(rowBegin, rowEnd, [](unsigned int j){ return (j < 500); }));
+        std::copy(&wSyn[i * maxRowLengthSyn], &wSyn[(i * maxRowLengthSyn) + rowLengthSyn[i]], std::back_inserter(weights));
+    }
+
+    // Check weights are uniformly distributed
+    double d;
+    double prob;
+    std::tie(d, prob) = Stats::kolmogorovSmirnovTest(weights, Stats::uniformCDF);
+    EXPECT_GT(prob, 0.02);
+
+    // Check that column-major remapping contains each synapse once, in row-major order
+    unsigned int numRemapped = 0;
+    for(unsigned int j = 0; j < 500; j++) {
+        for(unsigned int c = 0; c < colLengthSyn[j]; c++) {
+            const unsigned int rowMajorIndex = remapSyn[(j * 1000) + c];
+            EXPECT_EQ(indSyn[rowMajorIndex], j);
+            if(c > 0) {
+                EXPECT_LT(remapSyn[(j * 1000) + c - 1], rowMajorIndex);
+            }
+        }
+        numRemapped += colLengthSyn[j];
+    }
+    EXPECT_EQ(numRemapped, numSynapses);
+
+    // Re-initialise and check that identical connectivity and weights are generated
+    const std::vector<unsigned int> rowLength(&rowLengthSyn[0], &rowLengthSyn[1000]);
+    const std::vector<unsigned int> ind(&indSyn[0], &indSyn[1000 * maxRowLengthSyn]);
+    const std::vector<scalar> w(&wSyn[0], &wSyn[1000 * maxRowLengthSyn]);
+    initialize();
+    initializeSparse();
+    pullSynStateFromDevice();
+    pullSynConnectivityFromDevice();
+    for(unsigned int i = 0; i < 1000; i++) {
+        ASSERT_EQ(rowLengthSyn[i], rowLength[i]);
+        for(unsigned int s = 0; s < rowLength[i]; s++) {
+            ASSERT_EQ(indSyn[(i * maxRowLengthSyn) + s], ind[(i * maxRowLengthSyn) + s]);
+            ASSERT_EQ(wSyn[(i * maxRowLengthSyn) + s], w[(i * maxRowLengthSyn) + s]);
+        }
+    }
+}
@@ -0,0 +1,42 @@
+//--------------------------------------------------------------------------
+/*! \file spike_recording/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("((unsigned int)round($(t) / DT) + $(id)) % 3 == 0");
+
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("spike_recording");
+
+    // **NOTE** population sizes are not multiples of 32 so final recording words are partial
+    // and populations with recording enabled are merged so each uses its own recording buffer
+    auto *pop1 = model.addNeuronPopulation<Neuron>("Pop1", 100, {}, {});
+    auto *pop2 = model.addNeuronPopulation<Neuron>("Pop2", 50, {}, {});
+    model.addNeuronPopulation<Neuron>("Pop3", 20, {}, {});
+    pop1->setSpikeRecordingEnabled(true);
+    pop2->setSpikeRecordingEnabled(true);
+
+    model.setPrecision(GENN_FLOAT);
+}
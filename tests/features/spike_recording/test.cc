@@ -0,0 +1,67 @@
+//--------------------------------------------------------------------------
+/*! \file spike_recording/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "spike_recording_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+protected:
+    //--------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //--------------------------------------------------------------------------
+    virtual void Init()
+    {
+        allocateRecordingBuffers(4);
+    }
+};
+
+void checkRecording(const uint32_t *recordSpk, unsigned int numNeurons, unsigned int startTimestep)
+{
+    // Loop through timesteps in recording buffer
+    const unsigned int numWords = (numNeurons + 31) / 32;
+    for(unsigned int r = 0; r < 4; r++) {
+        const uint32_t *words = &recordSpk[r * numWords];
+
+        // Check every third neuron's bit is set
+        for(unsigned int i = 0; i < numNeurons; i++) {
+            const bool spiked = (words[i / 32] & (1u << (i % 32))) != 0;
+            ASSERT_EQ(spiked, ((startTimestep + r + i) % 3) == 0);
+        }
+
+        // Check bits beyond end of population are clear
+        for(unsigned int i = numNeurons; i < (numWords * 32); i++) {
+            ASSERT_EQ(words[i / 32] & (1u << (i % 32)), 0u);
+        }
+    }
+}
+
+TEST_F(SimTest, SpikeRecording)
+{
+    // Simulate twice through recording buffer so timesteps are re-used
+    for(unsigned int b = 0; b < 2; b++) {
+        for(unsigned int s = 0; s < 4; s++) {
+            StepGeNN();
+        }
+
+        pullRecordingBuffersFromDevice();
+        checkRecording(recordSpkPop1, 100, b * 4);
+        checkRecording(recordSpkPop2, 50, b * 4);
+    }
+}
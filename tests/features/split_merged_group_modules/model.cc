@@ -0,0 +1,88 @@
+//--------------------------------------------------------------------------
+/*! \file split_merged_group_modules/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Pre
+//----------------------------------------------------------------------------
+class Pre : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Pre, 0, 1);
+
+    SET_THRESHOLD_CONDITION_CODE("$(id) == (unsigned int)$(s)");
+
+    SET_VARS({{"s", "scalar"}});
+
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(Pre);
+
+//----------------------------------------------------------------------------
+// Post
+//----------------------------------------------------------------------------
+class Post : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Post, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Post);
+
+//----------------------------------------------------------------------------
+// Counter
+//----------------------------------------------------------------------------
+class Counter : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(Counter, 0, 2, 0, 0);
+
+    SET_VARS({{"g", "scalar"}, {"c", "scalar"}});
+
+    SET_SIM_CODE("$(addToInSyn, $(g));\n");
+    SET_SYNAPSE_DYNAMICS_CODE("$(c) += 1.0;\n");
+};
+
+IMPLEMENT_MODEL(Counter);
+
+void modelDefinition(ModelSpec &model)
+{
+    GENN_PREFERENCES.splitMergedGroupModules = true;
+
+    model.setDT(0.1);
+    model.setName("split_merged_group_modules");
+
+    Counter::VarValues counterInit(1.0, 0.0);
+
+    // **NOTE** pairs of populations are merged so merged groups contain more than one group
+    model.addNeuronPopulation<Pre>("Pre1", 10, {}, Pre::VarValues(0.0));
+    model.addNeuronPopulation<Pre>("Pre2", 10, {}, Pre::VarValues(0.0));
+    model.addNeuronPopulation<Post>("Post1", 10, {}, Post::VarValues(0.0));
+    model.addNeuronPopulation<Post>("Post2", 10, {}, Post::VarValues(0.0));
+
+    // **NOTE** delay means presynaptic spikes are read from a spike queue
+    model.addSynapsePopulation<Counter, PostsynapticModels::DeltaCurr>(
+        "Syn1", SynapseMatrixType::SPARSE_INDIVIDUALG, 2, "Pre1", "Post1",
+        {}, counterInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+    model.addSynapsePopulation<Counter, PostsynapticModels::DeltaCurr>(
+        "Syn2", SynapseMatrixType::SPARSE_INDIVIDUALG, 2, "Pre2", "Post2",
+        {}, counterInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+
+    model.setPrecision(GENN_FLOAT);
+}
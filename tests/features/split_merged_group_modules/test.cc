@@ -0,0 +1,67 @@
+//--------------------------------------------------------------------------
+/*! \file split_merged_group_modules/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "split_merged_group_modules_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, SplitMergedGroupModules)
+{
+    // Check connectivity and weights have been initialised
+    for(unsigned int i = 0; i < 10; i++) {
+        ASSERT_EQ(rowLengthSyn1[i], 1);
+        ASSERT_EQ(indSyn1[i], i);
+        ASSERT_EQ(rowLengthSyn2[i], 1);
+        ASSERT_EQ(indSyn2[i], i);
+        ASSERT_FLOAT_EQ(gSyn1[i], 1.0f);
+        ASSERT_FLOAT_EQ(gSyn2[i], 1.0f);
+    }
+
+    // Make a different presynaptic neuron spike in each population and give synapses different weights
+    for(unsigned int i = 0; i < 10; i++) {
+        sPre1[i] = 3.0f;
+        sPre2[i] = 7.0f;
+        gSyn1[i] = 2.0f;
+        gSyn2[i] = 3.0f;
+    }
+    pushPre1StateToDevice();
+    pushPre2StateToDevice();
+    pushSyn1StateToDevice();
+    pushSyn2StateToDevice();
+
+    // Spikes emitted in the first timestep arrive after two timesteps of axonal delay
+    for(unsigned int s = 0; s < 4; s++) {
+        StepGeNN();
+    }
+
+    // Check each postsynaptic population only receives input from its own presynaptic population
+    for(unsigned int j = 0; j < 10; j++) {
+        ASSERT_FLOAT_EQ(xPost1[j], (j == 3) ? 2.0f : 0.0f);
+        ASSERT_FLOAT_EQ(xPost2[j], (j == 7) ? 3.0f : 0.0f);
+    }
+
+    // Check synapse dynamics have run every timestep
+    for(unsigned int i = 0; i < 10; i++) {
+        ASSERT_FLOAT_EQ(cSyn1[i], 4.0f);
+        ASSERT_FLOAT_EQ(cSyn2[i], 4.0f);
+    }
+}
@@ -0,0 +1,70 @@
+//--------------------------------------------------------------------------
+/*! \file synapse_procedural_rng_repeat/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Pre
+//----------------------------------------------------------------------------
+class Pre : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Pre, 0, 1);
+
+    SET_SIM_CODE("$(s) = 1.0 - $(s);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("$(s) > 0.5");
+
+    SET_VARS({{"s", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Pre);
+
+//----------------------------------------------------------------------------
+// Post
+//----------------------------------------------------------------------------
+class Post : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Post, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Post);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("synapse_procedural_rng_repeat");
+    model.setSeed(1234);
+
+    InitSparseConnectivitySnippet::FixedProbability::ParamValues fixedProbParams(0.1); // 0 - prob
+
+    InitVarSnippet::Uniform::ParamValues uniformParams(
+        0.0,    // 0 - min
+        1.0);   // 1 - max
+
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(initVar<InitVarSnippet::Uniform>(uniformParams));
+
+    // Every presynaptic neuron spikes every other timestep
+    model.addNeuronPopulation<Pre>("Pre", 100, {}, Pre::VarValues(0.0));
+    model.addNeuronPopulation<Post>("Post", 100, {}, Post::VarValues(0.0));
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::PROCEDURAL_PROCEDURALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProbParams));
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,57 @@
+//--------------------------------------------------------------------------
+/*! \file synapse_procedural_rng_repeat/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "synapse_procedural_rng_repeat_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, SynapseProceduralRngRepeat)
+{
+    // Presynaptic spikes emitted in the first timestep arrive in the second
+    StepGeNN();
+    StepGeNN();
+
+    // Take copy of input received by each postsynaptic neuron
+    const std::vector<scalar> firstX(xPost, xPost + 100);
+
+    // Check that, on average, each postsynaptic neuron receives 10 synapses with a mean weight of 0.5
+    const scalar meanX = std::accumulate(firstX.cbegin(), firstX.cend(), scalar(0.0)) / scalar(100.0);
+    EXPECT_GT(meanX, 4.0);
+    EXPECT_LT(meanX, 6.0);
+
+    // Check that some variation in input is present i.e. rows aren't all generated identically
+    const auto minMaxX = std::minmax_element(firstX.cbegin(), firstX.cend());
+    EXPECT_LT(*minMaxX.first, *minMaxX.second);
+
+    // As the same rows are regenerated every time presynaptic neurons spike, input should be identical each time
+    // **NOTE** order of accumulation may vary if synaptic input is accumulated in parallel
+    for(unsigned int t = 0; t < 10; t++) {
+        StepGeNN();
+        StepGeNN();
+        for(unsigned int i = 0; i < 100; i++) {
+            EXPECT_NEAR(xPost[i], firstX[i], 1E-4);
+        }
+    }
+}
@@ -0,0 +1,79 @@
+//--------------------------------------------------------------------------
+/*! \file tiled_sparse_layout/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// PreNeuron
+//----------------------------------------------------------------------------
+class PreNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PreNeuron, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("fabs($(t) - (scalar)$(id)) < 1e-4");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(PreNeuron);
+
+//----------------------------------------------------------------------------
+// PostNeuron
+//----------------------------------------------------------------------------
+class PostNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PostNeuron, 0, 1);
+
+    SET_SIM_CODE("$(x) += $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(PostNeuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(WeightUpdateModel, 0, 3, 0, 0);
+
+    SET_VARS({{"g", "scalar"}, {"n", "scalar"}, {"d", "scalar"}});
+
+    SET_SIM_CODE(
+        "$(addToInSyn, $(g));\n"
+        "$(n) += 1.0;\n");
+    SET_SYNAPSE_DYNAMICS_CODE("$(d) += $(g);\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("tiled_sparse_layout");
+
+    // **NOTE** postsynaptic population has 10 neurons so it is split into 4 tiles, the last of which is partial
+    GENN_PREFERENCES.postsynapticTileSize = 3;
+
+    model.addNeuronPopulation<PreNeuron>("Pre", 22, {}, {});
+    model.addNeuronPopulation<PostNeuron>("Post", 10, {}, PostNeuron::VarValues(0.0));
+
+    // **NOTE** g is uninitialised so it is set row-major by the test and then tiled by initializeSparse
+    WeightUpdateModel::VarValues varValues(uninitialisedVar(), 0.0, 0.0);
+    auto *syn = model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, varValues,
+        {}, {});
+    syn->setMaxConnections(10);
+
+    model.setPrecision(GENN_FLOAT);
+}
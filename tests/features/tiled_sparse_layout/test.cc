@@ -0,0 +1,103 @@
+//--------------------------------------------------------------------------
+/*! \file tiled_sparse_layout/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+#include "tiled_sparse_layout_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Rows have lengths between 0 and 10 in no particular order
+unsigned int getRowLength(unsigned int i)
+{
+    return (i * 7) % 11;
+}
+
+// Position j of row i targets postsynaptic neuron (i + 3j) % 10
+unsigned int getPostIndex(unsigned int i, unsigned int j)
+{
+    return (i + (3 * j)) % 10;
+}
+
+scalar getWeight(unsigned int i, unsigned int j)
+{
+    return (scalar)((i * 10) + getPostIndex(i, j) + 1);
+}
+}   // Anonymous namespace
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Build connectivity and weights in the usual row-major layout
+        for(unsigned int i = 0; i < 22; i++) {
+            rowLengthSyn[i] = getRowLength(i);
+            for(unsigned int j = 0; j < rowLengthSyn[i]; j++) {
+                indSyn[(i * maxRowLengthSyn) + j] = getPostIndex(i, j);
+                gSyn[(i * maxRowLengthSyn) + j] = getWeight(i, j);
+            }
+        }
+    }
+};
+
+TEST_F(SimTest, TiledSparseLayout)
+{
+    // Each presynaptic neuron spikes once, at time equal to its index
+    while(t < 23.0f) {
+        StepGeNN();
+    }
+
+    // Loop through tiles and the rows within them
+    scalar expectedX[10] = {};
+    unsigned int numSynapses = 0;
+    for(unsigned int tile = 0; tile < 4; tile++) {
+        for(unsigned int i = 0; i < 22; i++) {
+            // Check row is unchanged
+            ASSERT_EQ(rowLengthSyn[i], getRowLength(i));
+
+            // Check the synapses of this row which target this tile are stored contiguously, in their original order
+            unsigned int idx = tileRowPtrSyn[(tile * 22) + i];
+            ASSERT_EQ(idx, numSynapses);
+            for(unsigned int j = 0; j < rowLengthSyn[i]; j++) {
+                if((getPostIndex(i, j) / 3) == tile) {
+                    ASSERT_EQ(indSyn[idx], getPostIndex(i, j));
+                    ASSERT_EQ(gSyn[idx], getWeight(i, j));
+
+                    // Check presynaptic update was applied once and synapse dynamics every timestep
+                    ASSERT_EQ(nSyn[idx], 1.0f);
+                    ASSERT_EQ(dSyn[idx], 23.0f * getWeight(i, j));
+
+                    expectedX[getPostIndex(i, j)] += getWeight(i, j);
+                    idx++;
+                }
+            }
+            numSynapses = idx;
+        }
+    }
+    ASSERT_EQ(tileRowPtrSyn[4 * 22], numSynapses);
+
+    // Check each postsynaptic neuron received input through every synapse
+    for(unsigned int j = 0; j < 10; j++) {
+        ASSERT_EQ(xPost[j], expectedX[j]);
+    }
+}
@@ -6,11 +6,14 @@ REPORT=0
 
 # Parse command line arguments
 OPTIND=1
-while getopts "crd" opt; do
+while getopts "cprd" opt; do
     case "$opt" in
     c)  BUILD_FLAGS="-c";
         BACKEND="SingleThreadedCPU"
         ;;
+    p)  BUILD_FLAGS="-p";
+        BACKEND="OpenMP"
+        ;;
     r) REPORT=1
         ;;
     d) source /opt/rh/devtoolset-6/enable
@@ -51,6 +51,32 @@ TEST(EnsureMathFunctionFtype, rint) {
     ASSERT_EQ(substitutedCode, "$(value) = (uint8_t)rintf(normal / DT);");
 }
 
+// Test that maths functions are only substituted when called, with optional whitespace before the bracket
+TEST(EnsureMathFunctionFtype, FunctionCallOnly) {
+    const std::string code = "scalar exp = 2.0; $(value) = exp (sin(exp)) + mysin(1.0) + sin_x;";
+
+    std::string substitutedCode = ensureFtype(code, "float");
+    ASSERT_EQ(substitutedCode, "scalar exp = 2.0f; $(value) = expf (sinf(exp)) + mysin(1.0f) + sin_x;");
+}
+
+// Test that adjacent variables separated by a single character are both substituted
+TEST(RegexVarSubstitute, Adjacent) {
+    std::string code = "a*a+aa";
+
+    ASSERT_TRUE(regexVarSubstitute(code, "a", "b"));
+    ASSERT_EQ(code, "b*b+aa");
+}
+
+TEST(CheckUnreplacedVariables, Unreplaced) {
+    try {
+        checkUnreplacedVariables("$(x) = $(y) + $(0) + $(func, 1.0);", "test");
+        FAIL();
+    }
+    catch(const std::runtime_error &e) {
+        ASSERT_EQ(std::string(e.what()), "The variables x, y, 0 were undefined in code test.");
+    }
+}
+
 //--------------------------------------------------------------------------
 // SingleValueSubstitutionTest
 //--------------------------------------------------------------------------
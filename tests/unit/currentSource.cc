@@ -59,6 +59,33 @@ TEST(CurrentSource, CompareDifferentParameters)
     ASSERT_FALSE(cs1Internal->canBeMerged(*cs0));
 }
 
+TEST(CurrentSource, CompareDynamicParameters)
+{
+    ModelSpecInternal model;
+
+    // Add neuron group to model
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 10, paramVals, varVals);
+
+    // Add two gaussian current sources with different, dynamic standard deviations
+    CurrentSourceModels::GaussianNoise::ParamValues cs0ParamVals(0.0, 0.1);
+    CurrentSource *cs0 = model.addCurrentSource<CurrentSourceModels::GaussianNoise>("CS0", "Neurons0",
+                                                                                   cs0ParamVals, {});
+    CurrentSourceModels::GaussianNoise::ParamValues cs1ParamVals(0.0, 0.5);
+    CurrentSource *cs1 = model.addCurrentSource<CurrentSourceModels::GaussianNoise>("CS1", "Neurons0",
+                                                                                    cs1ParamVals, {});
+    cs0->setParamDynamic("sd");
+    cs1->setParamDynamic("sd");
+
+    // Finalize model
+    model.finalize();
+
+    CurrentSourceInternal *cs1Internal = static_cast<CurrentSourceInternal*>(cs1);
+    ASSERT_TRUE(cs1Internal->canBeMerged(*cs0));
+    ASSERT_EQ(cs1Internal->getHashDigest(), static_cast<CurrentSourceInternal*>(cs0)->getHashDigest());
+}
+
 TEST(CurrentSource, CompareSameParameters)
 {
     ModelSpecInternal model;
@@ -83,4 +110,26 @@ TEST(CurrentSource, CompareSameParameters)
 
     CurrentSourceInternal *cs1Internal = static_cast<CurrentSourceInternal*>(cs1);
     ASSERT_TRUE(cs1Internal->canBeMerged(*cs0));
+    ASSERT_EQ(cs1Internal->getHashDigest(), static_cast<CurrentSourceInternal*>(cs0)->getHashDigest());
+}
+
+TEST(CurrentSource, DynamicParamsUsedByDerivedParams)
+{
+    ModelSpecInternal model;
+
+    // Add neuron group to model
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 10, paramVals, varVals);
+
+    // Add Poisson current source
+    CurrentSourceModels::PoissonExp::ParamValues csParamVals(0.1, 5.0, 10.0);
+    CurrentSourceModels::PoissonExp::VarValues csVarVals(0.0);
+    CurrentSource *cs = model.addCurrentSource<CurrentSourceModels::PoissonExp>("CS0", "Neurons0",
+                                                                                csParamVals, csVarVals);
+
+    // All of the Poisson current source's parameters are used to calculate derived parameters
+    EXPECT_THROW(cs->setParamDynamic("weight"), std::runtime_error);
+    EXPECT_THROW(cs->setParamDynamic("tauSyn"), std::runtime_error);
+    EXPECT_THROW(cs->setParamDynamic("rate"), std::runtime_error);
 }
@@ -0,0 +1,165 @@
+// Google test includes
+#include "gtest/gtest.h"
+
+// GeNN code generator includes
+#include "code_generator/expressionParser.h"
+
+using namespace CodeGenerator::ExpressionParser;
+
+//--------------------------------------------------------------------------
+// Tests
+//--------------------------------------------------------------------------
+TEST(ExpressionParser, Tokenise)
+{
+    const auto tokens = tokenise("x+=1.5e-3f*y; // comment\n/* comment */ s = \"a;b\";");
+    const std::vector<std::string> expected{"x", "+=", "1.5e-3f", "*", "y", ";", "s", "=", "\"a;b\"", ";"};
+    ASSERT_EQ(tokens.size(), expected.size());
+    for(size_t i = 0; i < tokens.size(); i++) {
+        ASSERT_EQ(tokens[i].text, expected[i]);
+    }
+}
+//--------------------------------------------------------------------------
+TEST(ExpressionParser, Precedence)
+{
+    const auto tokens = tokenise("1 + 2 * 3 - 4");
+    size_t pos = 0;
+    const auto expression = parseExpression(tokens, pos);
+    ASSERT_TRUE(expression);
+    ASSERT_EQ(pos, tokens.size());
+    ASSERT_EQ(expression->type, Node::Type::Binary);
+    ASSERT_EQ(expression->op, "-");
+
+    Constant value;
+    ASSERT_TRUE(evaluate(*expression, value));
+    ASSERT_EQ(value.type, Constant::Type::Int);
+    ASSERT_EQ(value.intValue, 3);
+}
+//--------------------------------------------------------------------------
+TEST(ExpressionParser, Unterminated)
+{
+    // Declarations aren't expressions
+    const auto tokens = tokenise("const scalar x = 1;");
+    size_t pos = 0;
+    ASSERT_FALSE(parseExpression(tokens, pos));
+    ASSERT_EQ(pos, 0);
+}
+//--------------------------------------------------------------------------
+TEST(ExpressionParser, FoldFloat)
+{
+    ASSERT_EQ(foldConstants("$(V) += (1.0f) * (2.0f) / (4.0f);"),
+              "$(V) += (5.000000000e-01f);");
+    ASSERT_EQ(foldConstants("const scalar a = exp(-DT / ((2.0f) * (5.0f)));"),
+              "const scalar a = exp(-DT / (1.000000000e+01f));");
+}
+//--------------------------------------------------------------------------
+TEST(ExpressionParser, FoldPromotion)
+{
+    // Integer division truncates, mixed expressions are promoted and the ternary operator has the common type
+    ASSERT_EQ(foldConstants("a = 1 / 2; b = 1.0 / 2; c = 1 ? 2 : 3.0f;"),
+              "a = (0); b = (5.00000000000000000e-01); c = (2.000000000e+00f);");
+
+    // Single precision expressions are evaluated in single precision
+    ASSERT_EQ(foldConstants("x = 0.1f * 3.0f;"), "x = (3.000000119e-01f);");
+}
+//--------------------------------------------------------------------------
+TEST(ExpressionParser, NoReorder)
+{
+    // Floating point arithmetic isn't associative so only sub-expressions involving just literals are folded
+    const std::string code = "x = x - (1.0f) - (2.0f); y = DT * (2.0f) * (3.0f);";
+    ASSERT_EQ(foldConstants(code), code);
+}
+//--------------------------------------------------------------------------
+TEST(ExpressionParser, NoFold)
+{
+    // Casts, overflow, division by zero and unsupported literals are left alone
+    const std::string code = "x = (float)-1.0/3.0; y = 2147483647 + 1; z = 1.0f / 0.0f; w = 0x10 + 1; s = \"1 + 2\";";
+    ASSERT_EQ(foldConstants(code), code);
+}
+//--------------------------------------------------------------------------
+TEST(ExpressionParser, ShortCircuit)
+{
+    ASSERT_EQ(foldConstants("if((1.0f) > (2.0f) && update()) { }"), "if((0)) { }");
+    ASSERT_EQ(foldConstants("if(1 || update()) { }"), "if((1)) { }");
+    ASSERT_EQ(foldConstants("if(1 && update()) { }"), "if(1 && update()) { }");
+}
+//--------------------------------------------------------------------------
+TEST(ExpressionParser, FoldArguments)
+{
+    ASSERT_EQ(foldConstants("y = a.b[1 + 2]->c(3 * 4, -(1.0) * (2.0));"),
+              "y = a.b[3]->c(12, -2.00000000000000000e+00);");
+}
+//--------------------------------------------------------------------------
+TEST(ExpressionParser, FoldFunctionSubstitutionArguments)
+{
+    // **NOTE** arguments of function substitutions are bracketed as they may be inserted anywhere
+    ASSERT_EQ(foldConstants("$(addToInSyn, $(g) * (1.0f - 2.0f));"),
+              "$(addToInSyn, $(g) * (-1.000000000e+00f));");
+    ASSERT_EQ(foldConstants("$(addToInSyn, 1.0f - 2.0f);"),
+              "$(addToInSyn, (-1.000000000e+00f));");
+}
+//--------------------------------------------------------------------------
+TEST(ExpressionParser, ParseFunctionSubstitutionStatement)
+{
+    const std::string code = " $(addToInSyn, $(g) * ($(id_pre) == $(id_post) ? 1.0 : 2.0)) ;\n";
+    const auto call = parseFunctionSubstitutionStatement(code, "addToInSyn");
+    ASSERT_TRUE(call);
+    ASSERT_EQ(call->children.size(), 2);
+    ASSERT_EQ(code.substr(call->children[1]->begin, call->children[1]->end - call->children[1]->begin),
+              "$(g) * ($(id_pre) == $(id_post) ? 1.0 : 2.0)");
+
+    // Calls to other functions and code with other statements aren't
+    ASSERT_FALSE(parseFunctionSubstitutionStatement(code, "addToInSynDelay"));
+    ASSERT_FALSE(parseFunctionSubstitutionStatement("$(addToInSyn, $(g)); $(g) = 0.0;", "addToInSyn"));
+    ASSERT_FALSE(parseFunctionSubstitutionStatement("$(g) = 0.0;", "addToInSyn"));
+}
+//--------------------------------------------------------------------------
+TEST(ExpressionParser, HasSideEffects)
+{
+    const auto checkSideEffects =
+        [](const std::string &code)
+        {
+            const auto tokens = tokenise(code);
+            size_t pos = 0;
+            const auto expression = parseExpression(tokens, pos);
+            EXPECT_TRUE(expression);
+            return hasSideEffects(*expression, code);
+        };
+
+    ASSERT_FALSE(checkSideEffects("$(g) * exp(-$(V_pre) / 2.0f)"));
+    ASSERT_FALSE(checkSideEffects("($(x) >= 0.0) ? fmaxf($(x), $(y)) : $(a)[$(id_post)]"));
+    ASSERT_TRUE(checkSideEffects("$(g)++"));
+    ASSERT_TRUE(checkSideEffects("--$(g)"));
+    ASSERT_TRUE(checkSideEffects("frexp($(g), &e)"));
+    ASSERT_TRUE(checkSideEffects("getWeight($(g))"));
+    ASSERT_TRUE(checkSideEffects("$(g) * $(gennrand_uniform)"));
+    ASSERT_TRUE(checkSideEffects("$(gennrand_gamma, $(a))"));
+}
+//--------------------------------------------------------------------------
+TEST(ExpressionParser, RemoveDeadBranches)
+{
+    ASSERT_EQ(removeDeadBranches("if((0)) { x = 1; } else { x = 2; } y = 3;"), "{ x = 2; } y = 3;");
+    ASSERT_EQ(removeDeadBranches("if((1)) x = 1; else x = 2;"), "x = 1;");
+    ASSERT_EQ(removeDeadBranches("if((0.0f)) { x = 1; } y = 3;"), " y = 3;");
+
+    // Chains of if statements and nested dead branches
+    ASSERT_EQ(removeDeadBranches("if(0) x = 1; else if(a) x = 2; else x = 3;"), "if(a) x = 2; else x = 3;");
+    ASSERT_EQ(removeDeadBranches("if(1) { if(0) { x = 1; } y = 2; }"), "{  y = 2; }");
+
+    // Dead if statements which are the body of another statement are replaced with an empty block
+    ASSERT_EQ(removeDeadBranches("if(a) if(0) x = 1; else x = 2; y = 3;"), "if(a) x = 2; y = 3;");
+    ASSERT_EQ(removeDeadBranches("if(a) x = 1; else if(0) x = 2; y = 3;"), "if(a) x = 1; else {} y = 3;");
+    ASSERT_EQ(removeDeadBranches("for(i = 0; i < 4; i++) if(0) { x = 1; }"), "for(i = 0; i < 4; i++) {}");
+}
+//--------------------------------------------------------------------------
+TEST(ExpressionParser, KeepLiveBranches)
+{
+    // Non-constant conditions, loops and statements whose extent can't be found are left alone
+    const std::string code = "if(a > (1.0f)) { x = 1; } while(0) { x = 2; } if(1) { x = 3;";
+    ASSERT_EQ(removeDeadBranches(code), code);
+}
+//--------------------------------------------------------------------------
+TEST(ExpressionParser, Simplify)
+{
+    ASSERT_EQ(simplify("if((2.0f) > (3.0f)) { $(V) = (1.0f) + (2.0f); } else { $(V) += (1.0f) * (2.0f); }"),
+              "{ $(V) += (2.000000000e+00f); }");
+}
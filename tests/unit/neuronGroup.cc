@@ -31,6 +31,37 @@ public:
 };
 IMPLEMENT_MODEL(WeightUpdateModelPre);
 
+class SaturatingDerivedParams : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(SaturatingDerivedParams, 3, 1);
+
+    SET_SIM_CODE("$(V) += $(pSpike) + $(scale);\n");
+
+    SET_PARAM_NAMES({"rate", "gain", "offset"});
+    SET_VARS({{"V", "scalar"}});
+
+    // **NOTE** pSpike doesn't change for rates above 1000/dt
+    SET_DERIVED_PARAMS({
+        {"pSpike", [](const std::vector<double> &pars, double dt){ return std::min(1.0, pars[0] * dt / 1000.0); }, {"rate"}},
+        {"scale", [](const std::vector<double> &pars, double){ return (pars[1] > 0.0) ? pars[1] : 1.0; }}});
+};
+IMPLEMENT_MODEL(SaturatingDerivedParams);
+
+class UnknownDerivedParamDependency : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(UnknownDerivedParamDependency, 1, 1);
+
+    SET_SIM_CODE("$(V) += $(scale);\n");
+
+    SET_PARAM_NAMES({"gain"});
+    SET_VARS({{"V", "scalar"}});
+
+    SET_DERIVED_PARAMS({{"scale", [](const std::vector<double> &pars, double){ return pars[0]; }, {"gian"}}});
+};
+IMPLEMENT_MODEL(UnknownDerivedParamDependency);
+
 //--------------------------------------------------------------------------
 // Tests
 //--------------------------------------------------------------------------
@@ -103,7 +134,63 @@ TEST(NeuronGroup, CompareDifferentParams)
 
     NeuronGroupInternal *ng0Internal = static_cast<NeuronGroupInternal *>(ng0);
     ASSERT_TRUE(ng0Internal->canBeMerged(*ng1));
+    ASSERT_EQ(ng0Internal->getHashDigest(), static_cast<NeuronGroupInternal*>(ng1)->getHashDigest());
+    ASSERT_FALSE(ng0Internal->canBeMerged(*ng2));
+    ASSERT_NE(ng0Internal->getHashDigest(), static_cast<NeuronGroupInternal*>(ng2)->getHashDigest());
+}
+
+TEST(NeuronGroup, CompareDynamicParams)
+{
+    ModelSpecInternal model;
+
+    // Add four neuron groups to model, three with dynamic 'd' parameters
+    NeuronModels::Izhikevich::ParamValues paramValsA(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::ParamValues paramValsB(0.02, 0.2, -65.0, 4.0);
+    NeuronModels::Izhikevich::ParamValues paramValsC(0.02, 0.2, -55.0, 4.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    auto *ng0 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 10, paramValsA, varVals);
+    auto *ng1 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons1", 10, paramValsB, varVals);
+    auto *ng2 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons2", 10, paramValsC, varVals);
+    auto *ng3 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons3", 10, paramValsA, varVals);
+    ng0->setParamDynamic("d");
+    ng1->setParamDynamic("d");
+    ng2->setParamDynamic("d");
+
+    model.finalize();
+
+    // Groups with different values of dynamic parameters can be merged but not
+    // if non-dynamic parameters differ or only one group's parameter is dynamic
+    NeuronGroupInternal *ng0Internal = static_cast<NeuronGroupInternal *>(ng0);
+    ASSERT_TRUE(ng0Internal->isParamDynamic(3));
+    ASSERT_FALSE(ng0Internal->isParamDynamic(2));
+    ASSERT_TRUE(ng0Internal->canBeMerged(*ng1));
+    ASSERT_EQ(ng0Internal->getHashDigest(), static_cast<NeuronGroupInternal*>(ng1)->getHashDigest());
     ASSERT_FALSE(ng0Internal->canBeMerged(*ng2));
+    ASSERT_FALSE(ng0Internal->canBeMerged(*ng3));
+}
+
+TEST(NeuronGroup, CompareSpikeRecording)
+{
+    ModelSpecInternal model;
+
+    // Add three neuron groups to model, two with spike recording enabled
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    auto *ng0 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 10, paramVals, varVals);
+    auto *ng1 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons1", 20, paramVals, varVals);
+    auto *ng2 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons2", 10, paramVals, varVals);
+    ng0->setSpikeRecordingEnabled(true);
+    ng1->setSpikeRecordingEnabled(true);
+
+    model.finalize();
+
+    // Groups can only be merged if they both have spike recording enabled or disabled
+    NeuronGroupInternal *ng0Internal = static_cast<NeuronGroupInternal *>(ng0);
+    ASSERT_TRUE(model.isRecordingInUse());
+    ASSERT_TRUE(ng0Internal->canBeMerged(*ng1));
+    ASSERT_EQ(ng0Internal->getHashDigest(), static_cast<NeuronGroupInternal*>(ng1)->getHashDigest());
+    ASSERT_FALSE(ng0Internal->canBeMerged(*ng2));
+    ASSERT_NE(ng0Internal->getHashDigest(), static_cast<NeuronGroupInternal*>(ng2)->getHashDigest());
 }
 
 TEST(NeuronGroup, CompareCurrentSources)
@@ -140,7 +227,9 @@ TEST(NeuronGroup, CompareCurrentSources)
 
     NeuronGroupInternal *ng0Internal = static_cast<NeuronGroupInternal *>(ng0);
     ASSERT_TRUE(ng0Internal->canBeMerged(*ng1));
+    ASSERT_EQ(ng0Internal->getHashDigest(), static_cast<NeuronGroupInternal*>(ng1)->getHashDigest());
     ASSERT_TRUE(ng0Internal->canBeMerged(*ng2));
+    ASSERT_EQ(ng0Internal->getHashDigest(), static_cast<NeuronGroupInternal*>(ng2)->getHashDigest());
     ASSERT_FALSE(ng0Internal->canBeMerged(*ng3));
 }
 
@@ -205,7 +294,9 @@ TEST(NeuronGroup, ComparePostsynapticModels)
 
     NeuronGroupInternal *ng0Internal = static_cast<NeuronGroupInternal *>(ng0);
     ASSERT_TRUE(ng0Internal->canBeMerged(*ng1));
+    ASSERT_EQ(ng0Internal->getHashDigest(), static_cast<NeuronGroupInternal*>(ng1)->getHashDigest());
     ASSERT_TRUE(ng0Internal->canBeMerged(*ng2));
+    ASSERT_EQ(ng0Internal->getHashDigest(), static_cast<NeuronGroupInternal*>(ng2)->getHashDigest());
     ASSERT_FALSE(ng0Internal->canBeMerged(*ng3));
 }
 
@@ -263,8 +354,10 @@ TEST(NeuronGroup, CompareWUPreUpdate)
 
     NeuronGroupInternal *ng1Internal = static_cast<NeuronGroupInternal *>(ng1);
     ASSERT_TRUE(ng1Internal->canBeMerged(*ng2));
+    ASSERT_EQ(ng1Internal->getHashDigest(), static_cast<NeuronGroupInternal*>(ng2)->getHashDigest());
     ASSERT_FALSE(ng1Internal->canBeMerged(*ng3));
     ASSERT_TRUE(ng1Internal->canBeMerged(*ng4));
+    ASSERT_EQ(ng1Internal->getHashDigest(), static_cast<NeuronGroupInternal*>(ng4)->getHashDigest());
 }
 
 TEST(NeuronGroup, CompareWUPostUpdate)
@@ -323,8 +416,10 @@ TEST(NeuronGroup, CompareWUPostUpdate)
 
     NeuronGroupInternal *ng1Internal = static_cast<NeuronGroupInternal *>(ng1);
     ASSERT_TRUE(ng1Internal->canBeMerged(*ng2));
+    ASSERT_EQ(ng1Internal->getHashDigest(), static_cast<NeuronGroupInternal*>(ng2)->getHashDigest());
     ASSERT_FALSE(ng1Internal->canBeMerged(*ng3));
     ASSERT_TRUE(ng1Internal->canBeMerged(*ng4));
+    ASSERT_EQ(ng1Internal->getHashDigest(), static_cast<NeuronGroupInternal*>(ng4)->getHashDigest());
 }
 
 TEST(NeuronGroup, InitCompareDifferentVars)
@@ -345,5 +440,48 @@ TEST(NeuronGroup, InitCompareDifferentVars)
 
     NeuronGroupInternal *ng0Internal = static_cast<NeuronGroupInternal *>(ng0);
     ASSERT_TRUE(ng0Internal->canBeMerged(*ng1));
+    ASSERT_EQ(ng0Internal->getHashDigest(), static_cast<NeuronGroupInternal*>(ng1)->getHashDigest());
     ASSERT_FALSE(ng0Internal->canBeMerged(*ng2));
 }
+
+TEST(NeuronGroup, DynamicParamsUsedByDerivedParams)
+{
+    ModelSpecInternal model;
+
+    NeuronModels::LIF::ParamValues paramVals(0.25, 10.0, -65.0, -65.0, -50.0, 0.0, 2.0);
+    NeuronModels::LIF::VarValues varVals(-65.0, 0.0);
+    auto *ng = model.addNeuronPopulation<NeuronModels::LIF>("Neurons0", 10, paramVals, varVals);
+
+    // TauM and C are used to calculate ExpTC and Rmembrane so can't be dynamic
+    EXPECT_THROW(ng->setParamDynamic("TauM"), std::runtime_error);
+    EXPECT_THROW(ng->setParamDynamic("C"), std::runtime_error);
+
+    // Other parameters can be
+    ng->setParamDynamic("Ioffset");
+    ng->setParamDynamic("TauM", false);
+
+    NeuronGroupInternal *ngInternal = static_cast<NeuronGroupInternal *>(ng);
+    ASSERT_TRUE(ngInternal->isParamDynamic(5));
+    ASSERT_FALSE(ngInternal->isParamDynamic(1));
+}
+
+TEST(NeuronGroup, DynamicParamsUsedByDeclaredDerivedParams)
+{
+    ModelSpecInternal model;
+
+    // Rate is saturated so probing a different value wouldn't change pSpike
+    SaturatingDerivedParams::ParamValues paramVals(100000.0, 0.0, 0.0);
+    SaturatingDerivedParams::VarValues varVals(0.0);
+    auto *ng = model.addNeuronPopulation<SaturatingDerivedParams>("Neurons0", 10, paramVals, varVals);
+
+    // Rate is declared as being used by pSpike and scale doesn't declare which parameters it uses so neither can be dynamic
+    EXPECT_THROW(ng->setParamDynamic("rate"), std::runtime_error);
+    EXPECT_THROW(ng->setParamDynamic("gain"), std::runtime_error);
+    EXPECT_THROW(ng->setParamDynamic("offset"), std::runtime_error);
+
+    // Derived parameters which declare unknown parameters are an error
+    UnknownDerivedParamDependency::ParamValues unknownParamVals(1.0);
+    UnknownDerivedParamDependency::VarValues unknownVarVals(0.0);
+    auto *ngUnknown = model.addNeuronPopulation<UnknownDerivedParamDependency>("Neurons1", 10, unknownParamVals, unknownVarVals);
+    EXPECT_THROW(ngUnknown->setParamDynamic("gain"), std::runtime_error);
+}
@@ -0,0 +1,382 @@
+// Standard C++ includes
+#include <sstream>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// GeNN includes
+#include "modelSpecInternal.h"
+
+// GeNN code generator includes
+#include "code_generator/codeStream.h"
+#include "code_generator/generateInit.h"
+#include "code_generator/generateSynapseUpdate.h"
+#include "code_generator/modelSpecMerged.h"
+
+// Single-threaded CPU backend includes
+#include "backend.h"
+
+using namespace CodeGenerator;
+
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+//! Connectivity initialisation snippet which doesn't define maximum row length so it can be set by tests
+class Diagonal : public InitSparseConnectivitySnippet::Base
+{
+public:
+    DECLARE_SNIPPET(Diagonal, 0);
+
+    SET_ROW_BUILD_CODE(
+        "$(addSynapse, $(id_pre) % $(num_post));\n"
+        "$(endRow);\n");
+};
+IMPLEMENT_SNIPPET(Diagonal);
+
+//! Weight update model whose synapse dynamics code is set by tests
+class ContinuousSynapse : public WeightUpdateModels::Base
+{
+public:
+    typedef Snippet::ValueBase<0> ParamValues;
+    typedef Models::VarInitContainerBase<1> VarValues;
+    typedef Models::VarInitContainerBase<0> PreVarValues;
+    typedef Models::VarInitContainerBase<0> PostVarValues;
+
+    ContinuousSynapse(const std::string &synapseDynamicsCode) : m_SynapseDynamicsCode(synapseDynamicsCode)
+    {
+    }
+
+    virtual std::string getSynapseDynamicsCode() const override{ return m_SynapseDynamicsCode; }
+    virtual VarVec getVars() const override{ return {{"g", "scalar"}}; }
+
+private:
+    const std::string m_SynapseDynamicsCode;
+};
+
+SynapseGroupInternal *addSynapsePopulation(ModelSpecInternal &model, SynapseMatrixType matrixType,
+                                           unsigned int numPre, unsigned int numPost)
+{
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", numPre, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Post", numPost, {}, {});
+
+    WeightUpdateModels::StaticPulse::VarValues staticPulseVarVals(0.1);
+    auto *sg = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", matrixType, NO_DELAY, "Pre", "Post",
+        {}, staticPulseVarVals,
+        {}, {},
+        (matrixType == SynapseMatrixType::DENSE_GLOBALG) ? uninitialisedConnectivity()
+            : initConnectivity<Diagonal>());
+    return static_cast<SynapseGroupInternal*>(sg);
+}
+
+void generateCode(const ModelSpecInternal &model, std::string &synapseUpdateCode, std::string &initCode,
+                  const SingleThreadedCPU::Preferences &preferences = SingleThreadedCPU::Preferences())
+{
+    SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+    ModelSpecMerged modelMerged(model, backend);
+
+    std::ostringstream synapseUpdateStream;
+    std::ostringstream initStream;
+    CodeStream synapseUpdate(synapseUpdateStream);
+    CodeStream init(initStream);
+
+    MergedEGPMap mergedEGPs;
+    generateSynapseUpdate(synapseUpdate, mergedEGPs, modelMerged, backend, nullptr, false);
+    generateInit(init, mergedEGPs, modelMerged, backend, nullptr, false);
+
+    synapseUpdateCode = synapseUpdateStream.str();
+    initCode = initStream.str();
+}
+
+bool isWeightedSumGenerated(const std::string &synapseDynamicsCode, SynapseMatrixType matrixType = SynapseMatrixType::DENSE_INDIVIDUALG)
+{
+    ModelSpecInternal model;
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 100, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Post", 100, {}, {});
+
+    const ContinuousSynapse wum(synapseDynamicsCode);
+    model.addSynapsePopulation<ContinuousSynapse, PostsynapticModels::DeltaCurr>(
+        "Syn", matrixType, NO_DELAY, "Pre", "Post",
+        &wum, {}, ContinuousSynapse::VarValues(uninitialisedVar()), {}, {},
+        PostsynapticModels::DeltaCurr::getInstance(), {}, {});
+    model.finalize();
+
+    std::string synapseUpdateCode;
+    std::string initCode;
+    generateCode(model, synapseUpdateCode, initCode);
+    return (synapseUpdateCode.find("weightedSum[j - blockBegin] += ") != std::string::npos);
+}
+}   // Anonymous namespace
+
+//--------------------------------------------------------------------------
+// Tests
+//--------------------------------------------------------------------------
+TEST(SingleThreadedCPUBackend, SixtyFourBitIndicesDense)
+{
+    SingleThreadedCPU::Preferences preferences;
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::DENSE_GLOBALG, 1000, 1000);
+        model.finalize();
+
+        SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+        ASSERT_FALSE(backend.areSixtyFourBitSynapseIndicesRequired(*sg));
+        ASSERT_EQ(backend.getSynapseIndexType(*sg), "unsigned int");
+    }
+
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::DENSE_GLOBALG, 100000, 50000);
+        model.finalize();
+
+        SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+        ASSERT_TRUE(backend.areSixtyFourBitSynapseIndicesRequired(*sg));
+        ASSERT_EQ(backend.getSynapseIndexType(*sg), "uint64_t");
+    }
+}
+
+TEST(SingleThreadedCPUBackend, SixtyFourBitIndicesSparse)
+{
+    SingleThreadedCPU::Preferences preferences;
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::SPARSE_GLOBALG, 100000, 50000);
+        sg->setMaxConnections(1000);
+        sg->setMaxSourceConnections(1000);
+        model.finalize();
+
+        SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+        ASSERT_FALSE(backend.areSixtyFourBitSynapseIndicesRequired(*sg));
+    }
+
+    // Row-major synapse indices overflow
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::SPARSE_GLOBALG, 100000, 50000);
+        sg->setMaxConnections(50000);
+        sg->setMaxSourceConnections(1000);
+        model.finalize();
+
+        SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+        ASSERT_TRUE(backend.areSixtyFourBitSynapseIndicesRequired(*sg));
+    }
+
+    // Column-major indices used by postsynaptic learning overflow
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::SPARSE_GLOBALG, 100000, 50000);
+        sg->setMaxConnections(1000);
+        sg->setMaxSourceConnections(100000);
+        model.finalize();
+
+        SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+        ASSERT_TRUE(backend.areSixtyFourBitSynapseIndicesRequired(*sg));
+    }
+}
+
+TEST(SingleThreadedCPUBackend, SixtyFourBitIndicesCSR)
+{
+    SingleThreadedCPU::Preferences preferences;
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::CSR_GLOBALG, 100000, 50000);
+        sg->setMaxConnections(1000);
+        model.finalize();
+
+        SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+        ASSERT_FALSE(backend.areSixtyFourBitSynapseIndicesRequired(*sg));
+    }
+
+    // **NOTE** CSR indices only depend on total number of synapses, not on padded row length
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::CSR_GLOBALG, 100000, 50000);
+        sg->setMaxConnections(1000);
+        sg->setMaxSynapses(5000000000);
+        model.finalize();
+
+        SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+        ASSERT_TRUE(backend.areSixtyFourBitSynapseIndicesRequired(*sg));
+    }
+}
+
+TEST(SingleThreadedCPUBackend, SixtyFourBitIndicesBitmask)
+{
+    SingleThreadedCPU::Preferences preferences;
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::BITMASK_GLOBALG, 1000, 1000);
+        model.finalize();
+
+        SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+        ASSERT_FALSE(backend.areSixtyFourBitSynapseIndicesRequired(*sg));
+    }
+
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::BITMASK_GLOBALG, 100000, 50000);
+        model.finalize();
+
+        SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+        ASSERT_TRUE(backend.areSixtyFourBitSynapseIndicesRequired(*sg));
+    }
+}
+
+TEST(SingleThreadedCPUBackend, SixtyFourBitIndicesCodeSparse)
+{
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::SPARSE_GLOBALG, 1000, 1000);
+        sg->setMaxConnections(1000);
+        model.finalize();
+
+        std::string synapseUpdateCode;
+        std::string initCode;
+        generateCode(model, synapseUpdateCode, initCode);
+        ASSERT_NE(synapseUpdateCode.find("const unsigned int synAddress = (ipre * group.rowStride) + j;"), std::string::npos);
+        ASSERT_NE(initCode.find("group.ind[(i * group.rowStride) + (group.rowLength[i]++)]"), std::string::npos);
+    }
+
+    // Synapse addresses should be calculated with 64-bit arithmetic
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::SPARSE_GLOBALG, 100000, 50000);
+        sg->setMaxConnections(50000);
+        model.finalize();
+
+        std::string synapseUpdateCode;
+        std::string initCode;
+        generateCode(model, synapseUpdateCode, initCode);
+        ASSERT_NE(synapseUpdateCode.find("const uint64_t synAddress = ((uint64_t)ipre * group.rowStride) + j;"), std::string::npos);
+        ASSERT_NE(initCode.find("group.ind[((uint64_t)i * group.rowStride) + (group.rowLength[i]++)]"), std::string::npos);
+    }
+}
+
+TEST(SingleThreadedCPUBackend, SixtyFourBitIndicesCodeBitmask)
+{
+    // **NOTE** bit indices are always calculated with 64-bit arithmetic
+    ModelSpecInternal model;
+    addSynapsePopulation(model, SynapseMatrixType::BITMASK_GLOBALG, 100000, 50000);
+    model.finalize();
+
+    std::string synapseUpdateCode;
+    std::string initCode;
+    generateCode(model, synapseUpdateCode, initCode);
+    ASSERT_NE(initCode.find("const uint64_t rowStartGID = (uint64_t)i * group.rowStride;"), std::string::npos);
+}
+
+TEST(SingleThreadedCPUBackend, SlicedSparseLayout)
+{
+    SingleThreadedCPU::Preferences preferences;
+    preferences.enableSlicedSparseLayout = true;
+
+    // SPARSE connectivity should be sliced
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::SPARSE_INDIVIDUALG, 1000, 1000);
+        sg->setMaxConnections(10);
+        model.finalize();
+
+        SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+        ASSERT_TRUE(backend.isSparseLayoutSliced(*sg));
+
+        std::string synapseUpdateCode;
+        std::string initCode;
+        generateCode(model, synapseUpdateCode, initCode, preferences);
+        ASSERT_NE(synapseUpdateCode.find("const unsigned int synAddress = rowStart + (j * rowStride);"), std::string::npos);
+        ASSERT_NE(initCode.find("// Move ind from row-major into sliced layout"), std::string::npos);
+
+        // **NOTE** g is initialised by GeNN directly into the sliced layout so doesn't need moving
+        ASSERT_EQ(initCode.find("// Move g from row-major into sliced layout"), std::string::npos);
+    }
+
+    // Other connectivity and SPARSE connectivity without the preference should not
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::DENSE_INDIVIDUALG, 1000, 1000);
+        model.finalize();
+
+        SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+        ASSERT_FALSE(backend.isSparseLayoutSliced(*sg));
+    }
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::SPARSE_INDIVIDUALG, 1000, 1000);
+        model.finalize();
+
+        SingleThreadedCPU::Backend backend(model.getPrecision(), SingleThreadedCPU::Preferences());
+        ASSERT_FALSE(backend.isSparseLayoutSliced(*sg));
+    }
+
+    // Sort window must contain a whole number of slices
+    preferences.sparseSortWindowSize = 100;
+    EXPECT_THROW(SingleThreadedCPU::Backend("float", preferences), std::runtime_error);
+}
+
+TEST(SingleThreadedCPUBackend, TiledSparseLayout)
+{
+    SingleThreadedCPU::Preferences preferences;
+    preferences.postsynapticTileSize = 256;
+
+    // SPARSE connectivity should be tiled
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::SPARSE_INDIVIDUALG, 1000, 1000);
+        sg->setMaxConnections(10);
+        model.finalize();
+
+        SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+        ASSERT_EQ(backend.getSparseLayoutTileSize(*sg), 256u);
+
+        std::string synapseUpdateCode;
+        std::string initCode;
+        generateCode(model, synapseUpdateCode, initCode, preferences);
+        ASSERT_NE(synapseUpdateCode.find("for (unsigned int synAddress = tileRowPtr[ipre]; synAddress < tileRowPtr[ipre + 1]; synAddress++)"), std::string::npos);
+        ASSERT_NE(initCode.find("// Move ind from row-major into tiled layout"), std::string::npos);
+
+        // **NOTE** g is initialised row-major so also needs moving
+        ASSERT_NE(initCode.find("// Move g from row-major into tiled layout"), std::string::npos);
+    }
+
+    // Other connectivity and SPARSE connectivity without the preference should not
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::DENSE_INDIVIDUALG, 1000, 1000);
+        model.finalize();
+
+        SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+        ASSERT_EQ(backend.getSparseLayoutTileSize(*sg), 0u);
+    }
+    {
+        ModelSpecInternal model;
+        auto *sg = addSynapsePopulation(model, SynapseMatrixType::SPARSE_INDIVIDUALG, 1000, 1000);
+        model.finalize();
+
+        SingleThreadedCPU::Backend backend(model.getPrecision(), SingleThreadedCPU::Preferences());
+        ASSERT_EQ(backend.getSparseLayoutTileSize(*sg), 0u);
+    }
+
+    // Tiled layout can't be combined with sliced layout
+    preferences.enableSlicedSparseLayout = true;
+    EXPECT_THROW(SingleThreadedCPU::Backend("float", preferences), std::runtime_error);
+}
+
+TEST(SingleThreadedCPUBackend, WeightedSumSynapseDynamics)
+{
+    // Single side-effect free addToInSyn should be generated as a weighted sum
+    ASSERT_TRUE(isWeightedSumGenerated("$(addToInSyn, $(g));\n"));
+    ASSERT_TRUE(isWeightedSumGenerated("  $(addToInSyn, $(g) * ($(id_pre) == $(id_post) ? 1.0 : 2.0))"));
+    ASSERT_TRUE(isWeightedSumGenerated("$(addToInSyn, exp($(g)));\n"));
+
+    // Code with side-effects, other statements or random numbers should not
+    ASSERT_FALSE(isWeightedSumGenerated("$(addToInSyn, $(g));\n$(g) *= 0.9;\n"));
+    ASSERT_FALSE(isWeightedSumGenerated("$(addToInSyn, $(g)++);\n"));
+    ASSERT_FALSE(isWeightedSumGenerated("$(addToInSyn, $(g) * $(gennrand_uniform));\n"));
+    ASSERT_FALSE(isWeightedSumGenerated("$(addToInSyn, getWeight($(g)));\n"));
+    ASSERT_FALSE(isWeightedSumGenerated("$(addToInSyn, $(g));\n$(addToInSyn, $(g));\n"));
+
+    // Nor should synapse groups which aren't DENSE
+    ASSERT_FALSE(isWeightedSumGenerated("$(addToInSyn, $(g));\n", SynapseMatrixType::SPARSE_INDIVIDUALG));
+}
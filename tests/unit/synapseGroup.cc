@@ -110,6 +110,7 @@ TEST(SynapseGroup, CompareWUDifferentGlobalG)
 
     SynapseGroupInternal *sg0Internal = static_cast<SynapseGroupInternal*>(sg0);
     ASSERT_TRUE(sg0Internal->canWUBeMerged(*sg1));
+    ASSERT_EQ(sg0Internal->getWUHashDigest(), static_cast<SynapseGroupInternal*>(sg1)->getWUHashDigest());
     ASSERT_FALSE(sg0Internal->canWUBeMerged(*sg2));
 }
 
@@ -146,6 +147,7 @@ TEST(SynapseGroup, CompareWUDifferentProceduralConnectivity)
 
     SynapseGroupInternal *sg0Internal = static_cast<SynapseGroupInternal *>(sg0);
     ASSERT_TRUE(sg0Internal->canWUBeMerged(*sg1));
+    ASSERT_EQ(sg0Internal->getWUHashDigest(), static_cast<SynapseGroupInternal*>(sg1)->getWUHashDigest());
     ASSERT_FALSE(sg0Internal->canWUBeMerged(*sg2));
 }
 
@@ -184,6 +186,7 @@ TEST(SynapseGroup, CompareWUDifferentProceduralVars)
 
     SynapseGroupInternal *sg0Internal = static_cast<SynapseGroupInternal *>(sg0);
     ASSERT_TRUE(sg0Internal->canWUBeMerged(*sg1));
+    ASSERT_EQ(sg0Internal->getWUHashDigest(), static_cast<SynapseGroupInternal*>(sg1)->getWUHashDigest());
     ASSERT_FALSE(sg0Internal->canWUBeMerged(*sg2));
 }
 
@@ -224,12 +227,17 @@ TEST(SynapseGroup, InitCompareWUDifferentVars)
 
     SynapseGroupInternal *sg0Internal = static_cast<SynapseGroupInternal *>(sg0);
     ASSERT_TRUE(sg0Internal->canWUInitBeMerged(*sg1));
+    ASSERT_EQ(sg0Internal->getWUInitHashDigest(), static_cast<SynapseGroupInternal*>(sg1)->getWUInitHashDigest());
     ASSERT_FALSE(sg0Internal->canWUInitBeMerged(*sg2));
 
     ASSERT_TRUE(sg0Internal->canWUPreInitBeMerged(*sg1));
+    ASSERT_EQ(sg0Internal->getWUPreInitHashDigest(), static_cast<SynapseGroupInternal*>(sg1)->getWUPreInitHashDigest());
     ASSERT_TRUE(sg0Internal->canWUPreInitBeMerged(*sg2));
+    ASSERT_EQ(sg0Internal->getWUPreInitHashDigest(), static_cast<SynapseGroupInternal*>(sg2)->getWUPreInitHashDigest());
     ASSERT_TRUE(sg0Internal->canWUPostInitBeMerged(*sg1));
+    ASSERT_EQ(sg0Internal->getWUPostInitHashDigest(), static_cast<SynapseGroupInternal*>(sg1)->getWUPostInitHashDigest());
     ASSERT_TRUE(sg0Internal->canWUPostInitBeMerged(*sg2));
+    ASSERT_EQ(sg0Internal->getWUPostInitHashDigest(), static_cast<SynapseGroupInternal*>(sg2)->getWUPostInitHashDigest());
 }
 
 TEST(SynapseGroup, InitCompareWUDifferentPreVars)
@@ -269,12 +277,17 @@ TEST(SynapseGroup, InitCompareWUDifferentPreVars)
 
     SynapseGroupInternal *sg0Internal = static_cast<SynapseGroupInternal *>(sg0);
     ASSERT_TRUE(sg0Internal->canWUPreInitBeMerged(*sg1));
+    ASSERT_EQ(sg0Internal->getWUPreInitHashDigest(), static_cast<SynapseGroupInternal*>(sg1)->getWUPreInitHashDigest());
     ASSERT_FALSE(sg0Internal->canWUPreInitBeMerged(*sg2));
 
     ASSERT_TRUE(sg0Internal->canWUInitBeMerged(*sg1));
+    ASSERT_EQ(sg0Internal->getWUInitHashDigest(), static_cast<SynapseGroupInternal*>(sg1)->getWUInitHashDigest());
     ASSERT_TRUE(sg0Internal->canWUInitBeMerged(*sg2));
+    ASSERT_EQ(sg0Internal->getWUInitHashDigest(), static_cast<SynapseGroupInternal*>(sg2)->getWUInitHashDigest());
     ASSERT_TRUE(sg0Internal->canWUPostInitBeMerged(*sg1));
+    ASSERT_EQ(sg0Internal->getWUPostInitHashDigest(), static_cast<SynapseGroupInternal*>(sg1)->getWUPostInitHashDigest());
     ASSERT_TRUE(sg0Internal->canWUPostInitBeMerged(*sg2));
+    ASSERT_EQ(sg0Internal->getWUPostInitHashDigest(), static_cast<SynapseGroupInternal*>(sg2)->getWUPostInitHashDigest());
 }
 
 TEST(SynapseGroup, InitCompareWUDifferentPostVars)
@@ -314,10 +327,83 @@ TEST(SynapseGroup, InitCompareWUDifferentPostVars)
 
     SynapseGroupInternal *sg0Internal = static_cast<SynapseGroupInternal *>(sg0);
     ASSERT_TRUE(sg0Internal->canWUPostInitBeMerged(*sg1));
+    ASSERT_EQ(sg0Internal->getWUPostInitHashDigest(), static_cast<SynapseGroupInternal*>(sg1)->getWUPostInitHashDigest());
     ASSERT_FALSE(sg0Internal->canWUPostInitBeMerged(*sg2));
 
     ASSERT_TRUE(sg0Internal->canWUInitBeMerged(*sg1));
+    ASSERT_EQ(sg0Internal->getWUInitHashDigest(), static_cast<SynapseGroupInternal*>(sg1)->getWUInitHashDigest());
     ASSERT_TRUE(sg0Internal->canWUInitBeMerged(*sg2));
+    ASSERT_EQ(sg0Internal->getWUInitHashDigest(), static_cast<SynapseGroupInternal*>(sg2)->getWUInitHashDigest());
     ASSERT_TRUE(sg0Internal->canWUPreInitBeMerged(*sg1));
+    ASSERT_EQ(sg0Internal->getWUPreInitHashDigest(), static_cast<SynapseGroupInternal*>(sg1)->getWUPreInitHashDigest());
     ASSERT_TRUE(sg0Internal->canWUPreInitBeMerged(*sg2));
+    ASSERT_EQ(sg0Internal->getWUPreInitHashDigest(), static_cast<SynapseGroupInternal*>(sg2)->getWUPreInitHashDigest());
+}
+
+TEST(SynapseGroup, MaxSynapsesCSR)
+{
+    ModelSpecInternal model;
+
+    // Add two neuron groups to model
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 10, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons1", 20, paramVals, varVals);
+
+    WeightUpdateModels::StaticPulse::VarValues staticPulseVarVals(0.1);
+    auto *sg0 = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("Synapses0", SynapseMatrixType::CSR_INDIVIDUALG, NO_DELAY,
+                                                                                                           "Neurons0", "Neurons1",
+                                                                                                           {}, staticPulseVarVals,
+                                                                                                           {}, {});
+    auto *sg1 = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("Synapses1", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY,
+                                                                                                           "Neurons0", "Neurons1",
+                                                                                                           {}, staticPulseVarVals,
+                                                                                                           {}, {});
+
+    // By default, every row can be full
+    ASSERT_EQ(sg0->getMaxSynapses(), 200);
+
+    // Maximum row length limits default maximum number of synapses
+    sg0->setMaxConnections(5);
+    ASSERT_EQ(sg0->getMaxSynapses(), 50);
+
+    // Explicitly set maximum number of synapses overrides this
+    sg0->setMaxSynapses(17);
+    ASSERT_EQ(sg0->getMaxSynapses(), 17);
+
+    // Maximum number of synapses can only be set with CSR connectivity
+    EXPECT_THROW(sg1->setMaxSynapses(17), std::runtime_error);
+
+    // Finalize model
+    model.finalize();
+
+    // CSR and ragged connectivity can't be merged
+    SynapseGroupInternal *sg0Internal = static_cast<SynapseGroupInternal*>(sg0);
+    ASSERT_FALSE(sg0Internal->canWUBeMerged(*sg1));
+}
+
+TEST(SynapseGroup, DynamicParamsUsedByDerivedParams)
+{
+    ModelSpecInternal model;
+
+    // Add two neuron groups to model
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 10, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons1", 10, paramVals, varVals);
+
+    WeightUpdateModels::StaticPulse::VarValues staticPulseVarVals(0.1);
+    PostsynapticModels::ExpCond::ParamValues expCondParamVals(5.0, 0.0);
+    auto *sg = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::ExpCond>("Synapses0", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                                                                                                        "Neurons0", "Neurons1",
+                                                                                                        {}, staticPulseVarVals,
+                                                                                                        expCondParamVals, {});
+
+    // Tau is used to calculate expDecay so can't be dynamic but reversal potential can be
+    EXPECT_THROW(sg->setPSParamDynamic("tau"), std::runtime_error);
+    sg->setPSParamDynamic("E");
+
+    SynapseGroupInternal *sgInternal = static_cast<SynapseGroupInternal*>(sg);
+    ASSERT_FALSE(sgInternal->isPSParamDynamic(0));
+    ASSERT_TRUE(sgInternal->isPSParamDynamic(1));
 }
@@ -0,0 +1,55 @@
+#include "../include/generateRun.h"
+
+class GenerateRun : public GenerateRunBase
+{
+public:
+    GenerateRun()
+    :   GenerateRunBase("ManyPopulations"), m_NumPopulations(1000), m_NumParamSets(10), m_NeuronsPerPopulation(100), m_DurationMs(100.0)
+    {
+        getApp().add_option("--num-populations", m_NumPopulations, "Number of neuron populations", true);
+        getApp().add_option("--num-param-sets", m_NumParamSets, "Number of distinct parameter sets shared between populations", true);
+        getApp().add_option("--neurons-per-population", m_NeuronsPerPopulation, "Number of neurons in each population", true);
+        getApp().add_option("--duration", m_DurationMs, "Duration of simulation [ms]", true);
+    }
+
+    //------------------------------------------------------------------------
+    // GenerateRunBase virtuals
+    //------------------------------------------------------------------------
+    virtual void writeSizes(std::ofstream &sizes) const override
+    {
+        // Superclass
+        GenerateRunBase::writeSizes(sizes);
+
+        sizes << "#define _NumPopulations " << m_NumPopulations << std::endl;
+        sizes << "#define _NumParamSets " << m_NumParamSets << std::endl;
+        sizes << "#define _NeuronsPerPopulation " << m_NeuronsPerPopulation << std::endl;
+        sizes << "#define _DurationMs " << m_DurationMs << std::endl;
+    }
+
+private:
+    unsigned int m_NumPopulations;
+    unsigned int m_NumParamSets;
+    unsigned int m_NeuronsPerPopulation;
+    double m_DurationMs;
+};
+
+int main(int argc, char *argv[])
+{
+    // Parse command line
+    GenerateRun generateRun;
+    try {
+        generateRun.parseCommandLine(argc, argv);
+    }
+    catch(const CLI::ParseError &e) {
+        return generateRun.getExitCode(e);
+    }
+
+    // Write model sizes
+    {
+        std::ofstream sizes("model/sizes.h");
+        generateRun.writeSizes(sizes);
+    }
+
+    // Build and run model
+    return generateRun.buildAndRun();
+}
@@ -0,0 +1,79 @@
+// GeNN includes
+#include "modelSpec.h"
+
+// Model includes
+#include "ManyPopulationsParams.h"
+
+//----------------------------------------------------------------------------
+// Synthetic model with many populations used to benchmark code generation.
+// Populations are assigned one of Parameters::numParamSets sets of parameters
+// so, ideally, the model is merged into that many groups of each type.
+//----------------------------------------------------------------------------
+void modelDefinition(NNmodel &model)
+{
+#ifdef DEBUG
+    GENN_PREFERENCES.debugCode = true;
+#else
+    GENN_PREFERENCES.optimizeCode = true;
+#endif // DEBUG
+
+#ifdef _GPU_DEVICE
+    GENN_PREFERENCES.deviceSelectMethod = DeviceSelect::MANUAL;
+    GENN_PREFERENCES.manualDeviceID = _GPU_DEVICE;
+#endif
+    model.setDT(Parameters::dtMs);
+    model.setName("ManyPopulations");
+    model.setTiming(Parameters::measureTiming);
+    model.setDefaultVarLocation(VarLocation::DEVICE);
+    model.setDefaultSparseConnectivityLocation(VarLocation::DEVICE);
+
+    // LIF initial conditions
+    NeuronModels::LIF::VarValues lifInit(
+        -65.0,  // 0 - V
+        0.0);   // 1 - RefracTime
+
+    PostsynapticModels::ExpCurr::ParamValues expCurrParams(
+        5.0);  // 0 - TauSyn (ms)
+
+    InitSparseConnectivitySnippet::FixedProbability::ParamValues fixedProb(
+        Parameters::connectionProbability); // 0 - prob
+
+    std::cout << "Creating " << Parameters::numPopulations << " neuron populations with " << Parameters::numParamSets << " parameter sets" << std::endl;
+    for(unsigned int pop = 0; pop < Parameters::numPopulations; pop++) {
+        const std::string popName = Parameters::getPopulationName(pop);
+        const unsigned int paramSet = pop % Parameters::numParamSets;
+
+        // LIF model parameters
+        NeuronModels::LIF::ParamValues lifParams(
+            0.25,                       // 0 - C
+            10.0 + (double)paramSet,    // 1 - TauM
+            -65.0,                      // 2 - Vrest
+            -65.0,                      // 3 - Vreset
+            -50.0,                      // 4 - Vthresh
+            0.0,                        // 5 - Ioffset
+            2.0);                       // 6 - TauRefrac
+        model.addNeuronPopulation<NeuronModels::LIF>(popName, Parameters::neuronsPerPopulation, lifParams, lifInit);
+
+        // Drive each population with a DC current
+        CurrentSourceModels::DC::ParamValues dcParams(
+            0.5 + (0.01 * (double)paramSet));   // 0 - amp
+        model.addCurrentSource<CurrentSourceModels::DC>(popName + "_dc", popName, dcParams, {});
+    }
+
+    // Connect each population to the next one in a ring
+    std::cout << "Creating " << Parameters::numPopulations << " synapse populations" << std::endl;
+    for(unsigned int pop = 0; pop < Parameters::numPopulations; pop++) {
+        const std::string srcName = Parameters::getPopulationName(pop);
+        const std::string trgName = Parameters::getPopulationName((pop + 1) % Parameters::numPopulations);
+
+        WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(
+            0.01 * (double)(1 + ((pop + 1) % Parameters::numParamSets)));   // 0 - Wij (nA)
+
+        model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::ExpCurr>(
+            srcName + "_" + trgName, SynapseMatrixType::SPARSE_GLOBALG, NO_DELAY,
+            srcName, trgName,
+            {}, staticSynapseInit,
+            expCurrParams, {},
+            initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProb));
+    }
+}
@@ -0,0 +1,35 @@
+// Standard C++ includes
+#include <string>
+
+// Include parameters generated by generate_run
+#include "sizes.h"
+
+// Parameters
+namespace Parameters
+{
+// Simulation timestep [ms]
+const double dtMs = 0.1;
+
+// Simulation duration [ms]
+const double durationMs = _DurationMs;
+
+// Should we measure timing of individual kernels
+const bool measureTiming = _TIMING;
+
+// Number of neuron populations
+const unsigned int numPopulations = _NumPopulations;
+
+// Number of distinct parameter sets - populations using the same set can be merged
+const unsigned int numParamSets = _NumParamSets;
+
+// Number of neurons in each population
+const unsigned int neuronsPerPopulation = _NeuronsPerPopulation;
+
+// Probability of connection between neurons in neighbouring populations
+const double connectionProbability = 0.1;
+
+std::string getPopulationName(unsigned int pop)
+{
+    return "Pop" + std::to_string(pop);
+}
+}
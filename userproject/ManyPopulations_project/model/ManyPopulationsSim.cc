@@ -0,0 +1,49 @@
+// Standard C++ includes
+#include <iostream>
+
+// Standard C includes
+#include <cmath>
+
+// GeNN user project includes
+#include "../include/sharedLibraryModel.h"
+#include "../include/timer.h"
+
+// Model parameters
+#include "ManyPopulationsParams.h"
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        std::cerr << "usage: ManyPopulations <basename>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    SharedLibraryModel<float> model("./", "ManyPopulations");
+
+    {
+        Timer timer("Initialisation:");
+        model.allocateMem();
+        model.initialize();
+        model.initializeSparse();
+    }
+
+    {
+        Timer timer("Simulation:");
+
+        // Loop through timesteps
+        const unsigned int timesteps = round(Parameters::durationMs / Parameters::dtMs);
+        for(unsigned int i = 0; i < timesteps; i++) {
+            model.stepTime();
+        }
+    }
+
+    if(Parameters::measureTiming) {
+        std::cout << "Timing:" << std::endl;
+        std::cout << "\tInit:" << *model.getScalar<double>("initTime") * 1000.0 << std::endl;
+        std::cout << "\tSparse init:" << *model.getScalar<double>("initSparseTime") * 1000.0 << std::endl;
+        std::cout << "\tNeuron simulation:" << *model.getScalar<double>("neuronUpdateTime") * 1000.0 << std::endl;
+        std::cout << "\tSynapse simulation:" << *model.getScalar<double>("presynapticUpdateTime") * 1000.0 << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -4,11 +4,13 @@ class GenerateRun : public GenerateRunBase
 {
 public:
     GenerateRun()
-    :   GenerateRunBase("PotjansMicrocircuit"), m_NeuronScale(0.5), m_ConnectivityScale(0.5), m_DurationMs(1000.0)
+    :   GenerateRunBase("PotjansMicrocircuit"), m_NeuronScale(0.5), m_ConnectivityScale(0.5), m_DurationMs(1000.0), m_PostsynapticTileSize(0)
     {
         getApp().add_option("--neuron-scale", m_NeuronScale, "Scaling factor for number of neurons", true);
         getApp().add_option("--connectivity-scale", m_ConnectivityScale, "Scaling factor for connectivity", true);
         getApp().add_option("--duration", m_DurationMs, "Duration of simulation [ms]", true);
+        getApp().add_option("--postsynaptic-tile-size", m_PostsynapticTileSize, "Number of postsynaptic neurons in each tile of the tiled sparse layout (0 = no tiling)", true)
+            ->needs(getApp().get_option("--cpu-only"));
     }
 
     //------------------------------------------------------------------------
@@ -22,12 +24,17 @@ public:
         sizes << "#define _NeuronScale " << m_NeuronScale << std::endl;
         sizes << "#define _ConnectivityScale " << m_ConnectivityScale << std::endl;
         sizes << "#define _DurationMs " << m_DurationMs << std::endl;
+
+        if(m_PostsynapticTileSize != 0) {
+            sizes << "#define _POSTSYNAPTIC_TILE_SIZE " << m_PostsynapticTileSize << std::endl;
+        }
     }
 
 private:
     double m_NeuronScale;
     double m_ConnectivityScale;
     double m_DurationMs;
+    unsigned int m_PostsynapticTileSize;
 };
 
 int main(int argc, char *argv[])
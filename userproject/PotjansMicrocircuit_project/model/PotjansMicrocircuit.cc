@@ -18,6 +18,9 @@ void modelDefinition(NNmodel &model)
 #ifdef _GPU_DEVICE
     GENN_PREFERENCES.deviceSelectMethod = DeviceSelect::MANUAL;
     GENN_PREFERENCES.manualDeviceID = _GPU_DEVICE;
+#endif
+#ifdef _POSTSYNAPTIC_TILE_SIZE
+    GENN_PREFERENCES.postsynapticTileSize = _POSTSYNAPTIC_TILE_SIZE;
 #endif
     model.setDT(Parameters::dtMs);
     model.setName("PotjansMicrocircuit");
@@ -3,9 +3,16 @@
 // Standard C++ includes
 #include <fstream>
 #include <initializer_list>
+#include <memory>
 #include <string>
 #include <vector>
 
+// Standard C includes
+#include <cstdint>
+
+// Userproject includes
+#include "backgroundFileWriter.h"
+
 //----------------------------------------------------------------------------
 // AnalogueRecorder
 //----------------------------------------------------------------------------
@@ -46,3 +53,53 @@ private:
     const unsigned int m_PopSize;
     const std::string m_Delimiter;
 };
+
+//----------------------------------------------------------------------------
+// AnalogueRecorderBinary
+//----------------------------------------------------------------------------
+//! Class to write analogue variables to binary file from a background thread
+/*! Files start with a 24 byte header containing the magic string "GeNNANA\0" and uint32_t version (1),
+    number of variables, population size and size in bytes of each value (4 for float or 8 for double).
+    This is followed by a record for each call to record containing the time as a double,
+    followed by the value of each neuron in each variable in turn. All values are little-endian.
+    Files can be loaded with load_analogue in userproject/python/load_recordings.py */
+template<typename T>
+class AnalogueRecorderBinary
+{
+public:
+    AnalogueRecorderBinary(const std::string &filename, std::initializer_list<T*> variables, unsigned int popSize,
+                           size_t bufferSize = 16 * 1024 * 1024)
+    :   m_Writer(new BackgroundFileWriter(filename, bufferSize)), m_Variables(variables), m_PopSize(popSize)
+    {
+        const uint32_t header[4] = {1, static_cast<uint32_t>(m_Variables.size()), m_PopSize, sizeof(T)};
+        m_Writer->write("GeNNANA", 8);
+        m_Writer->write(header, sizeof(header));
+    }
+    AnalogueRecorderBinary(const std::string &filename, T *variable, unsigned int popSize, size_t bufferSize = 16 * 1024 * 1024)
+    :   AnalogueRecorderBinary(filename, {variable}, popSize, bufferSize)
+    {
+    }
+
+    void record(double t)
+    {
+        m_Writer->write(&t, sizeof(double));
+        for(auto *v : m_Variables) {
+            m_Writer->write(v, sizeof(T) * m_PopSize);
+        }
+    }
+
+    //! Write all values recorded so far to file
+    void flush()
+    {
+        m_Writer->flush();
+    }
+
+private:
+
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    std::unique_ptr<BackgroundFileWriter> m_Writer;
+    std::vector<T*> m_Variables;
+    const unsigned int m_PopSize;
+};
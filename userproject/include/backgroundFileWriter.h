@@ -0,0 +1,156 @@
+#pragma once
+
+// Standard C++ includes
+#include <algorithm>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------------
+// BackgroundFileWriter
+//----------------------------------------------------------------------------
+//! Class to write binary data to a file from a background thread
+/*! Data is appended to a front buffer which, when full, is swapped with a back buffer
+    that the background thread writes to disk so writing only blocks if the disk can't keep up.
+    **NOTE** as this uses std::thread, code including this header must be linked with -pthread */
+class BackgroundFileWriter
+{
+public:
+    BackgroundFileWriter(const std::string &filename, size_t bufferSize = 16 * 1024 * 1024)
+    :   m_Stream(filename, std::ios::binary), m_BufferSize(bufferSize), m_Writing(false), m_Quit(false), m_Failed(false)
+    {
+        if(!m_Stream.good()) {
+            throw std::runtime_error("Cannot open file '" + filename + "'");
+        }
+
+        m_FrontBuffer.reserve(m_BufferSize);
+        m_BackBuffer.reserve(m_BufferSize);
+
+        // Start writer thread once everything it uses is initialised
+        m_Thread = std::thread(&BackgroundFileWriter::writeThread, this);
+    }
+
+    BackgroundFileWriter(const BackgroundFileWriter&) = delete;
+    BackgroundFileWriter &operator=(const BackgroundFileWriter&) = delete;
+
+    ~BackgroundFileWriter()
+    {
+        // Write any remaining data
+        // **NOTE** destructors can't throw so write errors are only reported by write and flush
+        try {
+            swapBuffers();
+        }
+        catch(const std::runtime_error&) {
+        }
+
+        // Signal thread to quit once it has finished writing and wait for it
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Quit = true;
+        }
+        m_CondVar.notify_all();
+        m_Thread.join();
+    }
+
+    //----------------------------------------------------------------------------
+    // Public API
+    //----------------------------------------------------------------------------
+    //! Append data to file
+    void write(const void *data, size_t size)
+    {
+        const char *bytes = static_cast<const char*>(data);
+        while(size > 0) {
+            // Copy as much data as will fit into front buffer
+            const size_t count = std::min(size, m_BufferSize - m_FrontBuffer.size());
+            m_FrontBuffer.insert(m_FrontBuffer.end(), bytes, bytes + count);
+            bytes += count;
+            size -= count;
+
+            // If front buffer is full, hand it to writer thread
+            if(m_FrontBuffer.size() == m_BufferSize) {
+                swapBuffers();
+            }
+        }
+    }
+
+    //! Write all data appended so far to file and wait for it to complete
+    void flush()
+    {
+        swapBuffers();
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_CondVar.wait(lock, [this](){ return !m_Writing; });
+        if(m_Failed || !m_Stream.flush().good()) {
+            throw std::runtime_error("Error writing to file");
+        }
+    }
+
+private:
+    //----------------------------------------------------------------------------
+    // Private methods
+    //----------------------------------------------------------------------------
+    void swapBuffers()
+    {
+        // Wait for writer thread to finish writing back buffer
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_CondVar.wait(lock, [this](){ return !m_Writing; });
+
+        // If writing previous back buffer failed, give up
+        if(m_Failed) {
+            throw std::runtime_error("Error writing to file");
+        }
+
+        // Swap buffers and signal writer thread
+        if(!m_FrontBuffer.empty()) {
+            std::swap(m_FrontBuffer, m_BackBuffer);
+            m_FrontBuffer.clear();
+            m_Writing = true;
+            lock.unlock();
+            m_CondVar.notify_all();
+        }
+    }
+
+    void writeThread()
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        while(true) {
+            // Wait until there is a back buffer to write or we should quit
+            m_CondVar.wait(lock, [this](){ return m_Writing || m_Quit; });
+            if(!m_Writing) {
+                return;
+            }
+
+            // Write back buffer without holding lock
+            // **NOTE** main thread doesn't touch back buffer while m_Writing is set
+            lock.unlock();
+            m_Stream.write(m_BackBuffer.data(), m_BackBuffer.size());
+            const bool failed = !m_Stream.good();
+            lock.lock();
+
+            m_Failed = m_Failed || failed;
+            m_Writing = false;
+            m_CondVar.notify_all();
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    std::ofstream m_Stream;
+    const size_t m_BufferSize;
+
+    std::vector<char> m_FrontBuffer;
+    std::vector<char> m_BackBuffer;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_CondVar;
+    bool m_Writing;
+    bool m_Quit;
+    bool m_Failed;
+
+    std::thread m_Thread;
+};
@@ -268,6 +268,44 @@ public:
         std::get<2>(funcs)(count);
     }
 
+    void mapConnectivity(const std::string &popName, const std::string &filename)
+    {
+        // Get map function and check it exists
+        auto mapFunc = (MapFunction)getSymbol("map" + popName + "Connectivity", true);
+        if(mapFunc == nullptr) {
+            throw std::runtime_error("You cannot map connectivity of population '" + popName + "' to a file");
+        }
+
+        // Call map
+        // **NOTE** this replaces arrays so any previously obtained with getArray are invalid
+        mapFunc(filename.c_str());
+    }
+
+    void allocateRecordingBuffers(unsigned int timesteps)
+    {
+        // Get allocate function and check it exists
+        auto allocateFunc = (EGPFunction)getSymbol("allocateRecordingBuffers", true);
+        if(allocateFunc == nullptr) {
+            throw std::runtime_error("You cannot allocate recording buffers as no populations have recording enabled");
+        }
+
+        // Call allocate
+        // **NOTE** this replaces recording buffers so any previously obtained with getArray are invalid
+        allocateFunc(timesteps);
+    }
+
+    void pullRecordingBuffersFromDevice()
+    {
+        // Get pull function and check it exists
+        auto pullFunc = (VoidFunction)getSymbol("pullRecordingBuffersFromDevice", true);
+        if(pullFunc == nullptr) {
+            throw std::runtime_error("You cannot pull recording buffers as no populations have recording enabled");
+        }
+
+        // Call pull
+        pullFunc();
+    }
+
     template<typename Writer, typename... WriterArgs>
     SpikeRecorder<Writer> getSpikeRecorder(const std::string &popName, WriterArgs &&... writerArgs)
     {
@@ -383,6 +421,7 @@ private:
     typedef void (*PushFunction)(bool);
     typedef void (*PullFunction)(void);
     typedef void (*EGPFunction)(unsigned int);
+    typedef void (*MapFunction)(const char*);
     typedef size_t (*GetFreeMemFunction)(void);
 
     typedef std::pair<PushFunction, PullFunction> PushPullFunc;
@@ -0,0 +1,144 @@
+#pragma once
+
+// Standard C++ includes
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Standard C includes
+#include <cstdint>
+#include <cstring>
+
+//----------------------------------------------------------------------------
+// SparseMatrixFileWriter
+//----------------------------------------------------------------------------
+//! Class to write connectivity and synapse variables to a file which generated code can memory-map
+/*! Files are attached to a synapse group by calling the map<name>Connectivity(filename) function,
+    generated by CPU backends for SPARSE and CSR synapse groups whose connectivity is not initialised by GeNN.
+    Arrays must have exactly the type and size that GeNN allocates e.g. for SPARSE connectivity,
+    "rowLength" with numPre unsigned ints and "ind" with numPre * maxRowLength indices
+    and, for CSR connectivity, "rowPtr" with numPre + 1 and "ind" with maxSynapses entries.
+    Uninitialised per-synapse variables can be included using the variable's name. */
+class SparseMatrixFileWriter
+{
+public:
+    SparseMatrixFileWriter(unsigned int numPre, unsigned int numPost)
+    :   m_NumPre(numPre), m_NumPost(numPost)
+    {
+    }
+
+    //----------------------------------------------------------------------------
+    // Public API
+    //----------------------------------------------------------------------------
+    //! Add array to file
+    /*! Data is not copied so must remain valid until write is called */
+    template<typename T>
+    void addArray(const std::string &name, const T *data, size_t count)
+    {
+        if(name.size() >= sizeof(Array::name)) {
+            throw std::runtime_error("Sparse matrix file array name '" + name + "' is too long");
+        }
+
+        m_Arrays.emplace_back();
+        std::strncpy(m_Arrays.back().name, name.c_str(), sizeof(Array::name));
+        m_Arrays.back().elementSize = sizeof(T);
+        m_Arrays.back().count = count;
+        m_Data.push_back(reinterpret_cast<const char*>(data));
+    }
+
+    //! Write header and all arrays to file
+    void write(const std::string &filename)
+    {
+        // Lay out arrays after header and array table, aligning each to a cache line
+        uint64_t offset = sizeof(Header) + (m_Arrays.size() * sizeof(Array));
+        for(auto &a : m_Arrays) {
+            offset = padSize(offset);
+            a.offset = offset;
+            offset += a.elementSize * a.count;
+        }
+
+        std::ofstream output(filename, std::ios::binary);
+        if(!output.good()) {
+            throw std::runtime_error("Cannot open sparse matrix file '" + filename + "'");
+        }
+
+        // Write header and array table
+        Header header;
+        std::memcpy(header.magic, "GeNNSPM", 8);
+        header.version = 1;
+        header.numArrays = static_cast<uint32_t>(m_Arrays.size());
+        header.numPre = m_NumPre;
+        header.numPost = m_NumPost;
+        header.reserved = 0;
+        output.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        output.write(reinterpret_cast<const char*>(m_Arrays.data()), m_Arrays.size() * sizeof(Array));
+
+        // Write padding followed by each array
+        uint64_t position = sizeof(Header) + (m_Arrays.size() * sizeof(Array));
+        const char padding[s_Alignment] = {0};
+        for(size_t i = 0; i < m_Arrays.size(); i++) {
+            output.write(padding, m_Arrays[i].offset - position);
+            output.write(m_Data[i], m_Arrays[i].elementSize * m_Arrays[i].count);
+            position = m_Arrays[i].offset + (m_Arrays[i].elementSize * m_Arrays[i].count);
+        }
+
+        if(!output.good()) {
+            throw std::runtime_error("Cannot write sparse matrix file '" + filename + "'");
+        }
+    }
+
+private:
+    //----------------------------------------------------------------------------
+    // Header
+    //----------------------------------------------------------------------------
+    //! File header - must match structure in generated code
+    struct Header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t numArrays;
+        uint32_t numPre;
+        uint32_t numPost;
+        uint64_t reserved;
+    };
+
+    //----------------------------------------------------------------------------
+    // Array
+    //----------------------------------------------------------------------------
+    //! Entry in array table - must match structure in generated code
+    struct Array
+    {
+        Array() : name{0}, elementSize(0), reserved(0), count(0), offset(0)
+        {
+        }
+
+        char name[40];
+        uint32_t elementSize;
+        uint32_t reserved;
+        uint64_t count;
+        uint64_t offset;
+    };
+
+    //----------------------------------------------------------------------------
+    // Static constants
+    //----------------------------------------------------------------------------
+    static constexpr uint64_t s_Alignment = 64;
+
+    //----------------------------------------------------------------------------
+    // Private methods
+    //----------------------------------------------------------------------------
+    static uint64_t padSize(uint64_t size)
+    {
+        return ((size + s_Alignment - 1) / s_Alignment) * s_Alignment;
+    }
+
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    const unsigned int m_NumPre;
+    const unsigned int m_NumPost;
+    std::vector<Array> m_Arrays;
+    std::vector<const char*> m_Data;
+};
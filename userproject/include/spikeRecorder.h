@@ -5,9 +5,16 @@
 #include <fstream>
 #include <iterator>
 #include <list>
+#include <memory>
 #include <tuple>
 #include <vector>
 
+// Standard C includes
+#include <cstdint>
+
+// Userproject includes
+#include "backgroundFileWriter.h"
+
 //----------------------------------------------------------------------------
 // SpikeWriterText
 //----------------------------------------------------------------------------
@@ -128,6 +135,60 @@ private:
     std::list<std::pair<double, std::vector<unsigned int>>> m_Cache;
 };
 
+//----------------------------------------------------------------------------
+// SpikeWriterBinary
+//----------------------------------------------------------------------------
+//! Class to write spikes to binary file from a background thread
+/*! Files start with a 16 byte header containing the magic string "GeNNSPK\0" and uint32_t version (1) and reserved (0) fields.
+    This is followed by a record for each timestep in which spikes were emitted containing the time as a double,
+    the number of spikes as a uint32_t and the uint32_t ID of each neuron which spiked. All values are little-endian.
+    Files can be loaded with load_spikes in userproject/python/load_recordings.py */
+class SpikeWriterBinary
+{
+public:
+    SpikeWriterBinary(const std::string &filename, size_t bufferSize = 16 * 1024 * 1024)
+    :   m_Writer(new BackgroundFileWriter(filename, bufferSize))
+    {
+        const uint32_t header[2] = {1, 0};
+        m_Writer->write("GeNNSPK", 8);
+        m_Writer->write(header, sizeof(header));
+    }
+
+    SpikeWriterBinary(SpikeWriterBinary&& other) = default;
+
+    //----------------------------------------------------------------------------
+    // Public API
+    //----------------------------------------------------------------------------
+    //! Write all spikes recorded so far to file
+    void flush()
+    {
+        m_Writer->flush();
+    }
+
+protected:
+    //----------------------------------------------------------------------------
+    // Protected API
+    //----------------------------------------------------------------------------
+    void recordSpikes(double t, unsigned int spikeCount, const unsigned int *currentSpikes)
+    {
+        static_assert(sizeof(unsigned int) == sizeof(uint32_t), "Neuron IDs are written as uint32_t");
+
+        if(spikeCount > 0) {
+            const uint32_t count = spikeCount;
+            m_Writer->write(&t, sizeof(double));
+            m_Writer->write(&count, sizeof(uint32_t));
+            m_Writer->write(currentSpikes, sizeof(unsigned int) * spikeCount);
+        }
+    }
+
+private:
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    // **NOTE** writer thread refers to BackgroundFileWriter so it's held by pointer to keep this class movable
+    std::unique_ptr<BackgroundFileWriter> m_Writer;
+};
+
 //----------------------------------------------------------------------------
 // SpikeRecorderBase
 //----------------------------------------------------------------------------
@@ -0,0 +1,55 @@
+import numpy as np
+
+# Magic strings at the start of files written by SpikeWriterBinary and AnalogueRecorderBinary
+SPIKE_MAGIC = b"GeNNSPK\0"
+ANALOGUE_MAGIC = b"GeNNANA\0"
+
+def is_binary_spikes(filename):
+    # Check whether file starts with binary spike magic string
+    with open(filename, "rb") as f:
+        return f.read(len(SPIKE_MAGIC)) == SPIKE_MAGIC
+
+def load_spikes(filename):
+    # Read entire file and check header
+    with open(filename, "rb") as f:
+        data = f.read()
+    if data[:8] != SPIKE_MAGIC:
+        raise ValueError("'%s' is not a binary spike file" % filename)
+    version = np.frombuffer(data, dtype="<u4", count=1, offset=8)[0]
+    if version != 1:
+        raise ValueError("'%s' has unsupported version %u" % (filename, version))
+
+    # Loop through per-timestep records
+    times = []
+    neurons = []
+    offset = 16
+    while offset < len(data):
+        time = np.frombuffer(data, dtype="<f8", count=1, offset=offset)[0]
+        count = int(np.frombuffer(data, dtype="<u4", count=1, offset=offset + 8)[0])
+        neurons.append(np.frombuffer(data, dtype="<u4", count=count, offset=offset + 12))
+        times.append(np.full(count, time))
+        offset += 12 + (4 * count)
+
+    # Return times and IDs of all spikes
+    if len(times) == 0:
+        return np.empty(0, dtype=float), np.empty(0, dtype=np.uint32)
+    else:
+        return np.concatenate(times), np.concatenate(neurons)
+
+def load_analogue(filename):
+    # Read header
+    with open(filename, "rb") as f:
+        magic = f.read(8)
+        if magic != ANALOGUE_MAGIC:
+            raise ValueError("'%s' is not a binary analogue file" % filename)
+        version, num_vars, pop_size, value_size = np.fromfile(f, dtype="<u4", count=4)
+        if version != 1:
+            raise ValueError("'%s' has unsupported version %u" % (filename, version))
+
+        # Read fixed-size records
+        value_type = {4: "<f4", 8: "<f8"}[value_size]
+        record_type = np.dtype([("time", "<f8"), ("values", value_type, (num_vars, pop_size))])
+        records = np.fromfile(f, dtype=record_type)
+
+    # Return times and array of values indexed by record, variable and neuron
+    return records["time"], records["values"]
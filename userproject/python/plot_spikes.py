@@ -1,10 +1,14 @@
 import numpy as np
 import matplotlib.pyplot as plt
 import sys
+from load_recordings import is_binary_spikes, load_spikes
 
 def plot(filename, time_range, neuron_range, axis, yoffset=0):
-    # Load data,  transposing each column into a seperate array
-    data = np.loadtxt(filename, dtype=[("time", float), ("neuron", int)], unpack=True)
+    # Load data from binary or text file, transposing each column into a seperate array
+    if is_binary_spikes(filename):
+        data = list(load_spikes(filename))
+    else:
+        data = np.loadtxt(filename, dtype=[("time", float), ("neuron", int)], unpack=True)
 
     # If a time or neuron range were specified
     if time_range is not None or neuron_range is not None: